@@ -0,0 +1,20 @@
+#version 330 core 
+
+in DATA
+{
+    vec4 color;
+    vec2 texCoords;
+    flat int textureSlotRef;
+} fs_in;
+
+out vec4 fragColor;
+
+uniform sampler2D textures[16];
+
+void main()
+{
+    if(fs_in.textureSlotRef >= 0)
+        fragColor = texture(textures[fs_in.textureSlotRef], fs_in.texCoords) * fs_in.color;
+    else
+        fragColor = fs_in.color;
+}
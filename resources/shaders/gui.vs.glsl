@@ -0,0 +1,41 @@
+#version 330 core 
+
+layout (location = 0) in vec4 aColor;
+layout (location = 1) in vec4 aTextureRect;
+layout (location = 2) in vec2 aPosition;
+layout (location = 3) in vec2 aSize;
+layout (location = 4) in float aTextureSlotRef;
+
+out DATA
+{
+    vec4 color;
+    vec2 texCoords;
+    flat int textureSlotRef;
+} vs_out;
+
+uniform vec2 viewSize;
+uniform sampler2D textures[16];
+
+void main()
+{
+    vs_out.color = aColor;
+    vs_out.textureSlotRef = int(aTextureSlotRef);
+
+    vec2 corner;
+    switch(gl_VertexID)
+    {
+        case 0: corner = vec2(0, 1); break;
+        case 1: corner = vec2(1, 1); break;
+        case 2: corner = vec2(1, 0); break;
+        case 3: corner = vec2(0, 0); break;
+    }
+
+    // NOTE: Texture rect is in pixels because glyph atlas can grow between frames
+    if(vs_out.textureSlotRef >= 0)
+        vs_out.texCoords = (aTextureRect.xy + corner * aTextureRect.zw) / vec2(textureSize(textures[vs_out.textureSlotRef], 0));
+    else
+        vs_out.texCoords = vec2(0, 0);
+
+    vec2 position = aPosition + corner * aSize;
+    gl_Position = vec4(position.x * 2 / viewSize.x, -position.y * 2 / viewSize.y, 0, 1);
+}
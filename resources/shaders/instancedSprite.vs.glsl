@@ -7,6 +7,7 @@ layout (location = 3) in vec2 aSize;
 layout (location = 4) in vec2 aRotationOrigin;
 layout (location = 5) in float aRotation;
 layout (location = 6) in float aTextureSlotRef;
+layout (location = 7) in float aZ;
 
 out DATA
 {
@@ -21,7 +22,6 @@ layout (std140) uniform SharedData
     mat4 viewProjectionMatrix;
 };
 
-uniform float z;
 uniform sampler2D textures[32];
 
 mat2 getRotationMatrix(float angle);
@@ -57,10 +57,10 @@ void main()
 	vs_out.texCoords *= vs_out.texSize;
     
     if(aRotation == 0)
-        gl_Position = viewProjectionMatrix * vec4(modelVertexPos + aPosition, z, 1);
+        gl_Position = viewProjectionMatrix * vec4(modelVertexPos + aPosition, aZ, 1);
 	else {
 		vec2 rotatedVertexPos = (modelVertexPos - aRotationOrigin) * getRotationMatrix(aRotation) + aPosition + aRotationOrigin;
-		gl_Position = viewProjectionMatrix * vec4(rotatedVertexPos, z, 1);
+		gl_Position = viewProjectionMatrix * vec4(rotatedVertexPos, aZ, 1);
 	}
 }
 
@@ -4,19 +4,31 @@ in DATA
 {
 	vec2 fragPos;
 	flat vec2 lightPos;
+	flat int lightIndex;
 } fs_in;
 
 out vec4 fragColor;
 
-uniform vec4 color;
+struct Light
+{
+	vec4 color;
+	vec2 position;
+	float a; // attenuation addition
+	float b; // attenuation factor
+	float c; // attenuation square factor
+};
+
+layout (std140) uniform LightsData
+{
+	Light lights[256];
+};
+
 uniform float cameraZoom;
-uniform float a; // attenuation addition 
-uniform float b; // attenuation factor
-uniform float c; // attenuation square factor
 
 void main()
 {
+	Light light = lights[fs_in.lightIndex];
 	float dist = length(fs_in.fragPos - fs_in.lightPos);
-	float lightIntensity = 1.0 / (cameraZoom * (a + b * dist + c * c * dist)); 
-	fragColor = color * lightIntensity;
-}
+	float lightIntensity = 1.0 / (cameraZoom * (light.a + light.b * dist + light.c * light.c * dist)); 
+	fragColor = light.color * lightIntensity;
+}
\ No newline at end of file
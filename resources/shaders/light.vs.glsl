@@ -1,23 +1,39 @@
 #version 330 core
 
 layout (location = 0) in vec2 aPos;
+layout (location = 1) in int aLightIndex;
 
 out DATA
 {
 	vec2 fragPos;
 	flat vec2 lightPos;
+	flat int lightIndex;
 } vs_out;
 
+struct Light
+{
+	vec4 color;
+	vec2 position;
+	float a; // attenuation addition
+	float b; // attenuation factor
+	float c; // attenuation square factor
+};
+
 layout (std140) uniform SharedData
 {
 	mat4 viewProjectionMatrix;
 };
-uniform vec2 lightPos;
+
+layout (std140) uniform LightsData
+{
+	Light lights[256];
+};
 
 void main()
 {
 	vec4 vertexPos = viewProjectionMatrix * vec4(aPos, 0.0, 1.0);
 	vs_out.fragPos = vertexPos.xy;
-	vs_out.lightPos = vec2(viewProjectionMatrix * vec4(lightPos, 0, 1));
+	vs_out.lightPos = vec2(viewProjectionMatrix * vec4(lights[aLightIndex].position, 0, 1));
+	vs_out.lightIndex = aLightIndex;
 	gl_Position = vertexPos;
 }
\ No newline at end of file
@@ -7,6 +7,7 @@ layout (location = 3) in vec2 aSize;
 layout (location = 4) in vec2 aRotationOrigin;
 layout (location = 5) in float aRotation;
 layout (location = 6) in float aTextureSlotRef;
+layout (location = 7) in float aZ;
 
 out DATA
 {
@@ -22,7 +23,6 @@ layout (std140) uniform SharedData
 };
 
 uniform mat4 modelMatrix;
-uniform float z;
 uniform sampler2D textures[32];
 
 void main()
@@ -55,6 +55,6 @@ void main()
 	vs_out.texSize = vec2(textureSize(textures[int(aTextureSlotRef)], 0));
 	vs_out.texCoords *= vs_out.texSize;
     
-	gl_Position = viewProjectionMatrix * modelMatrix * vec4(modelVertexPos, z, 1);
+	gl_Position = viewProjectionMatrix * modelMatrix * vec4(modelVertexPos, aZ, 1);
 }
 
@@ -1,88 +1,265 @@
 #include "musicPlayer.hpp"
+#include "Resources/resourceFileSystem.hpp"
+#include "Logs/logs.hpp"
+#include "Utilities/profiling.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 
 namespace ph {
 
-MusicPlayer::MusicPlayer()
-	:mCurrentThemeFilePath("")
+MusicPlayer::MusicPlayer(std::size_t maxCachedTracks)
+	:mMaxCachedTracks(maxCachedTracks)
+	,mCurrentDeck(0)
+	,mCrossfadeTime(0.f)
+	,mCrossfadeProgress(1.f)
 	,mVolume(60.f)
 	,mIsMuted(false)
-	,mIsPlayingFromMusicState(false)
+	,mIsPaused(false)
+	,mHasPlayRequest(false)
 {
+	mCachedTracks.reserve(mMaxCachedTracks + 1);
 }
 
 MusicPlayer::~MusicPlayer()
 {
-	mMusic.stop();
+	stop();
+	for(auto& loadingTrack : mLoadingTracks)
+		loadingTrack.track.wait();
 }
 
 void MusicPlayer::playFromFile(const std::string& filePath)
 {
-	if (filePath == mCurrentThemeFilePath)
-	{
-		adaptVolume();
+	play(filePath, 1.f, 0.f);
+}
+
+void MusicPlayer::playFromMusicState(const std::string& musicStateName)
+{
+	auto[filePath, volumeMultiplier] = mMusicStateMachine.getRandomThemeFromState(musicStateName);
+	play(filePath, volumeMultiplier, mMusicStateMachine.getCrossfadeTime(musicStateName));
+}
+
+void MusicPlayer::play(const std::string& filePath, const float volumeMultiplier, const float crossfadeTime)
+{
+	Deck& currentDeck = getCurrentDeck();
+	if(currentDeck.track && currentDeck.track->filePath == filePath) {
+		mHasPlayRequest = false;
+		currentDeck.volumeMultiplier = volumeMultiplier;
+		adaptVolume(currentDeck);
 		return;
 	}
 
-	mCurrentThemeFilePath = filePath;
+	mPlayRequest.filePath = filePath;
+	mPlayRequest.volumeMultiplier = volumeMultiplier;
+	mPlayRequest.crossfadeTime = crossfadeTime;
+	mHasPlayRequest = true;
 
-	const MusicData currentThemeData = mMusicDataHolder.getMusicData(filePath);
-	const std::string fullFilePath = "resources/" + filePath;
+	if(auto track = findCachedTrack(filePath))
+		startCrossfade(std::move(track));
+	else
+		prefetch(filePath);
+}
+
+void MusicPlayer::prefetch(const std::string& filePath)
+{
+	if(isLoading(filePath) || findCachedTrack(filePath))
+		return;
 
-	adaptVolume();
-	mMusic.openFromFile(fullFilePath);
-	mMusic.setLoop(currentThemeData.mLoop);
-	setMuted(mIsMuted);
-	mMusic.play();
+	// NOTE: Check that theme exists here, because exceptions from other thread would be reported too late
+	mMusicDataHolder.getMusicData(filePath);
+	mLoadingTracks.emplace_back(LoadingTrack{filePath, std::async(std::launch::async, &MusicPlayer::openTrack, filePath)});
 }
 
-void MusicPlayer::playFromMusicState(const std::string& musicStateName)
+auto MusicPlayer::openTrack(const std::string& filePath) -> std::shared_ptr<Track>
 {
-	auto[filePath, volumeMultiplier] = mMusicStateMachine.getRandomThemeFromState(musicStateName);
+	// NOTE: Music is streamed from memory, so its file can be released only after music is destroyed
+	const std::string fullFilePath = "resources/" + filePath;
+	auto track = std::make_shared<Track>();
+	track->filePath = filePath;
+	auto file = ResourceFileSystem::read(fullFilePath);
+	if(!file) {
+		PH_LOG_ERROR("unable to load music file \"" + fullFilePath + "\"");
+		return nullptr;
+	}
+	track->file = std::move(*file);
+	if(!track->music.openFromMemory(track->file.data(), track->file.size())) {
+		PH_LOG_ERROR("unable to open music file \"" + fullFilePath + "\"");
+		return nullptr;
+	}
+	return track;
+}
 
-	if(filePath == mCurrentThemeFilePath) {
-		adaptVolume(volumeMultiplier);
+void MusicPlayer::update(float dt)
+{
+	PH_PROFILE_FUNCTION();
+
+	if(!mLoadingTracks.empty())
+		finishLoadingTracks();
+
+	updateCrossfade(dt);
+}
+
+void MusicPlayer::updateCrossfade(float dt)
+{
+	if(mCrossfadeProgress >= 1.f)
 		return;
+
+	mCrossfadeProgress = mCrossfadeTime > 0.f ? std::min(mCrossfadeProgress + dt / mCrossfadeTime, 1.f) : 1.f;
+
+	// NOTE: Equal power crossfade keeps loudness constant while both themes are heard
+	constexpr float halfPi = 1.57079632f;
+	Deck& currentDeck = getCurrentDeck();
+	Deck& previousDeck = getPreviousDeck();
+	currentDeck.fade = std::sin(mCrossfadeProgress * halfPi);
+	previousDeck.fade = std::cos(mCrossfadeProgress * halfPi);
+	adaptVolume(currentDeck);
+	adaptVolume(previousDeck);
+
+	if(mCrossfadeProgress >= 1.f && previousDeck.track) {
+		previousDeck.track->music.stop();
+		previousDeck.track.reset();
 	}
+}
 
-	mCurrentThemeFilePath = filePath;
+void MusicPlayer::finishLoadingTracks()
+{
+	for(auto it = mLoadingTracks.begin(); it != mLoadingTracks.end();)
+	{
+		if(it->track.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+			++it;
+			continue;
+		}
 
-	const MusicData currentThemeData = mMusicDataHolder.getMusicData(filePath);
-	const std::string fullFilePath = "resources/" + filePath;
+		auto track = it->track.get();
+		it = mLoadingTracks.erase(it);
+		if(!track)
+			continue;
+
+		cacheTrack(track);
+		if(mHasPlayRequest && mPlayRequest.filePath == track->filePath)
+			startCrossfade(std::move(track));
+	}
+}
+
+void MusicPlayer::startCrossfade(std::shared_ptr<Track> track)
+{
+	mHasPlayRequest = false;
+	mCrossfadeTime = mPlayRequest.crossfadeTime;
+	cacheTrack(track);
+
+	Deck& nextDeck = getPreviousDeck();
+	if(nextDeck.track == track) {
+		// NOTE: Theme which is fading out fades in again from its current volume
+		mCrossfadeProgress = 1.f - mCrossfadeProgress;
+	}
+	else {
+		// NOTE: If previous crossfade is still in progress, the quieter theme is cut
+		if(nextDeck.track)
+			nextDeck.track->music.stop();
+		nextDeck.track = std::move(track);
+		nextDeck.fade = 0.f;
+		mCrossfadeProgress = 0.f;
+
+		sf::Music& music = nextDeck.track->music;
+		music.stop();
+		music.setLoop(mMusicDataHolder.getMusicData(nextDeck.track->filePath).mLoop);
+		music.setVolume(0.f);
+		if(!mIsPaused)
+			music.play();
+	}
+	mCurrentDeck = 1 - mCurrentDeck;
+	nextDeck.volumeMultiplier = mPlayRequest.volumeMultiplier;
+	adaptVolume(nextDeck);
+
+	if(mCrossfadeTime <= 0.f)
+		updateCrossfade(0.f);
+}
+
+void MusicPlayer::cacheTrack(std::shared_ptr<Track> track)
+{
+	// NOTE: Most recently used track is at the end
+	auto found = std::find(mCachedTracks.begin(), mCachedTracks.end(), track);
+	if(found != mCachedTracks.end())
+		mCachedTracks.erase(found);
+	mCachedTracks.emplace_back(std::move(track));
 
-	adaptVolume(volumeMultiplier);
-	mMusic.openFromFile(fullFilePath);
-	mMusic.setLoop(currentThemeData.mLoop);
-	setMuted(mIsMuted);
-	mMusic.play();
+	if(mCachedTracks.size() > mMaxCachedTracks) {
+		auto notPlayed = std::find_if(mCachedTracks.begin(), mCachedTracks.end(), [this](const std::shared_ptr<Track>& cachedTrack) {
+			return cachedTrack != mDecks[0].track && cachedTrack != mDecks[1].track;
+		});
+		if(notPlayed != mCachedTracks.end())
+			mCachedTracks.erase(notPlayed);
+	}
+}
+
+auto MusicPlayer::findCachedTrack(const std::string& filePath) -> std::shared_ptr<Track>
+{
+	auto found = std::find_if(mCachedTracks.begin(), mCachedTracks.end(), [&filePath](const std::shared_ptr<Track>& track) {
+		return track->filePath == filePath;
+	});
+	return found != mCachedTracks.end() ? *found : nullptr;
+}
+
+bool MusicPlayer::isCached(const std::string& filePath) const
+{
+	return std::any_of(mCachedTracks.begin(), mCachedTracks.end(), [&filePath](const std::shared_ptr<Track>& track) {
+		return track->filePath == filePath;
+	});
+}
+
+auto MusicPlayer::getCurrentTheme() const -> std::string
+{
+	const Deck& currentDeck = mDecks[mCurrentDeck];
+	return currentDeck.track ? currentDeck.track->filePath : std::string();
+}
+
+bool MusicPlayer::isLoading(const std::string& filePath) const
+{
+	return std::any_of(mLoadingTracks.begin(), mLoadingTracks.end(), [&filePath](const LoadingTrack& loadingTrack) {
+		return loadingTrack.filePath == filePath;
+	});
 }
 
 void MusicPlayer::stop()
 {
-	mMusic.stop();
+	mHasPlayRequest = false;
+	mCrossfadeProgress = 1.f;
+	for(auto& deck : mDecks) {
+		if(deck.track)
+			deck.track->music.stop();
+		deck.track.reset();
+	}
 }
 
 void MusicPlayer::setPaused(const bool pause)
 {
-	pause ? mMusic.pause() : mMusic.play();
+	mIsPaused = pause;
+	for(auto& deck : mDecks)
+		if(deck.track)
+			pause ? deck.track->music.pause() : deck.track->music.play();
 }
 
 void MusicPlayer::setMuted(const bool mute)
 {
-	mute ? mMusic.setVolume(0.f) : setVolume(mVolume);
 	mIsMuted = mute;
+	for(auto& deck : mDecks)
+		adaptVolume(deck);
 }
 
 void MusicPlayer::setVolume(const float volume)
 {
 	mVolume = volume;
-	const float volumeMultiplier = mMusicDataHolder.getCurrentThemeData().mVolumeMultiplier;
-	mMusic.setVolume(volume * volumeMultiplier);
+	for(auto& deck : mDecks)
+		adaptVolume(deck);
 }
 
-void MusicPlayer::adaptVolume(const float volumeMultiplier)
+void MusicPlayer::adaptVolume(Deck& deck)
 {
-	auto volume = mVolume * mMusicDataHolder.getMusicData(mCurrentThemeFilePath).mVolumeMultiplier * volumeMultiplier;
-	mMusic.setVolume(volume);
+	if(!deck.track)
+		return;
+	const float themeVolumeMultiplier = mMusicDataHolder.getMusicData(deck.track->filePath).mVolumeMultiplier;
+	const float volume = mIsMuted ? 0.f : mVolume * themeVolumeMultiplier * deck.volumeMultiplier * deck.fade;
+	deck.track->music.setVolume(volume);
 }
 
 }
@@ -2,19 +2,28 @@
 
 #include "musicData.hpp"
 #include "musicStateMachine.hpp"
+#include "Resources/resourceSource.hpp"
 #include <SFML/Audio.hpp>
+#include <future>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace ph {
 
+// NOTE: Music is played from two decks, so the next theme fades in while the current one fades out.
+//       Themes are opened on other thread and recently used ones are kept opened,
+//       so switching between themes of music states doesn't stall the game.
 class MusicPlayer
 {
 public:
-	MusicPlayer();
+	explicit MusicPlayer(std::size_t maxCachedTracks = 4);
 	~MusicPlayer();
 
 	void playFromFile(const std::string& filePath);
 	void playFromMusicState(const std::string& musicStateName);
+	void prefetch(const std::string& filePath);
+	void update(float dt);
 	void stop();
 
 	void setPaused(const bool pause);
@@ -24,18 +33,66 @@ public:
 	float getVolume() { return mVolume; }
 
 	auto getMusicStateMachine() -> MusicStateMachine & { return mMusicStateMachine; }
+	auto getCurrentTheme() const -> std::string;
+	bool isCached(const std::string& filePath) const;
+	float getCrossfadeProgress() const { return mCrossfadeProgress; }
 
 private:
-	void adaptVolume(const float volumeMultiplier = 1.f);
+	struct Track
+	{
+		std::string filePath;
+		ResourceData file;
+		sf::Music music;
+	};
+
+	struct Deck
+	{
+		std::shared_ptr<Track> track;
+		float volumeMultiplier = 1.f;
+		float fade = 0.f;
+	};
+
+	struct LoadingTrack
+	{
+		std::string filePath;
+		std::future<std::shared_ptr<Track>> track;
+	};
+
+	struct PlayRequest
+	{
+		std::string filePath;
+		float volumeMultiplier = 1.f;
+		float crossfadeTime = 0.f;
+	};
+
+	void play(const std::string& filePath, const float volumeMultiplier, const float crossfadeTime);
+	void startCrossfade(std::shared_ptr<Track>);
+	void updateCrossfade(float dt);
+	void finishLoadingTracks();
+	void cacheTrack(std::shared_ptr<Track>);
+	auto findCachedTrack(const std::string& filePath) -> std::shared_ptr<Track>;
+	bool isLoading(const std::string& filePath) const;
+	void adaptVolume(Deck&);
+	static auto openTrack(const std::string& filePath) -> std::shared_ptr<Track>;
+
+	auto getCurrentDeck() -> Deck& { return mDecks[mCurrentDeck]; }
+	auto getPreviousDeck() -> Deck& { return mDecks[1 - mCurrentDeck]; }
 
 private:
 	MusicDataHolder mMusicDataHolder;
 	MusicStateMachine mMusicStateMachine;
-	sf::Music mMusic;
-	std::string mCurrentThemeFilePath;
+	Deck mDecks[2];
+	std::vector<std::shared_ptr<Track>> mCachedTracks;
+	std::vector<LoadingTrack> mLoadingTracks;
+	PlayRequest mPlayRequest;
+	std::size_t mMaxCachedTracks;
+	std::size_t mCurrentDeck;
+	float mCrossfadeTime;
+	float mCrossfadeProgress;
 	float mVolume;
 	bool mIsMuted;
-	bool mIsPlayingFromMusicState;
+	bool mIsPaused;
+	bool mHasPlayRequest;
 };
 
 }
@@ -23,6 +23,13 @@ auto MusicStateMachine::getRandomThemeFromState(const std::string& stateName) co
 	}
 }
 
+float MusicStateMachine::getCrossfadeTime(const std::string& stateName) const
+{
+	auto found = mStates.find(stateName);
+	PH_ASSERT_CRITICAL(found != mStates.end(), "Music state \"" + stateName + "\" does not exist!");
+	return found->second.crossfadeTime;
+}
+
 void MusicStateMachine::clearStates() noexcept
 {
 	mStates.clear();
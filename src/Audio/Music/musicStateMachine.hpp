@@ -10,6 +10,7 @@ struct MusicState
 {
 	std::vector<std::string> filepaths;
 	std::vector<float> volumeMultipliers;
+	float crossfadeTime = 1.5f;
 };
 
 class MusicStateMachine
@@ -17,6 +18,7 @@ class MusicStateMachine
 public:
 	void addState(std::string stateName, MusicState& states);
 	auto getRandomThemeFromState(const std::string& stateName) const -> std::pair<std::string, float>;
+	float getCrossfadeTime(const std::string& stateName) const;
 	void clearStates() noexcept;
 
 private:
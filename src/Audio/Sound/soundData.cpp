@@ -4,11 +4,12 @@
 namespace ph {
 
 SoundData::SoundData(const float volumeMultiplier, const bool loop,
-					const float maximalFullVolumeDistance, const float maximalHearableDistance)
+					const float maximalFullVolumeDistance, const float maximalHearableDistance, const unsigned priority)
 	:mVolumeMultiplier(volumeMultiplier)
 	,mLoop(loop)
 	,mMaximalFullVolumeDistance(maximalFullVolumeDistance)
 	,mMaximalHearableDistance(maximalHearableDistance)
+	,mPriority(priority)
 {
 }
 
@@ -25,11 +26,12 @@ SoundDataHolder::SoundDataHolder()
 		const bool loop = soundNode.getAttribute("loop").toBool();
 		const float maximalFullVolumeDistance = soundNode.getAttribute("maximalFullVolumeDistance").toFloat();
 		const float maximalHearableDistance = soundNode.getAttribute("maximalHearableDistance").toFloat();
-		mAllSoundsData[filePath] = SoundData(volumeMultiplier, loop, maximalFullVolumeDistance, maximalHearableDistance);
+		const unsigned priority = soundNode.hasAttribute("priority") ? soundNode.getAttribute("priority").toUnsigned() : 0;
+		mAllSoundsData[filePath] = SoundData(volumeMultiplier, loop, maximalFullVolumeDistance, maximalHearableDistance, priority);
 	}
 }
 
-auto SoundDataHolder::getSoundData(const std::string& filePath) -> SoundData
+auto SoundDataHolder::getSoundData(const std::string& filePath) -> const SoundData&
 {
 	const auto found = mAllSoundsData.find(filePath);
 	return found->second;
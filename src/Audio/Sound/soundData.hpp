@@ -10,10 +10,11 @@ struct SoundData
 	float mVolumeMultiplier;
 	float mMaximalFullVolumeDistance;
 	float mMaximalHearableDistance;	
+	unsigned mPriority;
 	bool mLoop;
 
 	SoundData(const float volumeMultiplier = 1.f, const bool loop = false,
-			const float maximalFullVolumeDistance = 0.f, const float maximalHearableDistance = 1000.f);
+			const float maximalFullVolumeDistance = 0.f, const float maximalHearableDistance = 1000.f, const unsigned priority = 0);
 };
 
 class SoundDataHolder
@@ -21,7 +22,7 @@ class SoundDataHolder
 public:
 	SoundDataHolder();
 
-	auto getSoundData(const std::string& filePath)->SoundData;
+	auto getSoundData(const std::string& filePath) -> const SoundData&;
 
 private:
 	std::map<std::string, SoundData> mAllSoundsData;
@@ -1,64 +1,192 @@
 #include "soundPlayer.hpp"
 #include "Logs/logs.hpp"
+#include "Utilities/profiling.hpp"
+#include <algorithm>
+#include <cmath>
 
 namespace ph {
 
 SoundPlayer::SoundPlayer()
 	:mVolume(14.f)
 {
+	mSoundBuffers.setMemoryBudget(32 * 1024 * 1024);
+	mPlayRequests.reserve(maxVoices);
 	setMuted(false);
 	loadEverySound();
 }
 
 void SoundPlayer::loadEverySound()
 {
-	mSoundBuffers.load("sounds/swordAttack.wav");
-	mSoundBuffers.load("sounds/carTireScreech.ogg");
-	mSoundBuffers.load("sounds/zombieGrowl1.ogg");
-	mSoundBuffers.load("sounds/zombieGrowl2.ogg");
-	mSoundBuffers.load("sounds/zombieGrowl3.ogg");
-	mSoundBuffers.load("sounds/zombieGrowl4.ogg");
-	mSoundBuffers.load("sounds/reloadPistol.ogg");
-	mSoundBuffers.load("sounds/pistolShot.ogg");
-	mSoundBuffers.load("sounds/reloadShotgun.ogg");
-	mSoundBuffers.load("sounds/shotgunShot.ogg");
+	// NOTE: Buffers aren't referenced here, so they can be evicted when they aren't played
+	mSoundBuffers.acquire("sounds/swordAttack.wav");
+	mSoundBuffers.acquire("sounds/carTireScreech.ogg");
+	mSoundBuffers.acquire("sounds/zombieGrowl1.ogg");
+	mSoundBuffers.acquire("sounds/zombieGrowl2.ogg");
+	mSoundBuffers.acquire("sounds/zombieGrowl3.ogg");
+	mSoundBuffers.acquire("sounds/zombieGrowl4.ogg");
+	mSoundBuffers.acquire("sounds/reloadPistol.ogg");
+	mSoundBuffers.acquire("sounds/pistolShot.ogg");
+	mSoundBuffers.acquire("sounds/reloadShotgun.ogg");
+	mSoundBuffers.acquire("sounds/shotgunShot.ogg");
 }
 
 void SoundPlayer::playAmbientSound(const std::string& filePath)
 {
-	removeStoppedSounds();
 	if (mSceneMute)
 		return;
 
-	SoundData soundData = mSoundDataHolder.getSoundData(filePath);
-	playSound(filePath, mVolume * soundData.mVolumeMultiplier, soundData.mLoop);
+	const SoundData& soundData = mSoundDataHolder.getSoundData(filePath);
+	requestSound(filePath, soundData, mVolume * soundData.mVolumeMultiplier, {}, noEmitter, false);
 }
 
-void SoundPlayer::playSpatialSound(const std::string& filePath, const sf::Vector2f soundPosition)
+void SoundPlayer::playSpatialSound(const std::string& filePath, const sf::Vector2f soundPosition, const std::uint32_t emitter)
 {
-	removeStoppedSounds();
 	if (mSceneMute)
 		return;
 
-	SoundData soundData = mSoundDataHolder.getSoundData(filePath);
+	const SoundData& soundData = mSoundDataHolder.getSoundData(filePath);
 	const float spatialVolume = mSpatializationManager.getSpatialVolume(soundData, soundPosition, mVolume);
-	playSound(filePath, spatialVolume, soundData.mLoop);
+	requestSound(filePath, soundData, spatialVolume, soundPosition, emitter, true);
 }
 
-void SoundPlayer::playSound(const std::string& filePath, const float volume, const bool loop)
+void SoundPlayer::requestSound(const std::string& filePath, const SoundData& soundData, const float volume,
+                               const sf::Vector2f position, const std::uint32_t emitter, const bool isSpatial)
 {
-	sf::Sound sound;
-	sound.setBuffer(mSoundBuffers.get(filePath));
-	sound.setVolume(volume);
-	sound.setLoop(loop);
-	mSounds.emplace_back(std::move(sound));
-	mSounds.back().play();
+	// NOTE: Sounds which can't be heard don't take voices
+	if(volume <= 0.f)
+		return;
+
+	SoundBufferRef buffer = mSoundBuffers.acquire(filePath);
+	if(!buffer)
+		return;
+
+	// NOTE: The same sound requested many times in one frame is played once, from the loudest request
+	auto sameSound = std::find_if(mPlayRequests.begin(), mPlayRequests.end(), [&buffer](const PlayRequest& request) {
+		return request.buffer.getHandle() == buffer.getHandle();
+	});
+	if(sameSound != mPlayRequests.end()) {
+		if(volume > sameSound->volume) {
+			sameSound->volume = volume;
+			sameSound->position = position;
+			sameSound->emitter = emitter;
+			sameSound->isSpatial = isSpatial;
+		}
+		return;
+	}
+
+	mPlayRequests.emplace_back(PlayRequest{std::move(buffer), &soundData, volume, position, emitter, isSpatial});
+}
+
+void SoundPlayer::update()
+{
+	PH_PROFILE_FUNCTION();
+
+	if(!mPlayRequests.empty())
+	{
+		std::sort(mPlayRequests.begin(), mPlayRequests.end(), [](const PlayRequest& lhs, const PlayRequest& rhs) {
+			const unsigned lhsPriority = lhs.soundData->mPriority;
+			const unsigned rhsPriority = rhs.soundData->mPriority;
+			return lhsPriority != rhsPriority ? lhsPriority > rhsPriority : lhs.volume > rhs.volume;
+		});
+
+		for(auto& request : mPlayRequests)
+			playSound(request);
+		mPlayRequests.clear();
+	}
+
+	mixSpatialSounds();
+}
+
+void SoundPlayer::playSound(PlayRequest& request)
+{
+	Voice* voice = acquireVoice(request);
+	if(!voice)
+		return;
+
+	const auto voiceIndex = static_cast<std::size_t>(voice - mVoices.data());
+	const SoundData& soundData = *request.soundData;
+
+	voice->sound.stop();
+	voice->sound.setBuffer(*request.buffer);
+	voice->sound.setVolume(request.volume);
+	voice->sound.setLoop(soundData.mLoop);
+	// NOTE: Attenuation and panning of spatial sounds are computed by mixSpatialSounds(), not by OpenAL
+	voice->sound.setRelativeToListener(true);
+	voice->sound.setAttenuation(0.f);
+	voice->sound.setPosition(0.f, 0.f, 0.f);
+	voice->sound.play();
+	voice->buffer = std::move(request.buffer);
+	voice->volume = request.volume;
+	voice->volumeMultiplier = soundData.mVolumeMultiplier;
+	voice->priority = soundData.mPriority;
+
+	if(request.isSpatial) {
+		voice->emitter = request.emitter;
+		mSpatializationManager.setSource(voiceIndex, soundData, request.position);
+	}
+	else {
+		voice->emitter = noEmitter;
+		mSpatializationManager.removeSource(voiceIndex);
+	}
+}
+
+auto SoundPlayer::acquireVoice(const PlayRequest& request) -> Voice*
+{
+	Voice* leastImportantVoice = nullptr;
+	for(auto& voice : mVoices)
+	{
+		if(voice.sound.getStatus() == sf::Sound::Status::Stopped)
+			return &voice;
+
+		if(!leastImportantVoice || voice.priority < leastImportantVoice->priority ||
+		   (voice.priority == leastImportantVoice->priority && voice.volume < leastImportantVoice->volume))
+			leastImportantVoice = &voice;
+	}
+
+	const unsigned priority = request.soundData->mPriority;
+	const bool isRequestMoreImportant = priority != leastImportantVoice->priority ?
+		priority > leastImportantVoice->priority : request.volume > leastImportantVoice->volume;
+	return isRequestMoreImportant ? leastImportantVoice : nullptr;
+}
+
+void SoundPlayer::mixSpatialSounds()
+{
+	for(std::size_t i = 0; i < maxVoices; ++i)
+	{
+		if(mSpatializationManager.isSource(i) && mVoices[i].sound.getStatus() == sf::Sound::Status::Stopped) {
+			mSpatializationManager.removeSource(i);
+			mVoices[i].emitter = noEmitter;
+		}
+	}
+
+	mSpatializationManager.update(mVolume);
+
+	for(std::size_t i = 0; i < maxVoices; ++i)
+	{
+		if(!mSpatializationManager.isSource(i))
+			continue;
+
+		// NOTE: Pan moves source on a unit circle around listener, so it keeps its loudness
+		Voice& voice = mVoices[i];
+		const float pan = mSpatializationManager.getPan(i);
+		voice.volume = mSpatializationManager.getVolume(i);
+		voice.sound.setVolume(voice.volume);
+		voice.sound.setPosition(pan, 0.f, -std::sqrt(1.f - pan * pan));
+	}
+}
+
+std::size_t SoundPlayer::getNumberOfPlayingSounds() const
+{
+	return std::count_if(mVoices.begin(), mVoices.end(), [](const Voice& voice) {
+		return voice.sound.getStatus() != sf::Sound::Status::Stopped;
+	});
 }
 
-void SoundPlayer::removeStoppedSounds()
+std::size_t SoundPlayer::getNumberOfPlayingSounds(const std::string& filePath) const
 {
-	mSounds.remove_if([](const sf::Sound& sound) {
-		return sound.getStatus() == sf::Sound::Status::Stopped;
+	const auto buffer = mSoundBuffers.getHandle(filePath);
+	return std::count_if(mVoices.begin(), mVoices.end(), [buffer](const Voice& voice) {
+		return voice.buffer.getHandle() == buffer && voice.sound.getStatus() != sf::Sound::Status::Stopped;
 	});
 }
 
@@ -82,13 +210,23 @@ void SoundPlayer::setMuted(const bool mute)
 void SoundPlayer::setVolume(const float volume)
 {
 	mVolume = volume;
-	for(auto& sound : mSounds)
-		sound.setVolume(volume);
+	// NOTE: Volumes of spatial sounds are updated by mixSpatialSounds()
+	for(std::size_t i = 0; i < maxVoices; ++i)
+		if(!mSpatializationManager.isSource(i))
+			mVoices[i].sound.setVolume(volume * mVoices[i].volumeMultiplier);
 }
 
 void SoundPlayer::removeEverySound()
 {
-	mSounds.clear();
+	mPlayRequests.clear();
+	for(auto& voice : mVoices) {
+		voice.sound.stop();
+		voice.sound.resetBuffer();
+		voice.buffer.reset();
+		voice.emitter = noEmitter;
+	}
+	for(std::size_t i = 0; i < maxVoices; ++i)
+		mSpatializationManager.removeSource(i);
 }
 
 }
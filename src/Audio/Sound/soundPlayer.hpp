@@ -4,17 +4,32 @@
 #include "Audio/Sound/soundData.hpp"
 #include "Audio/Sound/spatializationManager.hpp"
 #include <SFML/Audio.hpp>
-#include <list>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
 
 namespace ph {
 
+// NOTE: Sounds are played from fixed number of voices, because OpenAL has limited number of sources.
+//       Requests are gathered during frame and played in update() in order of priority and loudness.
+//       If every voice is busy, voice playing the least important sound is stolen or request is dropped.
+//       Spatial sounds are remixed every frame, sounds of emitters follow them until they stop.
 class SoundPlayer
 {
 public:
+	static constexpr std::size_t maxVoices = SpatializationManager::maxSources;
+	static constexpr std::uint32_t noEmitter = std::numeric_limits<std::uint32_t>::max();
+
 	SoundPlayer();
 
 	void playAmbientSound(const std::string& filePath);
-	void playSpatialSound(const std::string& filePath, const sf::Vector2f soundPosition);
+	void playSpatialSound(const std::string& filePath, const sf::Vector2f soundPosition, const std::uint32_t emitter = noEmitter);
+	void update();
+
+	// NOTE: getEmitterPosition(emitter, position) returns false if emitter doesn't exist anymore
+	template<typename GetEmitterPosition>
+	void updateEmitterPositions(GetEmitterPosition getEmitterPosition);
 
 	void setListenerPosition(const sf::Vector2f listenerPosition);
 	void setMuted(const bool muted);
@@ -24,14 +39,41 @@ public:
 	float getVolume() { return mVolume; }
 	void removeEverySound();
 
+	std::size_t getNumberOfPlayingSounds() const;
+	std::size_t getNumberOfPlayingSounds(const std::string& filePath) const;
+
 private:
-	void playSound(const std::string& filePath, const float volume, const bool loop);
+	struct PlayRequest
+	{
+		SoundBufferRef buffer;
+		const SoundData* soundData;
+		float volume;
+		sf::Vector2f position;
+		std::uint32_t emitter;
+		bool isSpatial;
+	};
+
+	struct Voice
+	{
+		SoundBufferRef buffer;
+		sf::Sound sound;
+		float volume = 0.f;
+		float volumeMultiplier = 1.f;
+		unsigned priority = 0;
+		std::uint32_t emitter = noEmitter;
+	};
+
+	void requestSound(const std::string& filePath, const SoundData& soundData, const float volume,
+	                  const sf::Vector2f position, const std::uint32_t emitter, const bool isSpatial);
+	void playSound(PlayRequest&);
+	auto acquireVoice(const PlayRequest&) -> Voice*;
+	void mixSpatialSounds();
 	void loadEverySound();
-	void removeStoppedSounds();
 
 private:
-	std::list<sf::Sound> mSounds;
 	SoundBufferHolder mSoundBuffers;
+	std::array<Voice, maxVoices> mVoices;
+	std::vector<PlayRequest> mPlayRequests;
 	SoundDataHolder mSoundDataHolder;
 	SpatializationManager mSpatializationManager;
 	float mVolume;
@@ -40,3 +82,5 @@ private:
 };
 
 }
+
+#include "soundPlayer.inl"
@@ -0,0 +1,20 @@
+namespace ph {
+
+template<typename GetEmitterPosition>
+void SoundPlayer::updateEmitterPositions(GetEmitterPosition getEmitterPosition)
+{
+	for(std::size_t i = 0; i < maxVoices; ++i)
+	{
+		std::uint32_t& emitter = mVoices[i].emitter;
+		if(emitter == noEmitter)
+			continue;
+
+		sf::Vector2f position;
+		if(getEmitterPosition(emitter, position))
+			mSpatializationManager.setSourcePosition(i, position);
+		else
+			emitter = noEmitter;
+	}
+}
+
+}
@@ -1,66 +1,85 @@
 #include "SpatializationManager.hpp"
+#include <algorithm>
+#include <cmath>
 
 namespace ph {
 
-void SpatializationManager::setListenerPosition(const sf::Vector2f listenerPosition)
+SpatializationManager::SpatializationManager()
 {
-	mListenerPosition = listenerPosition;
+	mPositionsX.fill(0.f);
+	mPositionsY.fill(0.f);
+	mVolumeMultipliers.fill(0.f);
+	mFullVolumeDistances.fill(0.f);
+	mHearableDistances.fill(1.f);
+	mVolumes.fill(0.f);
+	mPans.fill(0.f);
+	mIsSource.fill(false);
 }
 
-float SpatializationManager::getSpatialVolume(const SoundData soundData, const sf::Vector2f soundPosition, const float volume)
+void SpatializationManager::setListenerPosition(const sf::Vector2f listenerPosition)
 {
-	init(soundData, soundPosition, volume);
-
-	if(isListenerOutOfHearableArea())
-		return 0.f;
-	else if(isListenerVeryCloseToSoundSource())
-		return getMaximalVolume();
-	else
-		return getVolumeForListenerInDistanceScope();
+	mListenerPosition = listenerPosition;
 }
 
-void SpatializationManager::init(const SoundData soundData, const sf::Vector2f soundPosition, const float volume)
+float SpatializationManager::getSpatialVolume(const SoundData& soundData, const sf::Vector2f soundPosition, const float volume) const
 {
-	mSoundData = soundData;
-	mSoundPosition = soundPosition;
-	mVolume = volume;
-	mDistanceBetweenListenerAndSoundSource = getDistanceBetweenListenerAndSoundSource();
+	const float distance = std::hypot(soundPosition.x - mListenerPosition.x, soundPosition.y - mListenerPosition.y);
+	return computeVolume(distance, soundData.mVolumeMultiplier, soundData.mMaximalFullVolumeDistance,
+	                     soundData.mMaximalHearableDistance, volume);
 }
 
-float SpatializationManager::getDistanceBetweenListenerAndSoundSource()
+float SpatializationManager::computeVolume(const float distance, const float volumeMultiplier, const float fullVolumeDistance,
+                                           const float hearableDistance, const float volume)
 {
-	float legX = abs(mListenerPosition.x - mSoundPosition.x);
-	float legY = abs(mListenerPosition.y - mSoundPosition.y);
-	return hypotf(legX, legY);
-}
+	if(distance > hearableDistance)
+		return 0.f;
 
-bool SpatializationManager::isListenerOutOfHearableArea()
-{
-	return mDistanceBetweenListenerAndSoundSource > mSoundData.mMaximalHearableDistance;
+	const float maximalVolume = volume * volumeMultiplier;
+	if(distance < fullVolumeDistance)
+		return maximalVolume;
+
+	const float scope = hearableDistance - fullVolumeDistance;
+	return maximalVolume * (hearableDistance - distance) / scope;
 }
 
-bool SpatializationManager::isListenerVeryCloseToSoundSource()
+void SpatializationManager::setSource(const std::size_t index, const SoundData& soundData, const sf::Vector2f soundPosition)
 {
-	return mDistanceBetweenListenerAndSoundSource < mSoundData.mMaximalFullVolumeDistance;
+	mPositionsX[index] = soundPosition.x;
+	mPositionsY[index] = soundPosition.y;
+	mVolumeMultipliers[index] = soundData.mVolumeMultiplier;
+	mFullVolumeDistances[index] = soundData.mMaximalFullVolumeDistance;
+	mHearableDistances[index] = soundData.mMaximalHearableDistance;
+	mIsSource[index] = true;
 }
 
-float SpatializationManager::getMaximalVolume()
+void SpatializationManager::setSourcePosition(const std::size_t index, const sf::Vector2f soundPosition)
 {
-	return mVolume * mSoundData.mVolumeMultiplier;
+	mPositionsX[index] = soundPosition.x;
+	mPositionsY[index] = soundPosition.y;
 }
 
-float SpatializationManager::getVolumeForListenerInDistanceScope()
+void SpatializationManager::removeSource(const std::size_t index)
 {
-	return getMaximalVolume() * getSpatializationFactor();
+	// NOTE: Removed source is still computed in update(), it's just always silent
+	mVolumeMultipliers[index] = 0.f;
+	mIsSource[index] = false;
 }
 
-float SpatializationManager::getSpatializationFactor()
+void SpatializationManager::update(const float volume)
 {
-	float scope = mSoundData.mMaximalHearableDistance - mSoundData.mMaximalFullVolumeDistance;
-	float distanceBetweenListenerAndMaximalVolumeArea = mDistanceBetweenListenerAndSoundSource - mSoundData.mMaximalFullVolumeDistance;
-	float distanceBetweenListenerAndHearableAreaBound = scope - distanceBetweenListenerAndMaximalVolumeArea;
-	float spatializationFactor = distanceBetweenListenerAndHearableAreaBound / scope;
-	return spatializationFactor;
+	// NOTE: Written without branches over plain arrays, so compiler can vectorize it
+	const float listenerX = mListenerPosition.x;
+	const float listenerY = mListenerPosition.y;
+	for(std::size_t i = 0; i < maxSources; ++i)
+	{
+		const float dx = mPositionsX[i] - listenerX;
+		const float dy = mPositionsY[i] - listenerY;
+		const float distance = std::sqrt(dx * dx + dy * dy);
+		const float scope = std::max(mHearableDistances[i] - mFullVolumeDistances[i], 0.001f);
+		const float attenuation = std::clamp((mHearableDistances[i] - distance) / scope, 0.f, 1.f);
+		mVolumes[i] = volume * mVolumeMultipliers[i] * attenuation;
+		mPans[i] = std::clamp(dx / std::max(mHearableDistances[i], 0.001f), -1.f, 1.f);
+	}
 }
 
 }
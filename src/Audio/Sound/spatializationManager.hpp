@@ -2,29 +2,47 @@
 
 #include <SFML/Graphics.hpp>
 #include "Audio/Sound/soundData.hpp"
+#include <array>
+#include <cstdint>
 
 namespace ph {
 
+// NOTE: Keeps spatial sources in structure of arrays, so their volumes and pans
+//       are recomputed for the current listener position in one pass every frame
 class SpatializationManager
 {
 public:
+	static constexpr std::size_t maxSources = 32;
+
+	SpatializationManager();
+
 	void setListenerPosition(const sf::Vector2f listenerPosition);
-	float getSpatialVolume(const SoundData, const sf::Vector2f soundPosition, const float volume);
+	float getSpatialVolume(const SoundData&, const sf::Vector2f soundPosition, const float volume) const;
+
+	void setSource(const std::size_t index, const SoundData&, const sf::Vector2f soundPosition);
+	void setSourcePosition(const std::size_t index, const sf::Vector2f soundPosition);
+	void removeSource(const std::size_t index);
+	bool isSource(const std::size_t index) const { return mIsSource[index]; }
+
+	void update(const float volume);
+	float getVolume(const std::size_t index) const { return mVolumes[index]; }
+	float getPan(const std::size_t index) const { return mPans[index]; }
+
 private:
-	void init(const SoundData, const sf::Vector2f soundPosition, const float volume);
-	float getDistanceBetweenListenerAndSoundSource();
-	bool isListenerOutOfHearableArea();
-	bool isListenerVeryCloseToSoundSource();
-	float getMaximalVolume();
-	float getVolumeForListenerInDistanceScope();
-	float getSpatializationFactor();
+	static float computeVolume(const float distance, const float volumeMultiplier, const float fullVolumeDistance,
+	                           const float hearableDistance, const float volume);
 
 private:
-	SoundData mSoundData;
 	sf::Vector2f mListenerPosition;
-	sf::Vector2f mSoundPosition;
-	float mVolume;
-	float mDistanceBetweenListenerAndSoundSource;
+
+	std::array<float, maxSources> mPositionsX;
+	std::array<float, maxSources> mPositionsY;
+	std::array<float, maxSources> mVolumeMultipliers;
+	std::array<float, maxSources> mFullVolumeDistances;
+	std::array<float, maxSources> mHearableDistances;
+	std::array<float, maxSources> mVolumes;
+	std::array<float, maxSources> mPans;
+	std::array<bool, maxSources> mIsSource;
 };
 
 }
@@ -61,8 +61,15 @@ void XmlAudioParser::parseMusicStates(const Xml& audioNode)
 			musicState.volumeMultipliers.emplace_back(volumeMultiplier);
 		}
 
+		if(musicStateNode.hasAttribute("crossfadeTime"))
+			musicState.crossfadeTime = musicStateNode.getAttribute("crossfadeTime").toFloat();
+
 		const std::string musicStateName = musicStateNode.getAttribute("name").toString();
 		musicStateMachine.addState(musicStateName, musicState);
+
+		// NOTE: Themes are opened before states are switched for the first time
+		for(const auto& themeFilePath : musicState.filepaths)
+			mMusicPlayer->prefetch(themeFilePath);
 	}
 }
 
@@ -0,0 +1,181 @@
+#include "benchmark.hpp"
+#include "ECS/entitiesTemplateStorage.hpp"
+#include "ECS/Components/charactersComponents.hpp"
+#include "ECS/Components/physicsComponents.hpp"
+#include "Utilities/random.hpp"
+#include "Logs/logs.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#ifdef __GNUG__
+	#include <cxxabi.h>
+#endif
+
+namespace ph {
+
+namespace {
+
+unsigned parseUnsigned(const char* argument, const char* option)
+{
+	char* end;
+	const unsigned long value = std::strtoul(argument, &end, 10);
+	if(*end != '\0')
+		PH_EXIT_GAME(std::string("Benchmark option ") + option + " expects a number, but got: " + argument);
+	return static_cast<unsigned>(value);
+}
+
+std::string getReadableSystemName(const std::string& typeName)
+{
+#ifdef __GNUG__
+	int status;
+	char* demangled = abi::__cxa_demangle(typeName.c_str(), nullptr, nullptr, &status);
+	std::string name = status == 0 ? demangled : typeName;
+	std::free(demangled);
+#else
+	std::string name = typeName;
+#endif
+	const auto namespaceEnd = name.rfind("::");
+	return namespaceEnd == std::string::npos ? name : name.substr(namespaceEnd + 2);
+}
+
+std::string escapeJsonString(const std::string& string)
+{
+	std::string escaped;
+	escaped.reserve(string.size());
+	for(char c : string) {
+		if(static_cast<unsigned char>(c) < 0x20) {
+			char controlCharacter[8];
+			std::snprintf(controlCharacter, sizeof(controlCharacter), "\\u%04x", c);
+			escaped += controlCharacter;
+			continue;
+		}
+		if(c == '"' || c == '\\')
+			escaped += '\\';
+		escaped += c;
+	}
+	return escaped;
+}
+
+double toMilliseconds(std::chrono::nanoseconds duration)
+{
+	return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+void writeTiming(std::ofstream& out, const char* name, const SystemTiming& timing)
+{
+	const double average = timing.calls ? toMilliseconds(timing.total) / timing.calls : 0.0;
+	out << "\"" << name << "\":{";
+	out << "\"totalMs\":" << toMilliseconds(timing.total) << ",";
+	out << "\"averageMs\":" << average << ",";
+	out << "\"maxMs\":" << toMilliseconds(timing.max) << ",";
+	out << "\"calls\":" << timing.calls;
+	out << "}";
+}
+
+}
+
+std::optional<BenchmarkSettings> parseBenchmarkSettings(int argc, char** argv)
+{
+	if(argc < 2 || std::strcmp(argv[1], "--benchmark") != 0)
+		return std::nullopt;
+	if(argc < 3)
+		PH_EXIT_GAME("Benchmark needs a scene file, for example: --benchmark scenes/arcadeTheBunker.xml");
+
+	BenchmarkSettings settings;
+	settings.scenePath = argv[2];
+	for(int i = 3; i < argc; i += 2)
+	{
+		const char* option = argv[i];
+		if(i + 1 == argc)
+			PH_EXIT_GAME(std::string("Benchmark option ") + option + " has no value");
+		const char* value = argv[i + 1];
+
+		if(std::strcmp(option, "--frames") == 0)
+			settings.frames = parseUnsigned(value, option);
+		else if(std::strcmp(option, "--seed") == 0)
+			settings.seed = parseUnsigned(value, option);
+		else if(std::strcmp(option, "--zombies") == 0)
+			settings.zombies = parseUnsigned(value, option);
+		else if(std::strcmp(option, "--output") == 0)
+			settings.resultsPath = value;
+		else
+			PH_EXIT_GAME(std::string("Unknown benchmark option: ") + option);
+	}
+	return settings;
+}
+
+void spawnBenchmarkZombies(entt::registry& registry, EntitiesTemplateStorage& templateStorage, unsigned count, float spawnRadius)
+{
+	if(count == 0)
+		return;
+
+	sf::Vector2f center;
+	auto players = registry.view<component::Player, component::BodyRect>();
+	for(auto player : players)
+		center = players.get<component::BodyRect>(player).rect.getCenter();
+
+	const sf::Vector2f spread(spawnRadius, spawnRadius);
+	templateStorage.spawn(templateStorage.getPrefab("Zombie"), count, registry, [&](entt::entity zombie, std::size_t)
+	{
+		auto& body = registry.get<component::BodyRect>(zombie);
+		const sf::Vector2f position = Random::generateVector(center - spread, center + spread);
+		body.rect.left = position.x;
+		body.rect.top = position.y;
+	});
+}
+
+void writeBenchmarkResults(const BenchmarkSettings& settings, float simulationStep, FrameTimings frameTimings, std::vector<SystemTimings> systemsTimings)
+{
+	std::ofstream out(settings.resultsPath);
+	if(!out.is_open()) {
+		PH_LOG_ERROR("Benchmark results couldn't be written to " + settings.resultsPath);
+		return;
+	}
+
+	systemsTimings.emplace_back(frameTimings.aiManager);
+	systemsTimings.emplace_back(frameTimings.renderer);
+
+	auto& frameTimes = frameTimings.frameTimes;
+	std::sort(frameTimes.begin(), frameTimes.end());
+	auto percentile = [&frameTimes](double p) {
+		if(frameTimes.empty())
+			return 0.0;
+		return toMilliseconds(frameTimes[static_cast<std::size_t>(p * (frameTimes.size() - 1))]);
+	};
+	const auto totalTime = std::accumulate(frameTimes.begin(), frameTimes.end(), std::chrono::nanoseconds::zero());
+
+	out << "{";
+	out << "\"scene\":\"" << escapeJsonString(settings.scenePath) << "\",";
+	out << "\"seed\":" << settings.seed << ",";
+	out << "\"frames\":" << frameTimes.size() << ",";
+	out << "\"zombies\":" << settings.zombies << ",";
+	out << "\"simulationStep\":" << simulationStep << ",";
+	out << "\"frameTime\":{";
+	out << "\"totalMs\":" << toMilliseconds(totalTime) << ",";
+	out << "\"averageMs\":" << (frameTimes.empty() ? 0.0 : toMilliseconds(totalTime) / frameTimes.size()) << ",";
+	out << "\"medianMs\":" << percentile(0.5) << ",";
+	out << "\"p95Ms\":" << percentile(0.95) << ",";
+	out << "\"p99Ms\":" << percentile(0.99) << ",";
+	out << "\"maxMs\":" << percentile(1.0);
+	out << "},";
+	out << "\"systems\":[";
+	for(std::size_t i = 0; i < systemsTimings.size(); ++i)
+	{
+		const auto& timings = systemsTimings[i];
+		if(i > 0)
+			out << ",";
+		out << "{\"name\":\"" << escapeJsonString(getReadableSystemName(timings.name)) << "\",";
+		writeTiming(out, "update", timings.update);
+		out << ",";
+		writeTiming(out, "render", timings.render);
+		out << "}";
+	}
+	out << "]}";
+
+	PH_LOG_INFO("Benchmark results were written to " + settings.resultsPath);
+}
+
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "ECS/systemsQueue.hpp"
+#include <entt/entt.hpp>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ph {
+
+class EntitiesTemplateStorage;
+
+struct BenchmarkSettings
+{
+	std::string scenePath;
+	std::string resultsPath = "benchmarkResults.json";
+	unsigned frames = 600;
+	unsigned seed = 0;
+	unsigned zombies = 0;
+	float zombiesSpawnRadius = 400.f;
+};
+
+/// Benchmark loads a scene in hidden window, steps it given number of fixed frames
+/// and writes timings of every system to JSON file.
+/// Usage: PopHead --benchmark <scene> [--frames N] [--seed N] [--zombies N] [--output file.json]
+
+// NOTE: AIManager and flushing renderer aren't systems, but they're part of every frame so they're measured too
+struct FrameTimings
+{
+	std::vector<std::chrono::nanoseconds> frameTimes;
+	SystemTimings aiManager{"AIManager", {}, {}};
+	SystemTimings renderer{"Renderer", {}, {}};
+};
+
+std::optional<BenchmarkSettings> parseBenchmarkSettings(int argc, char** argv);
+
+// NOTE: Zombies are spawned around player, or around the origin of the map if there is no player on the scene
+void spawnBenchmarkZombies(entt::registry&, EntitiesTemplateStorage&, unsigned count, float spawnRadius);
+
+void writeBenchmarkResults(const BenchmarkSettings&, float simulationStep, FrameTimings, std::vector<SystemTimings> systemsTimings);
+
+}
@@ -1,17 +1,20 @@
 #include "debugCounter.hpp"
 #include "Renderer/renderer.hpp"
+#include "ECS/entitiesTemplateStorage.hpp"
 
 namespace ph {
 
 DebugCounter::DebugCounter()
 	:mFPSCounter()
 	,mRendererDebug()
+	,mEntityPoolsDebug()
 	,mFont()
 	,mClock()
 	,mFPS(0)
 	,mFramesFromLastSecond(0)
 	,mIsFPSCounterActive(false)
 	,mIsRendererDebugActive(false)
+	,mIsEntityPoolsDebugActive(false)
 {
 }
 
@@ -46,6 +49,17 @@ void DebugCounter::handleEvent(const ph::Event& phEvent)
 			else
 				mRendererDebug.reset();
 		}
+		else if(e->type == sf::Event::KeyPressed && e->key.code == sf::Keyboard::F4)
+		{
+			mIsEntityPoolsDebugActive = !mIsEntityPoolsDebugActive;
+			if(mIsEntityPoolsDebugActive)
+			{
+				mEntityPoolsDebug.reset(new EntityPoolsDebug);
+				initEntityPoolsDebug();
+			}
+			else
+				mEntityPoolsDebug.reset();
+		}
 	}
 }
 
@@ -64,7 +78,7 @@ void DebugCounter::initRendererDebug()
 {
 	mRendererDebug->rendererDebugBackground.setFillColor(sf::Color(0, 0, 0, 230));
 	mRendererDebug->rendererDebugBackground.setPosition(0, -185);
-	mRendererDebug->rendererDebugBackground.setSize({260, 101});
+	mRendererDebug->rendererDebugBackground.setSize({260, 121});
 
 	mRendererDebug->allDrawCallsText.setFont(*mFont);
 	mRendererDebug->allDrawCallsText.setPosition(0, -185);
@@ -105,6 +119,33 @@ void DebugCounter::initRendererDebug()
 	mRendererDebug->drawnPointsText.setFont(*mFont);
 	mRendererDebug->drawnPointsText.setPosition(0, -95);
 	mRendererDebug->drawnPointsText.setCharacterSize(10);
+
+	mRendererDebug->guiDrawCallsText.setFont(*mFont);
+	mRendererDebug->guiDrawCallsText.setPosition(0, -85);
+	mRendererDebug->guiDrawCallsText.setCharacterSize(10);
+
+	mRendererDebug->drawnGuiQuadsText.setFont(*mFont);
+	mRendererDebug->drawnGuiQuadsText.setPosition(0, -75);
+	mRendererDebug->drawnGuiQuadsText.setCharacterSize(10);
+}
+
+void DebugCounter::initEntityPoolsDebug()
+{
+	mEntityPoolsDebug->entityPoolsDebugBackground.setFillColor(sf::Color(0, 0, 0, 230));
+	mEntityPoolsDebug->entityPoolsDebugBackground.setPosition(0, -60);
+	mEntityPoolsDebug->entityPoolsDebugBackground.setSize({260, 31});
+
+	mEntityPoolsDebug->createdEntitiesText.setFont(*mFont);
+	mEntityPoolsDebug->createdEntitiesText.setPosition(0, -60);
+	mEntityPoolsDebug->createdEntitiesText.setCharacterSize(10);
+
+	mEntityPoolsDebug->reusedEntitiesText.setFont(*mFont);
+	mEntityPoolsDebug->reusedEntitiesText.setPosition(0, -50);
+	mEntityPoolsDebug->reusedEntitiesText.setCharacterSize(10);
+
+	mEntityPoolsDebug->inactiveEntitiesText.setFont(*mFont);
+	mEntityPoolsDebug->inactiveEntitiesText.setPosition(0, -40);
+	mEntityPoolsDebug->inactiveEntitiesText.setCharacterSize(10);
 }
 
 void DebugCounter::update()
@@ -140,6 +181,15 @@ void DebugCounter::draw() const
 		Renderer::submitSFMLObject(mRendererDebug->drawnLinesText);
 		Renderer::submitSFMLObject(mRendererDebug->pointDrawCallsText);
 		Renderer::submitSFMLObject(mRendererDebug->drawnPointsText);
+		Renderer::submitSFMLObject(mRendererDebug->guiDrawCallsText);
+		Renderer::submitSFMLObject(mRendererDebug->drawnGuiQuadsText);
+	}
+
+	if(mIsEntityPoolsDebugActive) {
+		Renderer::submitSFMLObject(mEntityPoolsDebug->entityPoolsDebugBackground);
+		Renderer::submitSFMLObject(mEntityPoolsDebug->createdEntitiesText);
+		Renderer::submitSFMLObject(mEntityPoolsDebug->reusedEntitiesText);
+		Renderer::submitSFMLObject(mEntityPoolsDebug->inactiveEntitiesText);
 	}
 }
 
@@ -203,4 +253,25 @@ void DebugCounter::setNumberOfPointDrawCalls(unsigned nrOfDrawCalls)
 		mRendererDebug->pointDrawCallsText.setString("Point draw calls: " + std::to_string(nrOfDrawCalls));
 }
 
+void DebugCounter::setNumberOfGuiDrawCalls(unsigned nrOfDrawCalls)
+{
+	if(mIsRendererDebugActive)
+		mRendererDebug->guiDrawCallsText.setString("GUI draw calls: " + std::to_string(nrOfDrawCalls));
+}
+
+void DebugCounter::setNumberOfDrawnGuiQuads(unsigned nrOfDrawnQuads)
+{
+	if(mIsRendererDebugActive)
+		mRendererDebug->drawnGuiQuadsText.setString("Drawn GUI quads: " + std::to_string(nrOfDrawnQuads));
+}
+
+void DebugCounter::setEntityPoolsStats(const EntityPoolsStats& stats)
+{
+	if(mIsEntityPoolsDebugActive) {
+		mEntityPoolsDebug->createdEntitiesText.setString("Pooled entities created: " + std::to_string(stats.createdEntities));
+		mEntityPoolsDebug->reusedEntitiesText.setString("Pooled entities reused: " + std::to_string(stats.reusedEntities));
+		mEntityPoolsDebug->inactiveEntitiesText.setString("Inactive pooled entities: " + std::to_string(stats.inactiveEntities));
+	}
+}
+
 }
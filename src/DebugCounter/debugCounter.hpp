@@ -10,6 +10,8 @@
 
 namespace ph {
 
+struct EntityPoolsStats;
+
 class DebugCounter
 {
 public:
@@ -30,10 +32,14 @@ public:
 	void setNumberOfDrawnLines(unsigned nrOfTexturesDrawnByInstancedRendering);
 	void setNumberOfDrawnPoints(unsigned nrOfDrawnPoints);
 	void setNumberOfPointDrawCalls(unsigned nrOfDrawCalls);
+	void setNumberOfGuiDrawCalls(unsigned nrOfDrawCalls);
+	void setNumberOfDrawnGuiQuads(unsigned nrOfDrawnQuads);
+	void setEntityPoolsStats(const EntityPoolsStats&);
 
 private:
 	void initFPSCounter();
 	void initRendererDebug();
+	void initEntityPoolsDebug();
 
 private:
 	struct FPSCounter
@@ -55,10 +61,21 @@ private:
 		sf::Text drawnLinesText;
 		sf::Text pointDrawCallsText;
 		sf::Text drawnPointsText;
+		sf::Text guiDrawCallsText;
+		sf::Text drawnGuiQuadsText;
 		sf::RectangleShape rendererDebugBackground;
 	};
 	std::unique_ptr<RendererDebug> mRendererDebug;	
 
+	struct EntityPoolsDebug
+	{
+		sf::Text createdEntitiesText;
+		sf::Text reusedEntitiesText;
+		sf::Text inactiveEntitiesText;
+		sf::RectangleShape entityPoolsDebugBackground;
+	};
+	std::unique_ptr<EntityPoolsDebug> mEntityPoolsDebug;
+
 	sf::Font* mFont;
 
 	sf::Clock mClock;
@@ -66,6 +83,7 @@ private:
 	unsigned mFramesFromLastSecond;
 	bool mIsFPSCounterActive;
 	bool mIsRendererDebugActive;
+	bool mIsEntityPoolsDebugActive;
 };
 
 }
@@ -1,22 +1,30 @@
 #pragma once
 
 #include "Resources/animationStatesResources.hpp"
-#include "Utilities/rect.hpp"
-#include <SFML/System/Time.hpp>
-#include <map>
-#include <string>
-#include <vector>
 
 namespace ph::component {
 
 struct AnimationData
 {
-	std::string currentStateName;
-	AnimationStatesData* states;
+	const AnimationStatesData* states;
+	AnimationStateId currentStateId;
 	float delay = 0.1f;
 	float elapsedTime = 0.f;
-	std::size_t currentFrameIndex = 0;
+	std::uint32_t currentFrameIndex = 0;
 	bool isPlaying;
 };
 
 }
+
+namespace ph::animationStates {
+
+// NOTE: Ids of states which are set by systems, they're resolved once at startup
+inline const AnimationStateId leftUp = getAnimationStateId("leftUp");
+inline const AnimationStateId rightUp = getAnimationStateId("rightUp");
+inline const AnimationStateId left = getAnimationStateId("left");
+inline const AnimationStateId right = getAnimationStateId("right");
+inline const AnimationStateId up = getAnimationStateId("up");
+inline const AnimationStateId down = getAnimationStateId("down");
+inline const AnimationStateId dead = getAnimationStateId("dead");
+
+}
@@ -61,7 +61,6 @@ namespace ph::component {
 	struct CollisionWithPlayer
 	{
 		float pushForce;
-		bool isCollision;
 	};
 
 	struct Lifetime
@@ -3,18 +3,18 @@
 #include <SFML/Graphics/Color.hpp>
 #include "Renderer/API/camera.hpp"
 #include "Renderer/MinorRenderers/quadData.hpp"
+#include "Resources/resourceHolder.hpp"
 #include <vector>
 
 namespace ph{
 
-class Texture;
 class Shader;
 
 namespace component {
 
 	struct RenderQuad
 	{
-		Texture* texture;
+		TextureRef texture;
 		Shader* shader;
 		sf::Vector2f rotationOrigin;
 		sf::Color color;
@@ -27,6 +27,12 @@ namespace component {
 		IntRect rect;
 	};
 
+	// NOTE: Place of entity texture in atlas, TextureRect stays in coordinates of the original texture
+	struct AtlasRegion
+	{
+		IntRect rect;
+	};
+
 	struct RenderChunk
 	{
 		std::vector<QuadData> quads;
@@ -38,6 +44,7 @@ namespace component {
 	{
 		ph::Camera camera;
 		std::string name;
+		sf::Vector2f previousCenter;
 
 		inline static std::string currentCameraName;
 	};
@@ -51,6 +51,9 @@ namespace ph::component {
 	{
 		std::string entranceDestination;
 		sf::Vector2f playerSpawnPosition;
+
+		// NOTE: Destination scene is prefetched when player is closer to entrance than that
+		inline static constexpr float prefetchRadius = 250.f;
 	};
 
 	struct Lever
@@ -1,6 +1,7 @@
 #pragma once
 
-#include "Renderer/API/texture.hpp"
+#include "Resources/resourceHolder.hpp"
+#include "Utilities/rect.hpp"
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Graphics/Color.hpp>
 #include <vector>
@@ -20,7 +21,8 @@ struct ParticleEmitter
 {
 	std::vector<Particle> particles;
 
-	const Texture* parTexture = nullptr;
+	TextureRef parTexture;
+	IntRect parTextureRect; // NOTE: Empty rect means whole texture
 	sf::Vector2f spawnPositionOffset = {0.f, 0.f};
 	sf::Vector2f randomSpawnAreaSize = {0.f, 0.f};
 	sf::Vector2f parInitialVelocity = {0.f, 1.f};
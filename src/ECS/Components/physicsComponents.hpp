@@ -10,6 +10,12 @@ namespace ph::component {
 		ph::FloatRect rect;
 	};
 
+	// NOTE: Position of rendered BodyRect from the previous simulation step, it's assigned by RenderSystem
+	struct PreviousBodyPosition
+	{
+		sf::Vector2f position;
+	};
+
 	struct Velocity
 	{
 		float dx, dy;
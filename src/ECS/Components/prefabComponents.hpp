@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+namespace ph {
+
+using PrefabID = std::uint32_t;
+
+namespace component {
+
+	struct PrefabInstance
+	{
+		PrefabID prefab;
+	};
+
+}}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Utilities/rect.hpp"
+#include "entt/entity/registry.hpp"
+#include <array>
+#include <vector>
+
+namespace ph {
+
+enum class TriggerKind : unsigned char
+{
+	Entrance,
+	Hint,
+	CutScene,
+	Medkit,
+	BulletBox,
+	VelocityChangingArea,
+	PushingArea,
+	HostileCollision,
+	Count
+};
+
+enum class TriggerPhase : unsigned char { Enter, Stay, Exit };
+
+struct TriggerEvent
+{
+	entt::entity trigger;
+	entt::entity activator;
+	TriggerPhase phase;
+};
+
+// NOTE: Filled every frame by TriggerVolumes system and stored in registry context
+struct TriggerEvents
+{
+	std::array<std::vector<TriggerEvent>, static_cast<std::size_t>(TriggerKind::Count)> events;
+
+	const std::vector<TriggerEvent>& get(TriggerKind kind) const { return events[static_cast<std::size_t>(kind)]; }
+	std::vector<TriggerEvent>& get(TriggerKind kind) { return events[static_cast<std::size_t>(kind)]; }
+};
+
+namespace component {
+
+	// NOTE: Assigned by TriggerVolumes system to entities with area components, entity can be only one kind of trigger
+	struct TriggerVolume
+	{
+		TriggerKind kind;
+		FloatRect indexedRect;
+	};
+
+}}
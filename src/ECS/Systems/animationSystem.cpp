@@ -1,6 +1,7 @@
 #include "animationSystem.hpp"
 #include "ECS/Components/animationComponents.hpp"
 #include "ECS/Components/graphicsComponents.hpp"
+#include "Logs/logs.hpp"
 #include "Utilities/profiling.hpp"
 
 namespace ph::system {
@@ -11,39 +12,30 @@ void AnimationSystem::update(float dt)
 
 	auto view = mRegistry.view<component::AnimationData, component::TextureRect>();
 
-	for(auto entity : view)
+	view.each([dt](component::AnimationData& animationData, component::TextureRect& textureRect)
 	{
-		auto& [animationData, textureRect] = view.get<component::AnimationData, component::TextureRect>(entity);
-		
+		PH_ASSERT_UNEXPECTED_SITUATION(animationData.states->hasState(animationData.currentStateId), "Animation state doesn't exist in entity's animation set!");
+		const StateData& state = animationData.states->getState(animationData.currentStateId);
+
 		if(animationData.isPlaying)
 		{
 			animationData.elapsedTime += dt;
+			if(animationData.elapsedTime < animationData.delay)
+				return;
 			while(animationData.elapsedTime >= animationData.delay)
 			{
 				animationData.elapsedTime -= animationData.delay;
-				StateData& state = animationData.states->at(animationData.currentStateName);
 				if(++animationData.currentFrameIndex >= state.frameCount)
 					animationData.currentFrameIndex = 0;
-				textureRect.rect = IntRect(
-					state.startFrame.left + state.startFrame.width * animationData.currentFrameIndex,
-					state.startFrame.top,
-					state.startFrame.width,
-					state.startFrame.height
-				);
 			}
 		}
 		else 
 		{
-			StateData& state = animationData.states->at(animationData.currentStateName);
 			animationData.currentFrameIndex = 0;
-			textureRect.rect = IntRect(
-				state.startFrame.left,
-				state.startFrame.top,
-				state.startFrame.width,
-				state.startFrame.height
-			);
 		}
-	}
+
+		textureRect.rect = animationData.states->getFrame(state, animationData.currentFrameIndex);
+	});
 }
 
 }
@@ -18,9 +18,15 @@ namespace ph::system {
 ArcadeMode::ArcadeMode(entt::registry& registry, GUI& gui, AIManager& aiManager, MusicPlayer& musicPlayer, EntitiesTemplateStorage& templateStorage)
 	:System(registry)
 	,mGui(gui)
+	,mTimeToNextWaveText(gui, "nextWaveInfo/canvas/counters/timeToNextWave")
+	,mWaveCounterText(gui, "arcadeCounters/canvas/counters/waveCounter")
+	,mEnemiesCounterText(gui, "arcadeCounters/canvas/counters/enemiesCounter")
 	,mAIManager(aiManager)
-	,mTemplateStorage(templateStorage)
 	,mMusicPlayer(musicPlayer)
+	,mTemplateStorage(templateStorage)
+	,mNormalZombiePrefab(templateStorage.getPrefab("Zombie"))
+	,mSlowZombiePrefab(templateStorage.getPrefab("SlowZombie"))
+	,mRandom(Random::makeStream(Random::Streams::ArcadeMode))
 {
 	sIsActive = true;
 	mAIManager.setAIMode(AIMode::zombieAlwaysLookForPlayer);
@@ -49,10 +55,8 @@ void ArcadeMode::update(float dt)
 
 		mMusicPlayer.playFromMusicState("break");
 
-		auto* canvas = mGui.getInterface("nextWaveInfo")->getWidget("canvas");
-		auto* timeToNextWave = dynamic_cast<TextWidget*>(canvas->getWidget("counters")->getWidget("timeToNextWave"));
 		std::string timeLeft = std::to_string(static_cast<int>(mTimeBeforeStartingFirstWave + 1.f));
-		timeToNextWave->setString("Start in " + timeLeft  + " seconds!");
+		mTimeToNextWaveText->setString("Start in " + timeLeft  + " seconds!");
 
 		if(mTimeBeforeStartingFirstWave <= 0.f) {
 			mMusicPlayer.playFromMusicState("wave");
@@ -72,10 +76,10 @@ void ArcadeMode::update(float dt)
 			if(arcadeModeSpawner.timeFromLastSpawn > 0.5f) 
 			{
 				arcadeModeSpawner.timeFromLastSpawn = 0.f;
-				const sf::Vector2f spawnPos = Random::generateVector(spawnerBody.rect.getTopLeft(), spawnerBody.rect.getBottomRight());
+				const sf::Vector2f spawnPos = mRandom.generateVector(spawnerBody.rect.getTopLeft(), spawnerBody.rect.getBottomRight());
 				auto& wave = arcadeModeSpawner.waves[mCurrentWave - 1];
 				if(wave.normalZombiesToSpawn > 0 && wave.slowZombiesToSpawn > 0) {
-					int ran = Random::generateNumber(0, 5);
+					int ran = mRandom.generateNumber(0, 5);
 					if(ran == 0) {
 						createNormalZombie(spawnPos);
 						--wave.normalZombiesToSpawn;
@@ -119,6 +123,19 @@ void ArcadeMode::createNextWave()
 {
 	++mCurrentWave;
 	mShouldSpawnEnemies = true;
+
+	// NOTE: Zombies of the wave are spawned over time, reserve their pools up front so they stay dense
+	std::size_t normalZombiesInWave = 0;
+	std::size_t slowZombiesInWave = 0;
+	auto spawners = mRegistry.view<component::ArcadeSpawner>();
+	spawners.each([&](const component::ArcadeSpawner& spawner) {
+		if(mCurrentWave <= static_cast<int>(spawner.waves.size())) {
+			normalZombiesInWave += spawner.waves[mCurrentWave - 1].normalZombiesToSpawn;
+			slowZombiesInWave += spawner.waves[mCurrentWave - 1].slowZombiesToSpawn;
+		}
+	});
+	mTemplateStorage.reserve(mNormalZombiePrefab, normalZombiesInWave, mRegistry);
+	mTemplateStorage.reserve(mSlowZombiePrefab, slowZombiesInWave, mRegistry);
 	mIsBreakTime = false;
 }
 
@@ -140,8 +157,8 @@ void ArcadeMode::startBreakTime()
 				auto& [bullets, body] = mRegistry.get<component::Bullets, component::BodyRect>(bulletBoxEntity);
 				body.rect.setPosition(lootSpawnerBody.rect.getTopLeft());
 				mRegistry.assign<component::Velocity>(bulletBoxEntity);
-				bullets.numOfPistolBullets = 5 * Random::generateNumber(3, 5);
-				bullets.numOfShotgunBullets = 5 * Random::generateNumber(1, 2);
+				bullets.numOfPistolBullets = 5 * mRandom.generateNumber(3, 5);
+				bullets.numOfShotgunBullets = 5 * mRandom.generateNumber(1, 2);
 			} break;
 			// NOTE: We assign velocity component so they are pushed by pusingArea in arcade sewage map
 		}
@@ -171,33 +188,31 @@ void ArcadeMode::endBreakTime()
 void ArcadeMode::updateGuiCounters()
 {
 	if(mIsBreakTime) {
-		auto* arcadeInterface2 = mGui.getInterface("nextWaveInfo");
-		auto* counters = arcadeInterface2->getWidget("canvas")->getWidget("counters");
-		auto* timeToNextWave = dynamic_cast<TextWidget*>(counters->getWidget("timeToNextWave"));
 		int secondsUntilTheEndOfBreak = static_cast<int>(20.f - mTimeFromBreakTimeStart);
-		timeToNextWave->setString("Time to next wave: " + addZero(secondsUntilTheEndOfBreak));
+		mTimeToNextWaveText->setString("Time to next wave: " + addZero(secondsUntilTheEndOfBreak));
 	}
 	else {
-		auto* arcadeInterface = mGui.getInterface("arcadeCounters");
-		auto* counters = arcadeInterface->getWidget("canvas")->getWidget("counters");
-
-		auto* waveCounter = dynamic_cast<TextWidget*>(counters->getWidget("waveCounter"));
-		waveCounter->setString("Wave: " + addZero(mCurrentWave));
-		auto* enemiesCounter = dynamic_cast<TextWidget*>(counters->getWidget("enemiesCounter"));
-		enemiesCounter->setString("Enemies: " + addZero(mEnemiesCounter));
+		// NOTE: Strings are built only when counters change
+		if(mCurrentWave == mDisplayedWave && mEnemiesCounter == mDisplayedEnemiesCounter)
+			return;
+
+		mWaveCounterText->setString("Wave: " + addZero(mCurrentWave));
+		mEnemiesCounterText->setString("Enemies: " + addZero(mEnemiesCounter));
+		mDisplayedWave = mCurrentWave;
+		mDisplayedEnemiesCounter = mEnemiesCounter;
 	}
 }
 
 void ArcadeMode::createNormalZombie(sf::Vector2f position)
 {
-	auto zombie = mTemplateStorage.createCopy("Zombie", mRegistry);
+	auto zombie = mTemplateStorage.spawn(mNormalZombiePrefab, mRegistry);
 	auto& body = mRegistry.get<component::BodyRect>(zombie);
 	body.rect.setPosition(position);
 }
 
 void ArcadeMode::createSlowZombie(sf::Vector2f position)
 {
-	auto slowZombie = mTemplateStorage.createCopy("SlowZombie", mRegistry);
+	auto slowZombie = mTemplateStorage.spawn(mSlowZombiePrefab, mRegistry);
 	auto& body = mRegistry.get<component::BodyRect>(slowZombie);
 	body.rect.setPosition(position);
 }
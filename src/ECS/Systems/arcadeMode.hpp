@@ -1,12 +1,15 @@
 #pragma once
 
 #include "ECS/system.hpp"
+#include "ECS/entitiesTemplateStorage.hpp"
+#include "GUI/widgetRef.hpp"
+#include "Utilities/random.hpp"
 
 namespace ph {
 	class GUI;
+	class TextWidget;
 	class AIManager;
 	class MusicPlayer;
-	class EntitiesTemplateStorage;
 }
 
 namespace ph::system {
@@ -31,9 +34,15 @@ private:
 
 private:
 	GUI& mGui;
+	WidgetRef<TextWidget> mTimeToNextWaveText;
+	WidgetRef<TextWidget> mWaveCounterText;
+	WidgetRef<TextWidget> mEnemiesCounterText;
 	AIManager& mAIManager;
 	MusicPlayer& mMusicPlayer;
 	EntitiesTemplateStorage& mTemplateStorage;
+	PrefabID mNormalZombiePrefab;
+	PrefabID mSlowZombiePrefab;
+	RandomGenerator mRandom;
 	float mTimeFromStart = 0.f;
 	float mTimeFromBreakTimeStart;
 	float mTimeBeforeStartingFirstWave = 5.f;
@@ -42,6 +51,8 @@ private:
 	int mNormalZombiesToSpawnPerSpawner = 0;
 	int mEnemiesCounter = 0;
 	int mCurrentWave = 0;
+	int mDisplayedWave = -1;
+	int mDisplayedEnemiesCounter = -1;
 	bool mIsBreakTime = false;
 	bool mMadeInit = false;
 	bool mHasStartedFirstWave = false;
@@ -6,7 +6,7 @@
 
 namespace ph::system {
 
-void AreasDebug::update(float dt)
+void AreasDebug::render(float)
 {
 	PH_PROFILE_FUNCTION();
 
@@ -9,7 +9,8 @@ class AreasDebug : public System
 public:
 	using System::System;
 
-	void update(float dt) override;
+	void update(float) override {}
+	void render(float interpolation) override;
 
 	static void setIsCollisionDebugActive(bool isActive) { sIsCollisionDebugActive = isActive; }
 	static void setIsVelocityChangingAreaDebugActive(bool isActive) { sIsVelocityChangingAreaDebugActive = isActive; }
@@ -80,8 +80,18 @@ namespace ph::system {
 		for(auto& entity : spatialSoundsView)
 		{
 			const auto& [spatialSound, body] = spatialSoundsView.get<component::SpatialSound, component::BodyRect>(entity);
-			mSoundPlayer.playSpatialSound(spatialSound.filepath, body.rect.getCenter());
+			mSoundPlayer.playSpatialSound(spatialSound.filepath, body.rect.getCenter(), entt::to_integer(entity));
 			mRegistry.remove<component::SpatialSound>(entity);
 		}
+
+		// move sounds together with entities which made them
+		mSoundPlayer.updateEmitterPositions([this](std::uint32_t emitter, sf::Vector2f& position)
+		{
+			const auto entity = static_cast<entt::entity>(emitter);
+			if(!mRegistry.valid(entity) || !mRegistry.has<component::BodyRect>(entity))
+				return false;
+			position = mRegistry.get<component::BodyRect>(entity).rect.getCenter();
+			return true;
+		});
 	}
 }
@@ -3,6 +3,7 @@
 #include "ECS/Components/charactersComponents.hpp"
 #include "ECS/Components/graphicsComponents.hpp"
 #include "ECS/Components/objectsComponents.hpp"
+#include "ECS/Components/triggerComponents.hpp"
 #include "Scenes/cutSceneManager.hpp"
 #include "Scenes/CutScenes/endingCutscene.hpp"
 #include "Scenes/CutScenes/gateGuardDialogue.hpp"
@@ -25,23 +26,24 @@ CutScenesActivating::CutScenesActivating(entt::registry& registry, CutSceneManag
 
 void CutScenesActivating::update(float dt)
 {
-	// get player position
-	FloatRect playerBodyRect;
-	auto players = mRegistry.view<component::Player, component::BodyRect>();
-	players.each([&playerBodyRect](const component::Player, const component::BodyRect& body) {
-		playerBodyRect = body.rect;
+	// activate cutscenes which start with the map
+	auto cutscenes = mRegistry.view<component::CutScene>();
+	cutscenes.each([this](component::CutScene& cutscene) {
+		if(!cutscene.wasActivated && cutscene.isStartingCutSceneOnThisMap) {
+			cutscene.wasActivated = true;
+			activateCutscene(cutscene.name);
+		}
 	});
 
-	// activate cutscenes
-	auto cutscenes = mRegistry.view<component::CutScene, component::BodyRect>();
-	cutscenes.each([this, playerBodyRect](component::CutScene& cutscene, const component::BodyRect& body) {
-		if(cutscene.wasActivated)
-			return;
-		if(cutscene.isStartingCutSceneOnThisMap || body.rect.contains(playerBodyRect.getCenter())) {
+	// activate cutscenes entered by player
+	for(const auto& event : mRegistry.ctx<TriggerEvents>().get(TriggerKind::CutScene))
+	{
+		auto& cutscene = mRegistry.get<component::CutScene>(event.trigger);
+		if(event.phase == TriggerPhase::Enter && !cutscene.wasActivated) {
 			cutscene.wasActivated = true;
 			activateCutscene(cutscene.name);
 		}
-	});
+	}
 }
 
 void CutScenesActivating::activateCutscene(const std::string& name) const
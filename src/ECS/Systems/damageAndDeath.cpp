@@ -8,6 +8,7 @@
 #include "AI/aiManager.hpp"
 #include "Logs/logs.hpp"
 #include "Utilities/profiling.hpp"
+#include <algorithm>
 
 namespace ph::system {
 
@@ -97,7 +98,14 @@ namespace ph::system {
 					bloodParEmitter.amountOfParticles = 15;
 				}
 				
-				multiParticleEmitter.particleEmitters.emplace_back(bloodParEmitter);
+				auto& emitters = multiParticleEmitter.particleEmitters;
+				auto finishedEmitter = std::find_if(emitters.begin(), emitters.end(), [](const component::ParticleEmitter& emitter) {
+					return emitter.oneShot && !emitter.isEmitting;
+				});
+				if(finishedEmitter != emitters.end())
+					*finishedEmitter = bloodParEmitter;
+				else
+					emitters.emplace_back(bloodParEmitter);
 			}
 		}
 	}
@@ -143,7 +151,7 @@ namespace ph::system {
 				}
 
 				auto& animation = mRegistry.get<component::AnimationData>(entity);
-				animation.currentStateName = "dead";
+				animation.currentStateId = animationStates::dead;
 			}
 		}
 	}
@@ -1,15 +1,24 @@
 #include "entityDestroying.hpp"
+#include "ECS/entitiesTemplateStorage.hpp"
 #include "ECS/Components/charactersComponents.hpp"
 #include "Utilities/profiling.hpp"
 
 namespace ph::system {
 
+	EntityDestroying::EntityDestroying(entt::registry& registry, EntitiesTemplateStorage& templateStorage)
+		:System(registry)
+		,mTemplateStorage(templateStorage)
+	{
+	}
+
 	void EntityDestroying::update(float dt)
 	{
 		PH_PROFILE_FUNCTION();
 
 		auto view = mRegistry.view<component::TaggedToDestroy>();
-		mRegistry.destroy(view.begin(), view.end());
+		for(auto entity : view)
+			if(!mTemplateStorage.release(entity, mRegistry))
+				mRegistry.destroy(entity);
 	}
 
 }
@@ -2,13 +2,20 @@
 
 #include "ECS/system.hpp"
 
+namespace ph {
+	class EntitiesTemplateStorage;
+}
+
 namespace ph::system {
 
 	class EntityDestroying : public System
 	{
 	public:
-		using System::System;
+		EntityDestroying(entt::registry&, EntitiesTemplateStorage&);
 
 		void update(float dt) override;
+
+	private:
+		EntitiesTemplateStorage& mTemplateStorage;
 	};
 }
\ No newline at end of file
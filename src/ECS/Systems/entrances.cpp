@@ -5,6 +5,7 @@
 #include "ECS/Components/objectsComponents.hpp"
 #include "ECS/Components/charactersComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
+#include "ECS/Components/triggerComponents.hpp"
 
 #include "Utilities/profiling.hpp"
 
@@ -20,24 +21,27 @@ void Entrances::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
 
-	auto playerView = mRegistry.view<component::Player, component::BodyRect>();
-	auto entrancesView = mRegistry.view<component::Entrance, component::BodyRect>();
-
-	for (auto player : playerView)
+	for (const auto& event : mRegistry.ctx<TriggerEvents>().get(TriggerKind::Entrance))
 	{
-		const auto& playerBody = playerView.get<component::BodyRect>(player);
+		const auto& [entranceDetails, entranceBody] = mRegistry.get<component::Entrance, component::BodyRect>(event.trigger);
+		std::string sceneFilepath = "scenes/" + entranceDetails.entranceDestination.substr(2);
 
-		for (auto entrance : entrancesView)
+		// player walked away, so the destination scene isn't kept in memory
+		if (event.phase == TriggerPhase::Exit)
 		{
-			const auto& entranceBody = entrancesView.get<component::BodyRect>(entrance);
-			if (entranceBody.rect.contains(playerBody.rect.getCenter()))
-			{
-				const auto& entranceDetails = entrancesView.get<component::Entrance>(entrance);
-				std::string sceneFilepath = "scenes/" + entranceDetails.entranceDestination.substr(2);
-				mSceneManager.replaceScene(sceneFilepath, entranceDetails.playerSpawnPosition);
-				return;
-			}
+			mSceneManager.cancelScenePrefetch(sceneFilepath);
+			continue;
 		}
+
+		const auto& playerBody = mRegistry.get<component::BodyRect>(event.activator);
+		if (entranceBody.rect.contains(playerBody.rect.getCenter()))
+		{
+			mSceneManager.replaceScene(sceneFilepath, entranceDetails.playerSpawnPosition);
+			return;
+		}
+
+		// warm the destination scene so entering it is instant
+		mSceneManager.prefetchScene(sceneFilepath);
 	}
 }
 
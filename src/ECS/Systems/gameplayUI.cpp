@@ -9,7 +9,9 @@ namespace ph::system {
 
 GameplayUI::GameplayUI(entt::registry& registry, GUI& gui)
 	:System(registry)
-	,mGui(gui)
+	,mPistolBulletCounter(gui, "gameplayCounters/canvas/pistolBulletCounter")
+	,mShotgunBulletCounter(gui, "gameplayCounters/canvas/shotgunBulletCounter")
+	,mVitalityCounter(gui, "gameplayCounters/canvas/vitalityCounter")
 {
 }
 
@@ -20,22 +22,26 @@ void GameplayUI::update(float dt)
 	auto view = mRegistry.view<component::Player, component::Bullets>();
 	for(auto player : view)
 	{
-		auto* canvas = mGui.getInterface("gameplayCounters")->getWidget("canvas");
+		const auto bullets = view.get<component::Bullets>(player);
+
+		// NOTE: We have to take player's health from registry because health component is removed from player after death
+		const int playerHP = mRegistry.has<component::Health>(player) ? mRegistry.get<component::Health>(player).healthPoints : 0;
+
+		// NOTE: Strings are built only when counters change
+		if(bullets.numOfPistolBullets == mDisplayedPistolBullets && bullets.numOfShotgunBullets == mDisplayedShotgunBullets &&
+		   playerHP == mDisplayedHealth)
+			continue;
 
 		// set bullets counter
-		const auto bullets = view.get<component::Bullets>(player);
-		dynamic_cast<TextWidget*>(canvas->getWidget("pistolBulletCounter"))->setString(std::to_string(bullets.numOfPistolBullets));
-		dynamic_cast<TextWidget*>(canvas->getWidget("shotgunBulletCounter"))->setString(std::to_string(bullets.numOfShotgunBullets));
+		mPistolBulletCounter->setString(std::to_string(bullets.numOfPistolBullets));
+		mShotgunBulletCounter->setString(std::to_string(bullets.numOfShotgunBullets));
 
 		// set health counter
-		if(mRegistry.has<component::Health>(player)) {
-			const auto playerHP = mRegistry.get<component::Health>(player).healthPoints;
-			dynamic_cast<TextWidget*>(canvas->getWidget("vitalityCounter"))->setString(std::to_string(playerHP));
-		}
-		else
-			dynamic_cast<TextWidget*>(canvas->getWidget("vitalityCounter"))->setString(std::to_string(0));
+		mVitalityCounter->setString(std::to_string(playerHP));
 
-		// NOTE: We have to take player's health from registry because health component is removed from player after death
+		mDisplayedPistolBullets = bullets.numOfPistolBullets;
+		mDisplayedShotgunBullets = bullets.numOfShotgunBullets;
+		mDisplayedHealth = playerHP;
 	}
 }
 
@@ -1,10 +1,11 @@
 #pragma once
 
 #include "ECS/system.hpp"
+#include "GUI/widgetRef.hpp"
 
 namespace ph {
 
-class GUI;
+class TextWidget;
 
 namespace system {
 
@@ -16,7 +17,12 @@ public:
 	void update(float dt) override;
 
 private:
-	GUI& mGui;
+	WidgetRef<TextWidget> mPistolBulletCounter;
+	WidgetRef<TextWidget> mShotgunBulletCounter;
+	WidgetRef<TextWidget> mVitalityCounter;
+	int mDisplayedPistolBullets = -1;
+	int mDisplayedShotgunBullets = -1;
+	int mDisplayedHealth = -1;
 };
 
 }}
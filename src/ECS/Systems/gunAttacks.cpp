@@ -7,6 +7,8 @@
 #include "ECS/Components/objectsComponents.hpp"
 #include "ECS/Components/graphicsComponents.hpp"
 #include "ECS/Components/itemComponents.hpp"
+#include "ECS/rayQueries.hpp"
+#include "ECS/entitiesTemplateStorage.hpp"
 #include "Events/actionEventManager.hpp"
 #include "Renderer/renderer.hpp"
 
@@ -17,19 +19,30 @@
 
 namespace ph::system {
 
+GunAttacks::GunAttacks(entt::registry& registry, EntitiesTemplateStorage& templateStorage)
+	:System(registry)
+	,mTemplateStorage(templateStorage)
+	,mRandom(Random::makeStream(Random::Streams::GunAttacks))
+{
+}
+
 void GunAttacks::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
 
 	handlePendingGunAttacks();
-	handleLastingBullets();
+}
+
+void GunAttacks::render(float)
+{
+	submitLastingShots();
 }
 
 void GunAttacks::onEvent(const ActionEvent& event)
 {
 	if (event.mType == ActionEvent::Type::Pressed)
 	{
-		if(event.mAction == "gunAttack") 
+		if(event.mAction == Actions::GunAttack) 
 		{
 			auto playerGunView = mRegistry.view<component::Player, component::GunAttacker>();
 			for (auto player : playerGunView) {
@@ -37,7 +50,7 @@ void GunAttacks::onEvent(const ActionEvent& event)
 				playerGunAttack.isTryingToAttack = true;
 			}
 		}
-		else if(event.mAction == "changeWeapon")
+		else if(event.mAction == Actions::ChangeWeapon)
 		{
 			auto currentGunView = mRegistry.view<component::CurrentGun, component::GunProperties>();
 			auto otherGunsView = mRegistry.view<component::GunProperties>(entt::exclude<component::CurrentGun>);
@@ -163,43 +176,25 @@ void GunAttacks::tagEnemiesInGunAttackArea(sf::Vector2f playerFaceDirection, con
 std::vector<sf::Vector2f> GunAttacks::performShoot(const sf::Vector2f& playerFaceDirection, const sf::Vector2f& startingBulletPos, float range, float deflectionAngle, int damage, int numberOfBullets) const
 {
 	auto enemiesWithDamageTag = mRegistry.view<component::DamageTag, component::InPlayerGunAttackArea, component::Killable, component::BodyRect>();
-	auto enemies = mRegistry.view<component::InPlayerGunAttackArea, component::Killable, component::BodyRect>();
 	std::vector<sf::Vector2f> shotsEndingPositions;
-	const int bulletShiftValue = 5;
 
 	for (int i = 0; i < numberOfBullets; ++i)
 	{
-		sf::Vector2f direction = getBulletDirection(playerFaceDirection, deflectionAngle);
-		sf::Vector2f currentBulletPos = startingBulletPos;
-		int bulletTravelledDist = 1;
+		const Ray bulletRay{startingBulletPos, getBulletDirection(playerFaceDirection, deflectionAngle), range};
+		const RayHit hit = castRay<component::InPlayerGunAttackArea, component::Killable>(mRegistry, bulletRay);
 
-		while (bulletTravelledDist < range)
+		if (hit.hitEntity())
 		{
-			bool didBulletHitEnemy = false;
-			for (const auto enemy : enemies)
+			if (enemiesWithDamageTag.contains(hit.entity))
 			{
-				const auto& bodyRect = enemies.get<component::BodyRect>(enemy);
-				if (bodyRect.rect.contains(currentBulletPos))
-				{
-					if (enemiesWithDamageTag.contains(enemy))
-					{
-						auto& damageTagValue = enemiesWithDamageTag.get<component::DamageTag>(enemy);
-						damageTagValue.amountOfDamage += damage;
-					}
-					else
-						mRegistry.assign<component::DamageTag>(enemy, damage);
-					didBulletHitEnemy = true;
-					break;
-				}
+				auto& damageTagValue = enemiesWithDamageTag.get<component::DamageTag>(hit.entity);
+				damageTagValue.amountOfDamage += damage;
 			}
-
-			if (didBulletHitEnemy)
-				break;
-
-			bulletTravelledDist += bulletShiftValue;
-			currentBulletPos = getCurrentPosition(direction, startingBulletPos, bulletTravelledDist);
+			else
+				mRegistry.assign<component::DamageTag>(hit.entity, damage);
 		}
-		shotsEndingPositions.emplace_back(currentBulletPos);
+
+		shotsEndingPositions.emplace_back(bulletRay.getPoint(hit.distance));
 	}
 
 	return shotsEndingPositions;
@@ -207,7 +202,7 @@ std::vector<sf::Vector2f> GunAttacks::performShoot(const sf::Vector2f& playerFac
 
 sf::Vector2f GunAttacks::getBulletDirection(const sf::Vector2f& playerFaceDirection, float deflection) const
 {
-	deflection = Random::generateNumber(-deflection, deflection);
+	deflection = mRandom.generateNumber(-deflection, deflection);
 	const float deflectionFactor = deflection / -90.f;
 	sf::Vector2f deflectedBulletDirection = playerFaceDirection;
 
@@ -292,14 +287,6 @@ sf::Vector2f GunAttacks::getBulletDirection(const sf::Vector2f& playerFaceDirect
 	return deflectedBulletDirection;
 }
 
-sf::Vector2f GunAttacks::getCurrentPosition(const sf::Vector2f& bulletDirection, const sf::Vector2f& startingPos, const int bulletDistance) const
-{
-	sf::Vector2f newPosition;
-	newPosition.x = startingPos.x + bulletDirection.x * bulletDistance;
-	newPosition.y = startingPos.y + bulletDirection.y * bulletDistance;
-	return newPosition;
-}
-
 void GunAttacks::clearInGunAttackAreaTags() const
 {
 	auto enemiesInAreaAttackView = mRegistry.view<component::InPlayerGunAttackArea>();
@@ -309,19 +296,19 @@ void GunAttacks::clearInGunAttackAreaTags() const
 
 void GunAttacks::createShotImage(const sf::Vector2f shotsStartingPosition, const std::vector<sf::Vector2f>& shotsEngingPosition, const std::string& soundFilename) const
 {
-	for (auto shot : shotsEngingPosition)
+	const PrefabID lastingShotPrefab = mTemplateStorage.getPrefab("LastingShot");
+	mTemplateStorage.spawn(lastingShotPrefab, shotsEngingPosition.size(), mRegistry, [&](entt::entity entity, std::size_t index)
 	{
-		auto entity = mRegistry.create();
-		mRegistry.assign<component::LastingShot>(entity, shotsStartingPosition, shot);
-		mRegistry.assign<component::Lifetime>(entity, .05f);
-	}
+		auto& lastingShot = mRegistry.get<component::LastingShot>(entity);
+		lastingShot.startingShotPos = shotsStartingPosition;
+		lastingShot.endingShotPos = shotsEngingPosition[index];
+	});
 
-	auto soundEntity = mRegistry.create();
-	mRegistry.assign<component::AmbientSound>(soundEntity, soundFilename.c_str());
-	mRegistry.assign<component::Lifetime>(soundEntity, .05f);
+	auto soundEntity = mTemplateStorage.spawn(mTemplateStorage.getPrefab("ShotSound"), mRegistry);
+	mRegistry.get<component::AmbientSound>(soundEntity).filepath = soundFilename.c_str();
 }
 
-void GunAttacks::handleLastingBullets() const
+void GunAttacks::submitLastingShots() const
 {
 	const auto lastingShotsView = mRegistry.view<component::LastingShot>();
 
@@ -4,6 +4,7 @@
 #include "ECS/Components/charactersComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
 #include "ECS/Components/objectsComponents.hpp"
+#include "ECS/Components/triggerComponents.hpp"
 #include "Events/actionEventManager.hpp"
 #include "Utilities/profiling.hpp"
 
@@ -19,46 +20,36 @@ void HintAreas::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
 
-	auto playerView = mRegistry.view<component::Player, component::BodyRect>();
-	auto hintAreasView = mRegistry.view<component::Hint, component::BodyRect>();
-	for (auto player : playerView)
+	for (const auto& event : mRegistry.ctx<TriggerEvents>().get(TriggerKind::Hint))
 	{
-		const auto& playerBody = playerView.get<component::BodyRect>(player);
-		for (auto hintArea : hintAreasView)
+		auto& hintDetails = mRegistry.get<component::Hint>(event.trigger);
+		if (event.phase == TriggerPhase::Enter && !hintDetails.isShown)
 		{
-			const auto& hintAreaBody = hintAreasView.get<component::BodyRect>(hintArea);
-			auto& hintDetails = hintAreasView.get<component::Hint>(hintArea);
-			if (hintAreaBody.rect.contains(playerBody.rect.getCenter()))
-			{
-				if (hintDetails.isShown)
-					break;
-
-				mGui.getInterface("hints")->show();
-				mGui.getInterface("hints")->getWidget("canvas")->getWidget(hintDetails.hintName)->show();
-				hintDetails.isShown = true;
-
-				// NOTE: This is temporary
-				if(hintDetails.hintName == "controlHint") {
-					ActionEventManager::setActionEnabled("changeWeapon", false);
-					ActionEventManager::setActionEnabled("gunAttack", false);
-					ActionEventManager::setActionEnabled("meleeAttack", false);
-				}
-				else if(hintDetails.hintName == "shootingHint") {
-					ActionEventManager::setActionEnabled("gunAttack", true);
-				}
-				else if(hintDetails.hintName == "meleeFightingHint") {
-					ActionEventManager::setActionEnabled("meleeAttack", true);
-				}
-				else if(hintDetails.hintName == "weaponChangingHint") {
-					ActionEventManager::setActionEnabled("changeWeapon", true);
-				}
+			mGui.getInterface("hints")->show();
+			mGui.getInterface("hints")->getWidget("canvas")->getWidget(hintDetails.hintName)->show();
+			hintDetails.isShown = true;
+
+			// NOTE: This is temporary
+			if(hintDetails.hintName == "controlHint") {
+				ActionEventManager::setActionEnabled(Actions::ChangeWeapon, false);
+				ActionEventManager::setActionEnabled(Actions::GunAttack, false);
+				ActionEventManager::setActionEnabled(Actions::MeleeAttack, false);
+			}
+			else if(hintDetails.hintName == "shootingHint") {
+				ActionEventManager::setActionEnabled(Actions::GunAttack, true);
 			}
-			else if (hintDetails.isShown)
-			{
-				mGui.getInterface("hints")->getWidget("canvas")->getWidget(hintDetails.hintName)->hide();
-				mGui.getInterface("hints")->hide();
-				hintDetails.isShown = false;
+			else if(hintDetails.hintName == "meleeFightingHint") {
+				ActionEventManager::setActionEnabled(Actions::MeleeAttack, true);
 			}
+			else if(hintDetails.hintName == "weaponChangingHint") {
+				ActionEventManager::setActionEnabled(Actions::ChangeWeapon, true);
+			}
+		}
+		else if (event.phase == TriggerPhase::Exit && hintDetails.isShown)
+		{
+			mGui.getInterface("hints")->getWidget("canvas")->getWidget(hintDetails.hintName)->hide();
+			mGui.getInterface("hints")->hide();
+			hintDetails.isShown = false;
 		}
 	}
 }
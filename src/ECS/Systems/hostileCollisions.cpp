@@ -1,6 +1,7 @@
 #include "hostileCollisions.hpp"
 #include "ECS/Components/charactersComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
+#include "ECS/Components/triggerComponents.hpp"
 #include "Utilities/rect.hpp"
 #include "Utilities/profiling.hpp"
 #include "Utilities/math.hpp"
@@ -11,34 +12,18 @@ namespace ph::system {
 	{
 		PH_PROFILE_FUNCTION();
 
-		auto playerView = mRegistry.view<component::Player, component::BodyRect, component::Health, component::PushingForces>();
-		auto enemiesView = mRegistry.view<component::BodyRect, component::Damage, component::CollisionWithPlayer>();
-
-		for (auto player : playerView)
+		for (const auto& event : mRegistry.ctx<TriggerEvents>().get(TriggerKind::HostileCollision))
 		{
-			const auto& playerBody = playerView.get<component::BodyRect>(player);
-			auto& playerPushingForces = playerView.get<component::PushingForces>(player);
-
-			for (auto damageDealingEntitiy : enemiesView)
-			{
-				auto& playerCollision = enemiesView.get<component::CollisionWithPlayer>(damageDealingEntitiy);
-				const auto& enemyBody = enemiesView.get<component::BodyRect>(damageDealingEntitiy);
+			if (event.phase != TriggerPhase::Enter || !mRegistry.has<component::Health, component::PushingForces>(event.activator))
+				continue;
 
-				if (playerBody.rect.doPositiveRectsIntersect(enemyBody.rect))
-				{
-					if (playerCollision.isCollision)
-						continue;
-					playerCollision.isCollision = true;
+			const auto& [damage, playerCollision, enemyBody] = mRegistry.get<component::Damage, component::CollisionWithPlayer, component::BodyRect>(event.trigger);
+			auto [playerBody, playerPushingForces] = mRegistry.get<component::BodyRect, component::PushingForces>(event.activator);
 
-					const auto& damage = enemiesView.get<component::Damage>(damageDealingEntitiy);
-					mRegistry.assign<component::DamageTag>(player, damage.damageDealt);
+			mRegistry.assign_or_replace<component::DamageTag>(event.activator, damage.damageDealt);
 
-					playerPushingForces.vel = playerCollision.pushForce * Math::getUnitVector(playerBody.rect.getCenter() - enemyBody.rect.getCenter());
-					playerPushingForces.friction = 1.f;
-				}
-				else
-					playerCollision.isCollision = false;
-			}
+			playerPushingForces.vel = playerCollision.pushForce * Math::getUnitVector(playerBody.rect.getCenter() - enemyBody.rect.getCenter());
+			playerPushingForces.friction = 1.f;
 		}
 	}
 }
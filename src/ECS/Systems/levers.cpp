@@ -16,7 +16,7 @@ void Levers::onEvent(const ActionEvent& event)
 {
 	if (event.mType == ActionEvent::Pressed)
 	{
-		if (event.mAction == "use")
+		if (event.mAction == Actions::Use)
 			handleUsedLevers();
 	}
 }
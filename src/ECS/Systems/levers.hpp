@@ -13,6 +13,7 @@ public:
 
 	void update(float dt) override;
 	void onEvent(const ActionEvent& event) override;
+	ActionMask getSubscribedActions() const override { return makeActionMask(Actions::Use); }
 
 private:
 	void handleUsedLevers() const;
@@ -13,7 +13,7 @@ namespace ph::system {
 
 void MeleeAttacks::onEvent(const ActionEvent& e)
 {
-	if(e.mType == ActionEvent::Type::Pressed && e.mAction == "meleeAttack" && !mShouldWeaponBeRendered)
+	if(e.mType == ActionEvent::Type::Pressed && e.mAction == Actions::MeleeAttack && !mShouldWeaponBeRendered)
 		mIsAttackButtonPressed = true;
 }
 
@@ -13,6 +13,7 @@ namespace ph::system {
 		using System::System;
 
 		void onEvent(const ActionEvent&)override;
+		ActionMask getSubscribedActions() const override { return makeActionMask(Actions::MeleeAttack); }
 		void update(float dt) override;
 
 	private:
@@ -4,10 +4,17 @@
 #include "Utilities/random.hpp"
 #include "Utilities/profiling.hpp"
 #include "Renderer/renderer.hpp"
+#include <algorithm>
 #include <cmath>
 
 namespace ph::system {
 
+PatricleSystem::PatricleSystem(entt::registry& registry)
+	:System(registry)
+	,mRandom(Random::makeStream(Random::Streams::Particles))
+{
+}
+
 void PatricleSystem::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
@@ -16,7 +23,7 @@ void PatricleSystem::update(float dt)
 	updateMultiParticleEmitters(dt);
 }
 
-void PatricleSystem::updateSingleParticleEmitters(const float dt) const
+void PatricleSystem::updateSingleParticleEmitters(const float dt)
 {
 	auto view = mRegistry.view<component::ParticleEmitter, component::BodyRect>();
 	view.each([dt, this](component::ParticleEmitter& emi, const component::BodyRect& body)
@@ -25,7 +32,7 @@ void PatricleSystem::updateSingleParticleEmitters(const float dt) const
 	});
 }
 
-void PatricleSystem::updateMultiParticleEmitters(const float dt) const
+void PatricleSystem::updateMultiParticleEmitters(const float dt)
 {
 	auto view = mRegistry.view<component::MultiParticleEmitter, component::BodyRect>();
 	view.each([dt, this](component::MultiParticleEmitter& multiEmi, const component::BodyRect& body)
@@ -34,17 +41,14 @@ void PatricleSystem::updateMultiParticleEmitters(const float dt) const
 		for(auto& particleEmitter : multiEmi.particleEmitters)
 			updateParticleEmitter(dt, particleEmitter, body);
 
-		// erase dead particle emitters from multi particle emitter
-		for(auto it = multiEmi.particleEmitters.begin(); it != multiEmi.particleEmitters.end();) {
-			if(it->oneShot && it->particles.empty())
-				it = multiEmi.particleEmitters.erase(it);
-			else
-				++it;
-		}
+		// NOTE: Finished one shot emitters are kept, so their particles memory can be reused by next one shot
+		for(auto& particleEmitter : multiEmi.particleEmitters)
+			if(particleEmitter.oneShot && particleEmitter.particles.empty())
+				particleEmitter.isEmitting = false;
 	});
 }
 
-void PatricleSystem::updateParticleEmitter(const float dt, component::ParticleEmitter& emi, const component::BodyRect& body) const
+void PatricleSystem::updateParticleEmitter(const float dt, component::ParticleEmitter& emi, const component::BodyRect& body)
 {
 	// exit if is not emitting
 	if(!emi.isEmitting)
@@ -63,50 +67,90 @@ void PatricleSystem::updateParticleEmitter(const float dt, component::ParticleEm
 	// add particles
 	if(!emi.oneShot || emi.amountOfAlreadySpawnParticles < emi.amountOfParticles)
 	{
-		auto addParticle = [](component::ParticleEmitter& emi, const component::BodyRect& body) 
-		{
-			Particle particle;
-
-			particle.position = body.rect.getTopLeft() + emi.spawnPositionOffset;
-
-			if(emi.randomSpawnAreaSize != sf::Vector2f(0.f, 0.f))
-				particle.position += Random::generateVector({0.f, 0.f}, emi.randomSpawnAreaSize);
-
-			if(emi.parInitialVelocity == emi.parInitialVelocityRandom)
-				particle.velocity = emi.parInitialVelocity;
-			else
-				particle.velocity = Random::generateVector(emi.parInitialVelocity, emi.parInitialVelocityRandom);
-				
-			emi.particles.emplace_back(particle);
-		};
-
+		unsigned nrOfParticlesToAdd = 0;
 		if(emi.oneShot || static_cast<float>(emi.amountOfParticles) > emi.parWholeLifetime * 60.f)
 		{
-			float nrOfParticlesPerFrame = float(emi.amountOfParticles / unsigned(emi.parWholeLifetime * 60.f));
-			unsigned nrOfParticlesAddedInThisFrame = 0;
-			while((emi.particles.size() < emi.amountOfParticles) && 
-				    (emi.oneShot || nrOfParticlesAddedInThisFrame < nrOfParticlesPerFrame))
-			{
-				++nrOfParticlesAddedInThisFrame;
-				addParticle(emi, body);
-			}
-			emi.amountOfAlreadySpawnParticles += nrOfParticlesAddedInThisFrame;
+			const unsigned nrOfMissingParticles = emi.amountOfParticles - std::min(emi.amountOfParticles, static_cast<unsigned>(emi.particles.size()));
+			if(emi.oneShot)
+				nrOfParticlesToAdd = nrOfMissingParticles;
+			else
+				nrOfParticlesToAdd = std::min(nrOfMissingParticles, emi.amountOfParticles / unsigned(emi.parWholeLifetime * 60.f));
 		}
 		else if((emi.particles.size() < emi.amountOfParticles) && 
 			(emi.particles.empty() || emi.particles.back().lifetime > emi.parWholeLifetime / emi.amountOfParticles))
 		{
-			addParticle(emi, body);
-			++emi.amountOfAlreadySpawnParticles;
+			nrOfParticlesToAdd = 1;
 		}
+
+		spawnParticles(emi, body, nrOfParticlesToAdd);
+		emi.amountOfAlreadySpawnParticles += nrOfParticlesToAdd;
 	}
 
 	for(auto& particle : emi.particles)
 	{
-		// update particle
 		particle.lifetime += dt;
 		particle.velocity += emi.parAcceleration * dt;
 		particle.position += particle.velocity * dt;
+	}
+}
 
+void PatricleSystem::spawnParticles(component::ParticleEmitter& emi, const component::BodyRect& body, unsigned count)
+{
+	if(count == 0)
+		return;
+
+	const std::size_t firstNewParticle = emi.particles.size();
+	emi.particles.resize(firstNewParticle + count);
+	Particle* newParticles = emi.particles.data() + firstNewParticle;
+
+	// NOTE: Random offsets and velocities of all new particles are generated in batches
+	const sf::Vector2f spawnPosition = body.rect.getTopLeft() + emi.spawnPositionOffset;
+	if(emi.randomSpawnAreaSize != sf::Vector2f(0.f, 0.f)) {
+		mRandomVectors.resize(count);
+		mRandom.generateVectors(mRandomVectors.data(), count, {0.f, 0.f}, emi.randomSpawnAreaSize);
+		for(unsigned i = 0; i < count; ++i)
+			newParticles[i].position = spawnPosition + mRandomVectors[i];
+	}
+	else {
+		for(unsigned i = 0; i < count; ++i)
+			newParticles[i].position = spawnPosition;
+	}
+
+	if(emi.parInitialVelocity != emi.parInitialVelocityRandom) {
+		mRandomVectors.resize(count);
+		mRandom.generateVectors(mRandomVectors.data(), count, emi.parInitialVelocity, emi.parInitialVelocityRandom);
+		for(unsigned i = 0; i < count; ++i)
+			newParticles[i].velocity = mRandomVectors[i];
+	}
+	else {
+		for(unsigned i = 0; i < count; ++i)
+			newParticles[i].velocity = emi.parInitialVelocity;
+	}
+}
+
+void PatricleSystem::render(float)
+{
+	PH_PROFILE_FUNCTION();
+
+	auto singleEmitters = mRegistry.view<component::ParticleEmitter, component::BodyRect>();
+	singleEmitters.each([](const component::ParticleEmitter& emi, const component::BodyRect&) {
+		submitParticles(emi);
+	});
+
+	auto multiEmitters = mRegistry.view<component::MultiParticleEmitter, component::BodyRect>();
+	multiEmitters.each([](const component::MultiParticleEmitter& multiEmi, const component::BodyRect&) {
+		for(const auto& particleEmitter : multiEmi.particleEmitters)
+			submitParticles(particleEmitter);
+	});
+}
+
+void PatricleSystem::submitParticles(const component::ParticleEmitter& emi)
+{
+	if(!emi.isEmitting)
+		return;
+
+	for(const auto& particle : emi.particles)
+	{
 		// compute current particle color
 		sf::Color color = emi.parStartColor;
 		if(emi.parStartColor != emi.parEndColor) {
@@ -120,7 +164,7 @@ void PatricleSystem::updateParticleEmitter(const float dt, component::ParticleEm
 
 		// submit particle to renderer
 		if(emi.parTexture)
-			Renderer::submitQuad(emi.parTexture, nullptr, &color, nullptr, particle.position, emi.parSize, emi.parZ, 0.f, {});
+			Renderer::submitQuad(emi.parTexture.get(), emi.parTextureRect.width ? &emi.parTextureRect : nullptr, &color, nullptr, particle.position, emi.parSize, emi.parZ, 0.f, {});
 		else if(emi.parSize.x != emi.parSize.y)
 			Renderer::submitQuad(nullptr, nullptr, &color, nullptr, particle.position, emi.parSize, emi.parZ, 0.f, {});
 		else
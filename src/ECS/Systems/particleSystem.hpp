@@ -1,6 +1,9 @@
 #pragma once
 
 #include "ECS/system.hpp"
+#include "Utilities/random.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <vector>
 
 namespace ph::component {
 	struct ParticleEmitter;
@@ -12,14 +15,21 @@ namespace ph::system {
 class PatricleSystem : public System
 {
 public:
-	using System::System;
+	PatricleSystem(entt::registry&);
 
 	void update(float dt) override;
+	void render(float interpolation) override;
 
 private:
-	void updateSingleParticleEmitters(const float dt) const;
-	void updateMultiParticleEmitters(const float dt) const;
-	void updateParticleEmitter(const float dt, ph::component::ParticleEmitter&, const ph::component::BodyRect&) const;
+	void updateSingleParticleEmitters(const float dt);
+	void updateMultiParticleEmitters(const float dt);
+	void updateParticleEmitter(const float dt, ph::component::ParticleEmitter&, const ph::component::BodyRect&);
+	void spawnParticles(ph::component::ParticleEmitter&, const ph::component::BodyRect&, unsigned count);
+	static void submitParticles(const ph::component::ParticleEmitter&);
+
+private:
+	RandomGenerator mRandom;
+	std::vector<sf::Vector2f> mRandomVectors;
 };
 
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "ECS/Components/charactersComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
 #include "ECS/Components/itemComponents.hpp"
+#include "ECS/Components/triggerComponents.hpp"
 #include "Utilities/profiling.hpp"
 
 namespace ph::system {
@@ -10,38 +11,32 @@ namespace ph::system {
 	{
 		PH_PROFILE_FUNCTION();
 
-		auto players = mRegistry.view<component::Player, component::BodyRect, component::Health, component::Bullets>();
-		auto medkits = mRegistry.view<component::Medkit, component::BodyRect>();
-		auto bulletBoxes = mRegistry.view<component::BulletBox, component::Bullets, component::BodyRect>();
+		auto& triggerEvents = mRegistry.ctx<TriggerEvents>();
 
-		for (auto player : players)
+		for (const auto& event : triggerEvents.get(TriggerKind::Medkit))
 		{
-			const auto& playerBody  = players.get<component::BodyRect>(player);
-			auto& [playerHealth, playerBullets] = players.get<component::Health, component::Bullets>(player);
-			
-			for (auto medkitEntity : medkits)
-			{
-				const auto& [medkit, medkitBody] = medkits.get<component::Medkit, component::BodyRect>(medkitEntity);
+			if (event.phase != TriggerPhase::Enter || !mRegistry.has<component::Health>(event.activator))
+				continue;
 
-				if (playerBody.rect.doPositiveRectsIntersect(medkitBody.rect)) {
-					if (playerHealth.healthPoints + medkit.addHealthPoints < playerHealth.maxHealthPoints)
-						playerHealth.healthPoints += medkit.addHealthPoints;
-					else
-						playerHealth.healthPoints = playerHealth.maxHealthPoints;
-					mRegistry.assign<component::TaggedToDestroy>(medkitEntity);
-				}
-			}
+			const auto& medkit = mRegistry.get<component::Medkit>(event.trigger);
+			auto& playerHealth = mRegistry.get<component::Health>(event.activator);
+			if (playerHealth.healthPoints + medkit.addHealthPoints < playerHealth.maxHealthPoints)
+				playerHealth.healthPoints += medkit.addHealthPoints;
+			else
+				playerHealth.healthPoints = playerHealth.maxHealthPoints;
+			mRegistry.assign_or_replace<component::TaggedToDestroy>(event.trigger);
+		}
 
-			for (auto bulletBoxEntity : bulletBoxes)
-			{
-				const auto& [bulletBoxBullets, bulletBoxBody] = bulletBoxes.get<component::Bullets, component::BodyRect>(bulletBoxEntity);
+		for (const auto& event : triggerEvents.get(TriggerKind::BulletBox))
+		{
+			if (event.phase != TriggerPhase::Enter || !mRegistry.has<component::Bullets>(event.activator))
+				continue;
 
-				if (playerBody.rect.doPositiveRectsIntersect(bulletBoxBody.rect)) {
-					playerBullets.numOfPistolBullets += bulletBoxBullets.numOfPistolBullets;
-					playerBullets.numOfShotgunBullets += bulletBoxBullets.numOfShotgunBullets;
-					mRegistry.assign<component::TaggedToDestroy>(bulletBoxEntity);
-				}
-			}
+			const auto& bulletBoxBullets = mRegistry.get<component::Bullets>(event.trigger);
+			auto& playerBullets = mRegistry.get<component::Bullets>(event.activator);
+			playerBullets.numOfPistolBullets += bulletBoxBullets.numOfPistolBullets;
+			playerBullets.numOfShotgunBullets += bulletBoxBullets.numOfShotgunBullets;
+			mRegistry.assign_or_replace<component::TaggedToDestroy>(event.trigger);
 		}
 	}
 }
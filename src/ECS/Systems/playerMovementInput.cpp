@@ -51,7 +51,7 @@ namespace ph::system {
 		if(event.mType == ActionEvent::Type::Pressed)
 		{
 			// TODO_states: Pause screen could be handled by states
-			if(event.mAction == "pauseScreen") 
+			if(event.mAction == Actions::PauseScreen) 
 			{
 				auto players = mRegistry.view<component::Player, component::Health>();
 				players.each([this](component::Player, component::Health) {
@@ -73,10 +73,10 @@ namespace ph::system {
 
 	void PlayerMovementInput::updateInputFlags()
 	{
-		mUp    = ActionEventManager::isActionPressed("movingUp");
-		mDown  = ActionEventManager::isActionPressed("movingDown");
-		mLeft  = ActionEventManager::isActionPressed("movingLeft");
-		mRight = ActionEventManager::isActionPressed("movingRight");
+		mUp    = ActionEventManager::isActionPressed(Actions::MovingUp);
+		mDown  = ActionEventManager::isActionPressed(Actions::MovingDown);
+		mLeft  = ActionEventManager::isActionPressed(Actions::MovingLeft);
+		mRight = ActionEventManager::isActionPressed(Actions::MovingRight);
 	}
 
 	void PlayerMovementInput::updateAnimationData()
@@ -87,27 +87,27 @@ namespace ph::system {
 			auto& animationData = view.get<component::AnimationData>(entity);
 
 			if(mUp && mLeft) {
-				animationData.currentStateName = "leftUp";
+				animationData.currentStateId = animationStates::leftUp;
 				animationData.isPlaying = true;
 			}
 			else if(mUp && mRight) {
-				animationData.currentStateName = "rightUp";
+				animationData.currentStateId = animationStates::rightUp;
 				animationData.isPlaying = true;
 			}
 			else if(mLeft) {
-				animationData.currentStateName = "left";
+				animationData.currentStateId = animationStates::left;
 				animationData.isPlaying = true;
 			}
 			else if(mRight) {
-				animationData.currentStateName = "right";
+				animationData.currentStateId = animationStates::right;
 				animationData.isPlaying = true;
 			}
 			else if(mUp) {
-				animationData.currentStateName = "up";
+				animationData.currentStateId = animationStates::up;
 				animationData.isPlaying = true;
 			}
 			else if(mDown) {
-				animationData.currentStateName = "down";
+				animationData.currentStateId = animationStates::down;
 				animationData.isPlaying = true;
 			}
 			else {
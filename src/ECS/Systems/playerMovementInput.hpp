@@ -18,6 +18,7 @@ namespace system {
 
 		void update(float dt) override;
 		void onEvent(const ActionEvent& event) override;
+		ActionMask getSubscribedActions() const override { return makeActionMask(Actions::PauseScreen); }
 
 	private:
 		bool isPlayerWithoutControl();
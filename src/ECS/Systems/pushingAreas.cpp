@@ -2,6 +2,7 @@
 
 #include "ECS/Components/objectsComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
+#include "ECS/Components/triggerComponents.hpp"
 
 #include "Utilities/profiling.hpp"
 
@@ -11,23 +12,15 @@ void PushingAreas::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
 
-	auto pushingAreasView = mRegistry.view<component::PushingArea, component::BodyRect>();
-	auto kinematicObjects = mRegistry.view<component::BodyRect, component::Velocity>();
-
-	for (auto pushingArea : pushingAreasView)
+	for (const auto& event : mRegistry.ctx<TriggerEvents>().get(TriggerKind::PushingArea))
 	{
-		const auto& [pushingAreaDetails, areaBody] = pushingAreasView.get<component::PushingArea, component::BodyRect>(pushingArea);
+		if (event.phase == TriggerPhase::Exit)
+			continue;
 
-		for (auto kinematicObject : kinematicObjects)
-		{
-			auto& objectVelocity = kinematicObjects.get<component::Velocity>(kinematicObject);
-			const auto& kinematicObjectBody = kinematicObjects.get<component::BodyRect>(kinematicObject);
-			if (areaBody.rect.contains(kinematicObjectBody.rect.getCenter()))
-			{
-				objectVelocity.dx += pushingAreaDetails.pushForce.x;
-				objectVelocity.dy += pushingAreaDetails.pushForce.y;
-			}
-		}
+		const auto& pushingAreaDetails = mRegistry.get<component::PushingArea>(event.trigger);
+		auto& objectVelocity = mRegistry.get<component::Velocity>(event.activator);
+		objectVelocity.dx += pushingAreaDetails.pushForce.x;
+		objectVelocity.dy += pushingAreaDetails.pushForce.y;
 	}
 }
 
@@ -11,6 +11,16 @@
 
 namespace {
 	ph::Camera defaultCamera;
+
+	sf::Vector2f interpolate(sf::Vector2f previous, sf::Vector2f current, float interpolation)
+	{
+		// NOTE: Bodies which moved that far in one step were teleported, so they aren't interpolated
+		constexpr float maxInterpolatedDistance = 32.f;
+		const sf::Vector2f difference = current - previous;
+		if(difference.x * difference.x + difference.y * difference.y > maxInterpolatedDistance * maxInterpolatedDistance)
+			return current;
+		return previous + difference * interpolation;
+	}
 }
 
 namespace ph::system {
@@ -25,61 +35,110 @@ void RenderSystem::update(float dt)
 {
 	PH_PROFILE_FUNCTION();
 
+	// NOTE: It's the first system, so it stores positions from the end of previous simulation step
+	auto bodies = mRegistry.view<component::RenderQuad, component::BodyRect>();
+	for(auto entity : bodies)
+		mRegistry.assign_or_replace<component::PreviousBodyPosition>(entity, bodies.get<component::BodyRect>(entity).rect.getTopLeft());
+
+	auto cameras = mRegistry.view<component::Camera>();
+	cameras.each([](component::Camera& camera) {
+		camera.previousCenter = camera.camera.getCenter();
+	});
+}
+
+void RenderSystem::render(float interpolation)
+{
+	PH_PROFILE_FUNCTION();
+
 	// get current camera
 	auto cameras = mRegistry.view<component::Camera>();
-	Camera* currentCamera = &defaultCamera;
-	cameras.each([&currentCamera](component::Camera& camera) {
-		if(camera.name == component::Camera::currentCameraName)
-			currentCamera = &camera.camera;
+	Camera currentCamera = defaultCamera;
+	cameras.each([&currentCamera, interpolation](component::Camera& camera) {
+		if(camera.name == component::Camera::currentCameraName) {
+			currentCamera = camera.camera;
+			currentCamera.setCenter(interpolate(camera.previousCenter, camera.camera.getCenter(), interpolation));
+		}
 	});
 
 	// begin scene
-	Renderer::beginScene(*currentCamera);
+	Renderer::beginScene(currentCamera);
 
 	// submit light sources
 	auto lightSources = mRegistry.view<component::LightSource, component::BodyRect>();
-	lightSources.each([](const component::LightSource& pointLight, const component::BodyRect& body)
+	lightSources.each([this, interpolation](entt::entity entity, const component::LightSource& pointLight, const component::BodyRect& body)
 	{
 		PH_ASSERT_UNEXPECTED_SITUATION(pointLight.startAngle <= pointLight.endAngle, "start angle must be lesser or equal to end angle");
-		Renderer::submitLight(pointLight.color, body.rect.getTopLeft() + pointLight.offset, pointLight.startAngle, pointLight.endAngle,
+		Renderer::submitLight(pointLight.color, getInterpolatedPosition(entity, body, interpolation) + pointLight.offset, pointLight.startAngle, pointLight.endAngle,
 			pointLight.attenuationAddition, pointLight.attenuationFactor, pointLight.attenuationSquareFactor);
 	});
 
 	//submit light walls
+	// NOTE: Only walls of rendered bodies have previous position, other walls are parts of map which doesn't move
 	auto lightWalls = mRegistry.view<component::LightWall, component::BodyRect>();
-	lightWalls.each([](const component::LightWall& bl, const component::BodyRect& body) 
+	lightWalls.each([this, interpolation](entt::entity entity, const component::LightWall& bl, const component::BodyRect& body) 
 	{
+		const sf::Vector2f position = getInterpolatedPosition(entity, body, interpolation);
 		if(bl.rect.top == -1.f)
-			Renderer::submitLightBlockingQuad(body.rect.getTopLeft(), body.rect.getSize());
+			Renderer::submitLightBlockingQuad(position, body.rect.getSize());
 		else
-			Renderer::submitLightBlockingQuad(body.rect.getTopLeft() + bl.rect.getTopLeft(), bl.rect.getSize());
+			Renderer::submitLightBlockingQuad(position + bl.rect.getTopLeft(), bl.rect.getSize());
 	});
 
 	// submit map chunks
 	auto renderChunks = mRegistry.view<component::RenderChunk>();
-	renderChunks.each([this, currentCamera](component::RenderChunk& chunk)
+	const FloatRect cameraBounds = currentCamera.getBounds();
+	renderChunks.each([this, &cameraBounds](component::RenderChunk& chunk)
 	{
-		if(currentCamera->getBounds().doPositiveRectsIntersect(chunk.bounds))
+		if(cameraBounds.doPositiveRectsIntersect(chunk.bounds))
 			Renderer::submitBunchOfQuadsWithTheSameTexture(chunk.quads, &mTilesetTexture, nullptr, chunk.z);
 	});
 
 	// submit render quads
-	auto renderQuads = mRegistry.view<component::RenderQuad, component::BodyRect>(entt::exclude<component::HiddenForRenderer, component::TextureRect>);
-	renderQuads.each([](const component::RenderQuad& quad, const component::BodyRect& body)
+	auto renderQuads = mRegistry.view<component::RenderQuad, component::BodyRect>(entt::exclude<component::HiddenForRenderer, component::TextureRect, component::AtlasRegion>);
+	renderQuads.each([this, interpolation](entt::entity entity, const component::RenderQuad& quad, const component::BodyRect& body)
 	{
 		Renderer::submitQuad(
-			quad.texture, nullptr, &quad.color, quad.shader,
-			body.rect.getTopLeft(), body.rect.getSize(), quad.z, quad.rotation, quad.rotationOrigin);
+			quad.texture.get(), nullptr, &quad.color, quad.shader,
+			getInterpolatedPosition(entity, body, interpolation), body.rect.getSize(), quad.z, quad.rotation, quad.rotationOrigin);
 	});
 	
 	// submit render quads with texture rect
-	auto renderQuadsWithTextureRect = mRegistry.view<component::RenderQuad, component::TextureRect, component::BodyRect>(entt::exclude<component::HiddenForRenderer>);
-	renderQuadsWithTextureRect.each([](const component::RenderQuad& quad, const component::TextureRect& textureRect, const component::BodyRect& body)
+	auto renderQuadsWithTextureRect = mRegistry.view<component::RenderQuad, component::TextureRect, component::BodyRect>(entt::exclude<component::HiddenForRenderer, component::AtlasRegion>);
+	renderQuadsWithTextureRect.each([this, interpolation](entt::entity entity, const component::RenderQuad& quad, const component::TextureRect& textureRect, const component::BodyRect& body)
 	{
 		Renderer::submitQuad(
-			quad.texture, &textureRect.rect, &quad.color, quad.shader,
-			body.rect.getTopLeft(), body.rect.getSize(), quad.z, quad.rotation, quad.rotationOrigin);
+			quad.texture.get(), &textureRect.rect, &quad.color, quad.shader,
+			getInterpolatedPosition(entity, body, interpolation), body.rect.getSize(), quad.z, quad.rotation, quad.rotationOrigin);
 	});
+
+	// submit render quads baked into atlas
+	auto atlasRenderQuads = mRegistry.view<component::RenderQuad, component::AtlasRegion, component::BodyRect>(entt::exclude<component::HiddenForRenderer, component::TextureRect>);
+	atlasRenderQuads.each([this, interpolation](entt::entity entity, const component::RenderQuad& quad, const component::AtlasRegion& atlasRegion, const component::BodyRect& body)
+	{
+		Renderer::submitQuad(
+			quad.texture.get(), &atlasRegion.rect, &quad.color, quad.shader,
+			getInterpolatedPosition(entity, body, interpolation), body.rect.getSize(), quad.z, quad.rotation, quad.rotationOrigin);
+	});
+
+	// submit render quads with texture rect baked into atlas
+	auto atlasRenderQuadsWithTextureRect = mRegistry.view<component::RenderQuad, component::TextureRect, component::AtlasRegion, component::BodyRect>(entt::exclude<component::HiddenForRenderer>);
+	atlasRenderQuadsWithTextureRect.each([this, interpolation](entt::entity entity, const component::RenderQuad& quad, const component::TextureRect& textureRect,
+	                                                           const component::AtlasRegion& atlasRegion, const component::BodyRect& body)
+	{
+		IntRect rect = textureRect.rect;
+		rect.move(atlasRegion.rect.getTopLeft());
+		Renderer::submitQuad(
+			quad.texture.get(), &rect, &quad.color, quad.shader,
+			getInterpolatedPosition(entity, body, interpolation), body.rect.getSize(), quad.z, quad.rotation, quad.rotationOrigin);
+	});
+}
+
+sf::Vector2f RenderSystem::getInterpolatedPosition(entt::entity entity, const component::BodyRect& body, float interpolation) const
+{
+	const sf::Vector2f currentPosition = body.rect.getTopLeft();
+	if(const auto* previousPosition = mRegistry.try_get<component::PreviousBodyPosition>(entity))
+		return interpolate(previousPosition->position, currentPosition, interpolation);
+	return currentPosition;
 }
 
 }
@@ -8,6 +8,10 @@ namespace ph {
 	class Texture;
 }
 
+namespace ph::component {
+	struct BodyRect;
+}
+
 namespace ph::system {
 
 class RenderSystem : public System
@@ -16,6 +20,10 @@ public:
 	RenderSystem(entt::registry& registry, Texture& tileset);
 
 	void update(float dt) override;
+	void render(float interpolation) override;
+
+private:
+	sf::Vector2f getInterpolatedPosition(entt::entity, const component::BodyRect&, float interpolation) const;
 
 private:
 	Texture& mTilesetTexture;
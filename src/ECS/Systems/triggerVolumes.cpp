@@ -0,0 +1,210 @@
+#include "triggerVolumes.hpp"
+#include "ECS/Components/physicsComponents.hpp"
+#include "ECS/Components/charactersComponents.hpp"
+#include "ECS/Components/objectsComponents.hpp"
+#include "ECS/Components/itemComponents.hpp"
+#include "Utilities/profiling.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace ph::system {
+
+namespace {
+	constexpr float cellSize = 256.f;
+}
+
+template<TriggerKind kind, typename... AreaComponents>
+void TriggerVolumes::registerTriggers()
+{
+	auto newTriggers = mRegistry.view<AreaComponents..., component::BodyRect>(entt::exclude<component::TriggerVolume>);
+	for(auto trigger : newTriggers)
+	{
+		const FloatRect rect = getTriggerRect(kind, newTriggers.template get<component::BodyRect>(trigger).rect);
+		mRegistry.assign<component::TriggerVolume>(trigger, kind, rect);
+		insertToGrid(trigger, rect);
+	}
+}
+
+template<typename Function>
+void TriggerVolumes::forEachCell(const FloatRect& rect, Function function)
+{
+	const int left = static_cast<int>(std::floor(rect.left / cellSize));
+	const int top = static_cast<int>(std::floor(rect.top / cellSize));
+	const int right = static_cast<int>(std::floor((rect.left + rect.width) / cellSize));
+	const int bottom = static_cast<int>(std::floor((rect.top + rect.height) / cellSize));
+
+	for(int y = top; y <= bottom; ++y)
+		for(int x = left; x <= right; ++x)
+			function((std::uint64_t(std::uint32_t(x)) << 32) | std::uint32_t(y));
+}
+
+TriggerVolumes::TriggerVolumes(entt::registry& registry)
+	:System(registry)
+{
+	mRegistry.set<TriggerEvents>();
+	mRegistry.on_destroy<component::TriggerVolume>().connect<&TriggerVolumes::onTriggerVolumeDestroyed>(*this);
+}
+
+TriggerVolumes::~TriggerVolumes()
+{
+	mRegistry.on_destroy<component::TriggerVolume>().disconnect<&TriggerVolumes::onTriggerVolumeDestroyed>(*this);
+}
+
+void TriggerVolumes::update(float dt)
+{
+	PH_PROFILE_FUNCTION();
+
+	registerTriggers<TriggerKind::Entrance, component::Entrance>();
+	registerTriggers<TriggerKind::Hint, component::Hint>();
+	registerTriggers<TriggerKind::CutScene, component::CutScene>();
+	registerTriggers<TriggerKind::Medkit, component::Medkit>();
+	registerTriggers<TriggerKind::BulletBox, component::BulletBox>();
+	registerTriggers<TriggerKind::VelocityChangingArea, component::AreaVelocityChangingEffect>();
+	registerTriggers<TriggerKind::PushingArea, component::PushingArea>();
+	registerTriggers<TriggerKind::HostileCollision, component::Damage, component::CollisionWithPlayer>();
+
+	updateIndex();
+	findOverlaps();
+	publishEvents();
+}
+
+void TriggerVolumes::updateIndex()
+{
+	// NOTE: Most of triggers never move, only moved ones are reinserted
+	auto triggers = mRegistry.view<component::TriggerVolume, component::BodyRect>();
+	for(auto trigger : triggers)
+	{
+		auto [volume, body] = triggers.get<component::TriggerVolume, component::BodyRect>(trigger);
+		const FloatRect rect = getTriggerRect(volume.kind, body.rect);
+		if(rect == volume.indexedRect)
+			continue;
+		removeFromGrid(trigger, volume.indexedRect);
+		insertToGrid(trigger, rect);
+		volume.indexedRect = rect;
+	}
+}
+
+void TriggerVolumes::findOverlaps()
+{
+	std::swap(mOverlaps, mPreviousOverlaps);
+	mOverlaps.clear();
+
+	// NOTE: Everything that can move can activate triggers, player has Velocity too
+	auto activators = mRegistry.view<component::BodyRect, component::Velocity>();
+	for(auto activator : activators)
+	{
+		const auto& activatorBody = activators.get<component::BodyRect>(activator).rect;
+
+		mCandidates.clear();
+		forEachCell(activatorBody, [this](std::uint64_t cell) {
+			auto found = mGrid.find(cell);
+			if(found != mGrid.end())
+				mCandidates.insert(mCandidates.end(), found->second.begin(), found->second.end());
+		});
+		std::sort(mCandidates.begin(), mCandidates.end());
+		mCandidates.erase(std::unique(mCandidates.begin(), mCandidates.end()), mCandidates.end());
+
+		for(auto trigger : mCandidates)
+		{
+			if(trigger == activator)
+				continue;
+			const auto& volume = mRegistry.get<component::TriggerVolume>(trigger);
+			if(isActivatedBy(volume.kind, volume.indexedRect, activator, activatorBody))
+				mOverlaps.emplace_back(Overlap{trigger, activator});
+		}
+	}
+
+	std::sort(mOverlaps.begin(), mOverlaps.end());
+}
+
+void TriggerVolumes::publishEvents()
+{
+	auto& triggerEvents = mRegistry.ctx<TriggerEvents>();
+	for(auto& events : triggerEvents.events)
+		events.clear();
+
+	auto publish = [this, &triggerEvents](const Overlap& overlap, TriggerPhase phase) {
+		const auto& volume = mRegistry.get<component::TriggerVolume>(overlap.trigger);
+		triggerEvents.get(volume.kind).emplace_back(TriggerEvent{overlap.trigger, overlap.activator, phase});
+	};
+
+	auto current = mOverlaps.begin();
+	auto previous = mPreviousOverlaps.begin();
+	while(current != mOverlaps.end() || previous != mPreviousOverlaps.end())
+	{
+		if(previous == mPreviousOverlaps.end() || (current != mOverlaps.end() && *current < *previous)) {
+			publish(*current++, TriggerPhase::Enter);
+		}
+		else if(current == mOverlaps.end() || *previous < *current) {
+			// NOTE: Destroyed entities and entities without body don't exit triggers
+			if(mRegistry.valid(previous->trigger) && mRegistry.valid(previous->activator) && mRegistry.has<component::TriggerVolume>(previous->trigger)
+			   && mRegistry.has<component::BodyRect>(previous->activator))
+				publish(*previous, TriggerPhase::Exit);
+			++previous;
+		}
+		else {
+			publish(*current++, TriggerPhase::Stay);
+			++previous;
+		}
+	}
+}
+
+bool TriggerVolumes::isActivatedBy(TriggerKind kind, const FloatRect& triggerRect, entt::entity activator, const FloatRect& activatorBody) const
+{
+	switch(kind)
+	{
+	case TriggerKind::Entrance:
+	case TriggerKind::Hint:
+	case TriggerKind::CutScene:
+		return mRegistry.has<component::Player>(activator) && triggerRect.contains(activatorBody.getCenter());
+	case TriggerKind::Medkit:
+	case TriggerKind::BulletBox:
+	case TriggerKind::HostileCollision:
+		return mRegistry.has<component::Player>(activator) && triggerRect.doPositiveRectsIntersect(activatorBody);
+	case TriggerKind::VelocityChangingArea:
+		return mRegistry.has<component::KinematicCollisionBody>(activator) && triggerRect.contains(activatorBody.getCenter());
+	case TriggerKind::PushingArea:
+		return triggerRect.contains(activatorBody.getCenter());
+	default:
+		return false;
+	}
+}
+
+FloatRect TriggerVolumes::getTriggerRect(TriggerKind kind, const FloatRect& triggerBody)
+{
+	// NOTE: Entrance trigger covers also the area in which its destination scene is prefetched
+	if(kind != TriggerKind::Entrance)
+		return triggerBody;
+	const float radius = component::Entrance::prefetchRadius;
+	return FloatRect(triggerBody.left - radius, triggerBody.top - radius, triggerBody.width + 2.f * radius, triggerBody.height + 2.f * radius);
+}
+
+void TriggerVolumes::onTriggerVolumeDestroyed(entt::entity trigger, entt::registry& registry)
+{
+	removeFromGrid(trigger, registry.get<component::TriggerVolume>(trigger).indexedRect);
+
+	// NOTE: Pooled entities are reused with the same id, so reused trigger has to be entered again
+	mOverlaps.erase(std::remove_if(mOverlaps.begin(), mOverlaps.end(), [trigger](const Overlap& overlap) {
+		return overlap.trigger == trigger;
+	}), mOverlaps.end());
+}
+
+void TriggerVolumes::insertToGrid(entt::entity trigger, const FloatRect& rect)
+{
+	forEachCell(rect, [this, trigger](std::uint64_t cell) {
+		mGrid[cell].emplace_back(trigger);
+	});
+}
+
+void TriggerVolumes::removeFromGrid(entt::entity trigger, const FloatRect& rect)
+{
+	forEachCell(rect, [this, trigger](std::uint64_t cell) {
+		auto found = mGrid.find(cell);
+		if(found == mGrid.end())
+			return;
+		auto& cellTriggers = found->second;
+		cellTriggers.erase(std::remove(cellTriggers.begin(), cellTriggers.end(), trigger), cellTriggers.end());
+	});
+}
+
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "ECS/system.hpp"
+#include "ECS/Components/triggerComponents.hpp"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace ph::system {
+
+// NOTE: Computes overlaps of trigger areas with moving bodies once per frame using spatial hash grid
+//       and publishes them as enter/stay/exit events in TriggerEvents registry context variable.
+class TriggerVolumes : public System
+{
+public:
+	explicit TriggerVolumes(entt::registry&);
+	~TriggerVolumes();
+
+	void update(float dt) override;
+
+private:
+	template<TriggerKind kind, typename... AreaComponents>
+	void registerTriggers();
+	void updateIndex();
+	void findOverlaps();
+	void publishEvents();
+
+	bool isActivatedBy(TriggerKind, const FloatRect& triggerRect, entt::entity activator, const FloatRect& activatorBody) const;
+	static FloatRect getTriggerRect(TriggerKind, const FloatRect& triggerBody);
+
+	void onTriggerVolumeDestroyed(entt::entity, entt::registry&);
+	void insertToGrid(entt::entity, const FloatRect&);
+	void removeFromGrid(entt::entity, const FloatRect&);
+
+	template<typename Function>
+	static void forEachCell(const FloatRect&, Function);
+
+private:
+	struct Overlap
+	{
+		entt::entity trigger;
+		entt::entity activator;
+
+		bool operator<(const Overlap& rhs) const { return trigger < rhs.trigger || (trigger == rhs.trigger && activator < rhs.activator); }
+		bool operator==(const Overlap& rhs) const { return trigger == rhs.trigger && activator == rhs.activator; }
+	};
+
+	std::unordered_map<std::uint64_t, std::vector<entt::entity>> mGrid;
+	std::vector<Overlap> mOverlaps;
+	std::vector<Overlap> mPreviousOverlaps;
+	std::vector<entt::entity> mCandidates;
+};
+
+}
@@ -1,6 +1,7 @@
 #include "velocityChangingAreas.hpp"
 #include "ECS/Components/objectsComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
+#include "ECS/Components/triggerComponents.hpp"
 #include "Utilities/profiling.hpp"
 
 namespace ph::system {
@@ -9,24 +10,15 @@ namespace ph::system {
 	{
 		PH_PROFILE_FUNCTION();
 
-		auto velocityChaningAreasView = mRegistry.view<component::BodyRect, component::AreaVelocityChangingEffect>();
-		auto kinematicObjectsView = mRegistry.view<component::KinematicCollisionBody, component::BodyRect, component::Velocity>();
-
-		for (auto velocityChangingArea : velocityChaningAreasView)
+		for (const auto& event : mRegistry.ctx<TriggerEvents>().get(TriggerKind::VelocityChangingArea))
 		{
-			const auto& [areaBody, velocityChangeEffect] = velocityChaningAreasView.get<component::BodyRect, component::AreaVelocityChangingEffect>(velocityChangingArea);
-			
-			for (auto kinematicObject : kinematicObjectsView)
-			{
-				auto& objectVelocity = kinematicObjectsView.get<component::Velocity>(kinematicObject);
-				const auto& objectBody = kinematicObjectsView.get<component::BodyRect>(kinematicObject);
+			if (event.phase == TriggerPhase::Exit)
+				continue;
 
-				if (areaBody.rect.contains(objectBody.rect.getCenter()))
-				{
-					objectVelocity.dx *= velocityChangeEffect.areaSpeedMultiplier;
-					objectVelocity.dy *= velocityChangeEffect.areaSpeedMultiplier;
-				}
-			}
+			const auto& velocityChangeEffect = mRegistry.get<component::AreaVelocityChangingEffect>(event.trigger);
+			auto& objectVelocity = mRegistry.get<component::Velocity>(event.activator);
+			objectVelocity.dx *= velocityChangeEffect.areaSpeedMultiplier;
+			objectVelocity.dy *= velocityChangeEffect.areaSpeedMultiplier;
 		}
 	}
 }
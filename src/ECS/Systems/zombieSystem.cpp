@@ -37,6 +37,7 @@ namespace ph::system {
 ZombieSystem::ZombieSystem(entt::registry& registry, const AIManager* aiManager)
 	:System(registry)
 	,mAIManager(aiManager)
+	,mRandom(Random::makeStream(Random::Streams::Zombies))
 {
 }
 
@@ -57,7 +58,7 @@ void ZombieSystem::update(float dt)
 		if(zombie.timeFromLastGrowl > 3.f)
 		{
 			zombie.timeFromLastGrowl = 0.f;
-			int randomNumber = Random::generateNumber(1, 4);
+			int randomNumber = mRandom.generateNumber(1, 4);
 			switch(randomNumber)
 			{
 				case 1: mRegistry.assign_or_replace<component::SpatialSound>(zombieEntity, "sounds/zombieGrowl1.ogg"); break;
@@ -90,27 +91,27 @@ void ZombieSystem::update(float dt)
 
 		// update animation
 		if(zombie.currentDirectionVector == PH_NORTH_WEST) {
-			animationData.currentStateName = "leftUp";
+			animationData.currentStateId = animationStates::leftUp;
 			animationData.isPlaying = true;
 		}
 		else if(zombie.currentDirectionVector == PH_NORTH_EAST) {
-			animationData.currentStateName = "rightUp";
+			animationData.currentStateId = animationStates::rightUp;
 			animationData.isPlaying = true;
 		}
 		else if(zombie.currentDirectionVector == PH_WEST || zombie.currentDirectionVector == PH_SOUTH_WEST) {
-			animationData.currentStateName = "left";
+			animationData.currentStateId = animationStates::left;
 			animationData.isPlaying = true;
 		}
 		else if(zombie.currentDirectionVector == PH_EAST || zombie.currentDirectionVector == PH_SOUTH_EAST) {
-			animationData.currentStateName = "right";
+			animationData.currentStateId = animationStates::right;
 			animationData.isPlaying = true;
 		}
 		else if(zombie.currentDirectionVector == PH_NORTH) {
-			animationData.currentStateName = "up";
+			animationData.currentStateId = animationStates::up;
 			animationData.isPlaying = true;
 		}
 		else if(zombie.currentDirectionVector == PH_SOUTH) {
-			animationData.currentStateName = "down";
+			animationData.currentStateId = animationStates::down;
 			animationData.isPlaying = true;
 		}
 		else {
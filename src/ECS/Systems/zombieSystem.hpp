@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ECS/system.hpp"
+#include "Utilities/random.hpp"
 
 namespace ph {
 	class AIManager;	
@@ -17,5 +18,6 @@ namespace ph::system {
 
 	private:
 		const AIManager* mAIManager;
+		RandomGenerator mRandom;
 	};
 }
@@ -8,6 +8,7 @@
 #include "ECS/Components/particleComponents.hpp"
 #include "ECS/Components/aiComponents.hpp"
 #include "ECS/entitiesTemplateStorage.hpp"
+#include "ECS/textureAtlasBaker.hpp"
 #include "Renderer/API/shader.hpp"
 #include "Resources/animationStatesResources.hpp"
 #include "Utilities/xml.hpp"
@@ -27,7 +28,9 @@ void EntitiesParser::parseFile(const std::string& filePath, EntitiesTemplateStor
 {
 	mTextureHolder = &textureHolder;
 
+	// NOTE: Templates of previous scene would never be overwritten, because create() doesn't replace existing names
 	mTemplateStorage = &templateStorage;
+	mTemplateStorage->clear();
 	Xml entitiesFile;
 	entitiesFile.loadFromFile(filePath);
 
@@ -35,6 +38,9 @@ void EntitiesParser::parseFile(const std::string& filePath, EntitiesTemplateStor
 	const Xml entityTemplatesNode = entitiesFile.getChild("entityTemplates");
 	parseTemplates(entityTemplatesNode);
 
+	TextureAtlasBaker atlasBaker(textureHolder);
+	atlasBaker.bake(*mUsedRegistry, filePath);
+
 	// TODO: Enable entities parsing in some form
 	//mUsedRegistry = &gameRegistry;
 	//const Xml entitiesNode = entitiesFile.getChild("entities");
@@ -56,6 +62,8 @@ void EntitiesParser::parseTemplates(const Xml& entityTemplatesNode)
 	{
 		const std::string& templateName = entityTemplate.getAttribute("name").toString();
 		auto entity = mTemplateStorage->create(templateName);
+		if (entityTemplate.hasAttribute("pooled") && entityTemplate.getAttribute("pooled").toBool())
+			mTemplateStorage->setPooled(templateName);
 		if (entityTemplate.hasAttribute("sourceTemplate"))
 		{
 			const std::string& sourceTemplateName = entityTemplate.getAttribute("sourceTemplate").toString();
@@ -160,10 +168,7 @@ void EntitiesParser::parseRenderQuad(const Xml& entityComponentNode, entt::entit
 	// parse texture
 	if(entityComponentNode.hasAttribute("textureFilepath")) {
 		const std::string filepath = entityComponentNode.getAttribute("textureFilepath").toString();
-		if(mTextureHolder->load(filepath))
-			quad.texture = &mTextureHolder->get(filepath);
-		else
-			PH_EXIT_GAME("EntitiesParser::parseRenderQuad() wasn't able to load texture \"" + filepath + "\"");
+		quad.texture = mTextureHolder->loadAsync(filepath);
 	}
 	else
 		quad.texture = nullptr;
@@ -263,7 +268,7 @@ void EntitiesParser::parseCharacterSpeed(const Xml& entityComponentNode, entt::e
 void EntitiesParser::parseCollisionWithPlayer(const Xml& entityComponentNode, entt::entity& entity)
 {
 	float pushForce = entityComponentNode.getAttribute("pushForce").toFloat();
-	mUsedRegistry->assign_or_replace<component::CollisionWithPlayer>(entity, pushForce, false);
+	mUsedRegistry->assign_or_replace<component::CollisionWithPlayer>(entity, pushForce);
 }
 
 void EntitiesParser::parseVelocity(const Xml& entityComponentNode, entt::entity& entity)
@@ -396,10 +401,7 @@ void EntitiesParser::parseParticleEmitter(const Xml& entityComponentNode, entt::
 		}
 		else if(name == "texture") {
 			const std::string filepath = attrib.getAttribute("filepath").toString();
-			if(mTextureHolder->load(filepath))
-				emitter.parTexture = &mTextureHolder->get(filepath);
-			else
-				PH_EXIT_GAME("EntitiesParser::parseParticleEmitter() wasn't able to load texture!");
+			emitter.parTexture = mTextureHolder->loadAsync(filepath);
 		}
 		else if(name == "spawnPositionOffset") {
 			const float x = attrib.getAttribute("x").toFloat();
@@ -597,7 +599,10 @@ void EntitiesParser::parseAnimationData(const Xml& entityComponentNode, entt::en
 	loadAnimationStatesFromFile(animationStateFilepath);
 	animationData.states = getAnimationStates(animationStateFilepath);
 	
-	animationData.currentStateName = entityComponentNode.getAttribute("firstStateName").toString();
+	const std::string firstStateName = entityComponentNode.getAttribute("firstStateName").toString();
+	animationData.currentStateId = getAnimationStateId(firstStateName);
+	PH_ASSERT_CRITICAL(animationData.states->hasState(animationData.currentStateId),
+		"Animation state \"" + firstStateName + "\" doesn't exist in \"" + animationStateFilepath + "\"!");
 
 	const float delay = entityComponentNode.getAttribute("delay").toFloat();
 	animationData.delay = delay;
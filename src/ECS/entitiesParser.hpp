@@ -1,7 +1,7 @@
 #pragma once
 
 #include "entt/entity/registry.hpp"
-#include "Resources/resourceHolder.hpp"
+#include "Resources/textureHolder.hpp"
 
 namespace ph {
 
@@ -1,9 +1,152 @@
 #include "entitiesTemplateStorage.hpp"
+#include "Components/aiComponents.hpp"
+#include "Components/animationComponents.hpp"
+#include "Components/audioComponents.hpp"
+#include "Components/charactersComponents.hpp"
+#include "Components/graphicsComponents.hpp"
+#include "Components/itemComponents.hpp"
+#include "Components/objectsComponents.hpp"
+#include "Components/particleComponents.hpp"
+#include "Components/physicsComponents.hpp"
+#include "Logs/logs.hpp"
+#include <algorithm>
+#include <type_traits>
 
 namespace ph {
 
+namespace {
+
+template<typename... Components>
+struct ComponentList {};
+
+// NOTE: Every component which can be put on template has to be on this list, otherwise it won't be spawned.
+//       TriggerVolume isn't here because it's assigned at runtime by TriggerVolumes system.
+using TemplateComponents = ComponentList<
+	component::Zombie,
+	component::AnimationData,
+	component::AmbientSound, component::SpatialSound,
+	component::Health, component::Damage, component::Player, component::Killable, component::InPlayerGunAttackArea,
+	component::FaceDirection, component::GunAttacker, component::DeadCharacter, component::TaggedToDestroy, component::DamageTag,
+	component::CollisionWithPlayer, component::Lifetime, component::LastingShot, component::CurrentGun,
+	component::CurrentMeleeWeapon, component::DamageAnimation,
+	component::RenderQuad, component::TextureRect, component::AtlasRegion, component::RenderChunk, component::Camera,
+	component::LightWall, component::LightSource, component::HiddenForRenderer,
+	component::Medkit, component::BulletBox, component::Bullets,
+	component::ArcadeSpawner, component::LootSpawner, component::AreaVelocityChangingEffect, component::Hint,
+	component::PushingArea, component::CutScene, component::Entrance, component::Lever, component::LeverListener,
+	component::Gate, component::Car, component::GunProperties, component::MeleeProperties,
+	component::ParticleEmitter, component::MultiParticleEmitter,
+	component::BodyRect, component::Velocity, component::PushingForces, component::CharacterSpeed,
+	component::StaticCollisionBody, component::MultiStaticCollisionBody, component::KinematicCollisionBody
+>;
+
+// NOTE: Released entities hand these components over to entities spawned next, so memory owned by them is reused
+using MemoryOwningComponents = ComponentList<component::ParticleEmitter, component::MultiParticleEmitter>;
+
+template<typename Component, typename... Components>
+constexpr bool isOnList(ComponentList<Components...>)
+{
+	return (std::is_same_v<Component, Components> || ...);
+}
+
+template<typename Component>
+constexpr bool ownsMemory = isOnList<Component>(MemoryOwningComponents{});
+
+template<typename Component>
+void resetComponent(Component& component, const Component& templateComponent)
+{
+	component = templateComponent;
+}
+
+void resetComponent(component::MultiParticleEmitter& multiEmitter, const component::MultiParticleEmitter& templateMultiEmitter)
+{
+	// NOTE: Emitters added at runtime are kept as finished one shots, so their particles can be reused
+	auto& emitters = multiEmitter.particleEmitters;
+	const auto& templateEmitters = templateMultiEmitter.particleEmitters;
+	if(emitters.size() < templateEmitters.size())
+		emitters.resize(templateEmitters.size());
+	std::copy(templateEmitters.begin(), templateEmitters.end(), emitters.begin());
+	for(auto it = emitters.begin() + templateEmitters.size(); it != emitters.end(); ++it) {
+		it->particles.clear();
+		it->oneShot = true;
+		it->isEmitting = false;
+	}
+}
+
+template<typename Component>
+void reserveComponent(entt::registry& dst, std::size_t count)
+{
+	// NOTE: Growing geometrically, so spawning entities one by one doesn't reallocate pool every time
+	const std::size_t requiredCapacity = dst.size<Component>() + count;
+	if(dst.capacity<Component>() < requiredCapacity)
+		dst.reserve<Component>(std::max(requiredCapacity, dst.capacity<Component>() * 2));
+}
+
+template<typename Component>
+void copyComponent(entt::registry& dst, const entt::registry& src, entt::entity srcEntity, const entt::entity* entities, std::size_t count)
+{
+	if constexpr(std::is_empty_v<Component>) {
+		for(std::size_t i = 0; i < count; ++i)
+			dst.assign<Component>(entities[i]);
+	}
+	else {
+		const Component& component = src.get<Component>(srcEntity);
+		for(std::size_t i = 0; i < count; ++i) {
+			if constexpr(ownsMemory<Component>) {
+				if(auto* reusedComponent = dst.try_get<Component>(entities[i])) {
+					resetComponent(*reusedComponent, component);
+					continue;
+				}
+			}
+			dst.assign<Component>(entities[i], component);
+		}
+	}
+}
+
+template<typename... Components>
+void parkComponents(entt::registry& inactive, entt::entity inactiveEntity, entt::registry& src, entt::entity entity,
+                    const entt::registry& templates, entt::entity templateEntity, ComponentList<Components...>)
+{
+	// NOTE: Components added at runtime aren't parked, because spawn resets only components of template
+	((templates.has<Components>(templateEntity) && src.has<Components>(entity) ?
+		(void)inactive.assign<Components>(inactiveEntity, std::move(src.get<Components>(entity))) : (void)0), ...);
+}
+
+template<typename... Components>
+void unparkComponents(entt::registry& dst, entt::entity entity, entt::registry& inactive, entt::entity inactiveEntity,
+                      ComponentList<Components...>)
+{
+	((inactive.has<Components>(inactiveEntity) ?
+		(void)dst.assign<Components>(entity, std::move(inactive.get<Components>(inactiveEntity))) : (void)0), ...);
+	inactive.destroy(inactiveEntity);
+}
+
+template<typename... Components>
+void collectComponentPools(const entt::registry& templates, entt::entity templateEntity,
+                           std::vector<Prefab::ComponentPool>& pools, ComponentList<Components...>)
+{
+	((templates.has<Components>(templateEntity) ?
+		(void)pools.push_back({&reserveComponent<Components>, &copyComponent<Components>}) : (void)0), ...);
+}
+
+#ifndef PH_DISTRIBUTION
+template<typename... Components>
+bool hasOnlyTemplateComponents(const entt::registry& templates, entt::entity templateEntity, ComponentList<Components...>)
+{
+	// NOTE: entt 3.2 can't list components of entity, so template is copied and all known components are removed from the copy
+	entt::registry scratch;
+	const auto copy = scratch.create();
+	scratch.stomp(copy, templateEntity, templates);
+	(scratch.reset<Components>(copy), ...);
+	return scratch.orphan(copy);
+}
+#endif
+
+}
+
 EntitiesTemplateStorage::EntitiesTemplateStorage()
 {
+	createBuiltInTemplates();
 }
 
 entt::registry& EntitiesTemplateStorage::getTemplateRegistry()
@@ -18,9 +161,110 @@ entt::entity EntitiesTemplateStorage::create(const std::string& templateName)
 	return newEntityTemplate;
 }
 
+void EntitiesTemplateStorage::setPooled(const std::string& templateName)
+{
+	mPooledTemplates.emplace(templateName);
+}
+
 entt::entity EntitiesTemplateStorage::createCopy(const std::string& templateName, entt::registry& gameRegistry)
 {
-	return gameRegistry.create(getTemplate(templateName), mTemplatesRegistry);
+	return spawn(getPrefab(templateName), gameRegistry);
+}
+
+PrefabID EntitiesTemplateStorage::getPrefab(const std::string& templateName)
+{
+	auto found = mPrefabsMap.find(templateName);
+	if(found != mPrefabsMap.end())
+		return found->second;
+
+	Prefab prefab;
+	prefab.templateEntity = getTemplate(templateName);
+#ifndef PH_DISTRIBUTION
+	if(!hasOnlyTemplateComponents(mTemplatesRegistry, prefab.templateEntity, TemplateComponents{}))
+		PH_EXIT_GAME("Template " + templateName + " has component which isn't on TemplateComponents list, it wouldn't be spawned!");
+#endif
+	collectComponentPools(mTemplatesRegistry, prefab.templateEntity, prefab.componentPools, TemplateComponents{});
+	prefab.isPooled = mPooledTemplates.count(templateName) != 0;
+
+	const auto prefabID = static_cast<PrefabID>(mPrefabs.size());
+	mPrefabs.emplace_back(std::move(prefab));
+	mPrefabsMap.emplace(templateName, prefabID);
+	return prefabID;
+}
+
+entt::entity EntitiesTemplateStorage::spawn(PrefabID prefabID, entt::registry& gameRegistry)
+{
+	PH_ASSERT_UNEXPECTED_SITUATION(prefabID < mPrefabs.size(), "Prefab with this id doesn't exist!");
+	takeEntities(mPrefabs[prefabID], 1, gameRegistry);
+	spawnComponents(mPrefabs[prefabID], mSpawnedEntities.data(), 1, gameRegistry);
+	return mSpawnedEntities.front();
+}
+
+void EntitiesTemplateStorage::reserve(PrefabID prefabID, std::size_t count, entt::registry& gameRegistry)
+{
+	PH_ASSERT_UNEXPECTED_SITUATION(prefabID < mPrefabs.size(), "Prefab with this id doesn't exist!");
+	gameRegistry.reserve(gameRegistry.size() + count);
+	for(const auto& pool : mPrefabs[prefabID].componentPools)
+		pool.reserve(gameRegistry, count);
+}
+
+bool EntitiesTemplateStorage::release(entt::entity entity, entt::registry& gameRegistry)
+{
+	const auto* instance = gameRegistry.try_get<component::PrefabInstance>(entity);
+	if(!instance)
+		return false;
+
+	Prefab& prefab = mPrefabs[instance->prefab];
+	const auto inactiveEntity = mInactiveComponents.create();
+	parkComponents(mInactiveComponents, inactiveEntity, gameRegistry, entity, mTemplatesRegistry, prefab.templateEntity, MemoryOwningComponents{});
+	gameRegistry.destroy(entity);
+	prefab.inactiveEntities.emplace_back(inactiveEntity);
+	++mPoolsStats.inactiveEntities;
+	return true;
+}
+
+void EntitiesTemplateStorage::createBuiltInTemplates()
+{
+	auto lastingShot = create("LastingShot");
+	mTemplatesRegistry.assign<component::LastingShot>(lastingShot);
+	mTemplatesRegistry.assign<component::Lifetime>(lastingShot, .05f);
+	setPooled("LastingShot");
+
+	auto shotSound = create("ShotSound");
+	mTemplatesRegistry.assign<component::AmbientSound>(shotSound, nullptr);
+	mTemplatesRegistry.assign<component::Lifetime>(shotSound, .05f);
+	setPooled("ShotSound");
+}
+
+void EntitiesTemplateStorage::takeEntities(Prefab& prefab, std::size_t count, entt::registry& gameRegistry)
+{
+	mSpawnedEntities.resize(count);
+	gameRegistry.create(mSpawnedEntities.begin(), mSpawnedEntities.end());
+
+	if(!prefab.isPooled)
+		return;
+
+	const std::size_t reusedCount = std::min(count, prefab.inactiveEntities.size());
+	for(std::size_t i = 0; i < reusedCount; ++i) {
+		unparkComponents(gameRegistry, mSpawnedEntities[i], mInactiveComponents, prefab.inactiveEntities.back(), MemoryOwningComponents{});
+		prefab.inactiveEntities.pop_back();
+	}
+
+	const auto prefabID = static_cast<PrefabID>(&prefab - mPrefabs.data());
+	for(std::size_t i = 0; i < count; ++i)
+		gameRegistry.assign<component::PrefabInstance>(mSpawnedEntities[i], prefabID);
+
+	mPoolsStats.createdEntities += static_cast<unsigned>(count - reusedCount);
+	mPoolsStats.reusedEntities += static_cast<unsigned>(reusedCount);
+	mPoolsStats.inactiveEntities -= static_cast<unsigned>(reusedCount);
+}
+
+void EntitiesTemplateStorage::spawnComponents(const Prefab& prefab, const entt::entity* entities, std::size_t count, entt::registry& gameRegistry)
+{
+	for(const auto& pool : prefab.componentPools) {
+		pool.reserve(gameRegistry, count);
+		pool.copy(gameRegistry, mTemplatesRegistry, prefab.templateEntity, entities, count);
+	}
 }
 
 entt::entity EntitiesTemplateStorage::getTemplate(const std::string& templateName)
@@ -28,6 +272,18 @@ entt::entity EntitiesTemplateStorage::getTemplate(const std::string& templateNam
 	return mTemplatesMap.at(templateName);
 }
 
+void EntitiesTemplateStorage::clear()
+{
+	mTemplatesMap.clear();
+	mPrefabsMap.clear();
+	mPrefabs.clear();
+	mPooledTemplates.clear();
+	mPoolsStats = EntityPoolsStats();
+	mTemplatesRegistry.reset();
+	mInactiveComponents.reset();
+	createBuiltInTemplates();
+}
+
 void EntitiesTemplateStorage::stomp(const entt::entity dst, const std::string& templateName)
 {
 	mTemplatesRegistry.stomp(dst, getTemplate(templateName), mTemplatesRegistry);
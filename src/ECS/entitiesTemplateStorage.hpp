@@ -1,9 +1,38 @@
 #pragma once
 
+#include "Components/prefabComponents.hpp"
 #include "entt/entity/registry.hpp"
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace ph {
 
+// NOTE: Prefab is a template compiled for spawning, it knows which component pools its template uses
+//       and copies them with typed functions instead of walking every pool of templates registry.
+struct Prefab
+{
+	struct ComponentPool
+	{
+		void(*reserve)(entt::registry& dst, std::size_t count);
+		void(*copy)(entt::registry& dst, const entt::registry& src, entt::entity srcEntity, const entt::entity* entities, std::size_t count);
+	};
+
+	entt::entity templateEntity = entt::null;
+	std::vector<ComponentPool> componentPools;
+	// NOTE: Entities of inactive components registry holding memory of released entities
+	std::vector<entt::entity> inactiveEntities;
+	bool isPooled = false;
+};
+
+struct EntityPoolsStats
+{
+	unsigned createdEntities = 0;
+	unsigned reusedEntities = 0;
+	unsigned inactiveEntities = 0;
+};
+
 class EntitiesTemplateStorage {
 public:
 	EntitiesTemplateStorage();
@@ -12,8 +41,24 @@ public:
 
 	entt::entity getTemplate(const std::string& templateName);
 
+	void clear();
+
 	entt::entity create(const std::string& templateName);
+	void setPooled(const std::string& templateName);
 	entt::entity createCopy(const std::string& templateName, entt::registry& gameRegistry);
+
+	// NOTE: Prefabs are compiled on first use, so templates mustn't be changed after that
+	PrefabID getPrefab(const std::string& templateName);
+	entt::entity spawn(PrefabID, entt::registry& gameRegistry);
+	template<typename Initializer>
+	void spawn(PrefabID, std::size_t count, entt::registry& gameRegistry, Initializer&& initializer);
+	void reserve(PrefabID, std::size_t count, entt::registry& gameRegistry);
+
+	// NOTE: Entity of pooled prefab is destroyed with all its components, but memory owning components of its template
+	//       are moved aside first and given to entity spawned next from that prefab.
+	bool release(entt::entity, entt::registry& gameRegistry);
+	const EntityPoolsStats& getPoolsStats() const { return mPoolsStats; }
+
 	void stomp(const entt::entity dstEntity, const std::string& templateName);
 	void stomp(const entt::entity dstEntity, const std::string& templateName, entt::registry& gameRegistry);
 
@@ -37,9 +82,20 @@ public:
 	template<typename T>
 	T get(entt::entity& templateEntity);
 
+private:
+	void createBuiltInTemplates();
+	void takeEntities(Prefab&, std::size_t count, entt::registry& gameRegistry);
+	void spawnComponents(const Prefab&, const entt::entity* entities, std::size_t count, entt::registry& gameRegistry);
+
 private:
 	std::unordered_map<std::string, entt::entity> mTemplatesMap;
+	std::unordered_map<std::string, PrefabID> mPrefabsMap;
+	std::unordered_set<std::string> mPooledTemplates;
+	std::vector<Prefab> mPrefabs;
+	std::vector<entt::entity> mSpawnedEntities;
+	EntityPoolsStats mPoolsStats;
 	entt::registry mTemplatesRegistry;
+	entt::registry mInactiveComponents;
 };
 
 }
@@ -1,5 +1,20 @@
+#include "Logs/logs.hpp"
+
 namespace ph {
 
+template<typename Initializer>
+void EntitiesTemplateStorage::spawn(PrefabID prefabID, std::size_t count, entt::registry& gameRegistry, Initializer&& initializer)
+{
+	PH_ASSERT_UNEXPECTED_SITUATION(prefabID < mPrefabs.size(), "Prefab with this id doesn't exist!");
+
+	// NOTE: Spawned entities buffer is reused between spawns, so initializer mustn't spawn entities
+	takeEntities(mPrefabs[prefabID], count, gameRegistry);
+	spawnComponents(mPrefabs[prefabID], mSpawnedEntities.data(), count, gameRegistry);
+
+	for(std::size_t i = 0; i < count; ++i)
+		initializer(mSpawnedEntities[i], i);
+}
+
 template<typename T, typename... Args>
 void EntitiesTemplateStorage::assign(const std::string& templateName, Args&&... arguments)
 {
@@ -0,0 +1,57 @@
+#include "rayQueries.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace ph {
+
+FloatRect Ray::getBounds(float distance) const
+{
+	const sf::Vector2f end = getPoint(distance);
+	return FloatRect(std::min(origin.x, end.x), std::min(origin.y, end.y), std::abs(end.x - origin.x), std::abs(end.y - origin.y));
+}
+
+float castRayAgainstStaticBodies(entt::registry& registry, const Ray& ray)
+{
+	// NOTE: Bodies which don't touch bounds of the ray are rejected before the exact intersection test,
+	//       bounds shrink every time ray hits something closer
+	float closestDistance = ray.maxDistance;
+	FloatRect rayBounds = ray.getBounds(closestDistance);
+	auto hitAt = [&](const FloatRect& rect) {
+		if(!FloatRect::doPositiveRectsIntersect(rayBounds, rect))
+			return false;
+		const auto distance = Math::getRayIntersectionDistance(ray.origin, ray.direction, rect);
+		if(!distance || *distance >= closestDistance)
+			return false;
+		closestDistance = *distance;
+		rayBounds = ray.getBounds(closestDistance);
+		return true;
+	};
+
+	auto staticBodies = registry.view<component::BodyRect, component::StaticCollisionBody>();
+	for(auto staticBody : staticBodies)
+		hitAt(staticBodies.get<component::BodyRect>(staticBody).rect);
+
+	auto multiStaticBodies = registry.view<component::MultiStaticCollisionBody>();
+	for(auto multiStaticBody : multiStaticBodies)
+	{
+		const auto& multiBody = multiStaticBodies.get(multiStaticBody);
+		if(!FloatRect::doPositiveRectsIntersect(rayBounds, multiBody.sharedBounds))
+			continue;
+		const auto boundsDistance = Math::getRayIntersectionDistance(ray.origin, ray.direction, multiBody.sharedBounds);
+		if(!boundsDistance || *boundsDistance >= closestDistance)
+			continue;
+
+		for(const FloatRect& rect : multiBody.rects)
+			hitAt(rect);
+	}
+
+	return closestDistance;
+}
+
+bool isInLineOfSight(entt::registry& registry, sf::Vector2f from, sf::Vector2f to)
+{
+	const Ray ray{from, to - from, 1.f};
+	return castRayAgainstStaticBodies(registry, ray) >= 1.f;
+}
+
+}
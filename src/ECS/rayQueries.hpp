@@ -0,0 +1,41 @@
+#pragma once
+
+#include "entt/entity/registry.hpp"
+#include "Utilities/rect.hpp"
+#include <SFML/System/Vector2.hpp>
+
+namespace ph {
+
+// NOTE: Distances are measured in lengths of direction, so direction doesn't have to be normalized
+struct Ray
+{
+	sf::Vector2f origin;
+	sf::Vector2f direction;
+	float maxDistance;
+
+	sf::Vector2f getPoint(float distance) const { return origin + direction * distance; }
+	FloatRect getBounds(float distance) const;
+};
+
+struct RayHit
+{
+	entt::entity entity = entt::null;
+	float distance; // NOTE: Distance at which ray stopped, it's maxDistance if nothing was hit
+
+	bool hitEntity() const { return entity != entt::null; }
+};
+
+enum class RayOcclusion { None, StaticBodies };
+
+// NOTE: Returns the first entity with BodyRect and all of the Components which ray hits.
+//       With RayOcclusion::StaticBodies ray also stops at static collision bodies.
+template<typename... Components>
+RayHit castRay(entt::registry&, const Ray&, RayOcclusion = RayOcclusion::StaticBodies);
+
+float castRayAgainstStaticBodies(entt::registry&, const Ray&);
+
+bool isInLineOfSight(entt::registry&, sf::Vector2f from, sf::Vector2f to);
+
+}
+
+#include "rayQueries.inl"
@@ -0,0 +1,31 @@
+#include "ECS/Components/physicsComponents.hpp"
+#include "Utilities/math.hpp"
+
+namespace ph {
+
+template<typename... Components>
+RayHit castRay(entt::registry& registry, const Ray& ray, RayOcclusion occlusion)
+{
+	RayHit hit;
+	hit.distance = occlusion == RayOcclusion::StaticBodies ? castRayAgainstStaticBodies(registry, ray) : ray.maxDistance;
+
+	const FloatRect rayBounds = ray.getBounds(hit.distance);
+
+	auto candidates = registry.view<component::BodyRect, Components...>();
+	for(auto candidate : candidates)
+	{
+		const auto& body = candidates.template get<component::BodyRect>(candidate);
+		if(!FloatRect::doPositiveRectsIntersect(rayBounds, body.rect))
+			continue;
+
+		const auto distance = Math::getRayIntersectionDistance(ray.origin, ray.direction, body.rect);
+		if(distance && *distance < hit.distance) {
+			hit.distance = *distance;
+			hit.entity = candidate;
+		}
+	}
+
+	return hit;
+}
+
+}
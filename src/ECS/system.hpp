@@ -10,10 +10,18 @@ namespace ph::system {
 	{
 	public:
 		explicit System(entt::registry& registry);
+		virtual ~System() = default;
 
 		virtual void update(float seconds) = 0;
 		virtual void onEvent(const ActionEvent& event);
 
+		// NOTE: render() is called once per frame, after update() was called for every simulation step which passed.
+		//       interpolation is the part of simulation step which passed since the last update().
+		virtual void render(float) {}
+
+		// NOTE: onEvent() is called only for actions from this mask
+		virtual ActionMask getSubscribedActions() const { return 0; }
+
 	protected:
 		entt::registry& mRegistry;
 	};
@@ -1,21 +1,57 @@
 #include "systemsQueue.hpp"
 
+namespace {
+	template<typename Function>
+	void measure(ph::SystemTiming& timing, Function function)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		function();
+		timing.add(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start));
+	}
+}
+
 namespace ph {
 	
 	SystemsQueue::SystemsQueue(entt::registry& registry)
 		: mRegistry(registry)
+		, mTimingsEnabled(false)
 	{
 	}
 
 	void SystemsQueue::update(float seconds)
 	{
+		if (mTimingsEnabled) {
+			for (std::size_t i = 0; i < mSystemsArray.size(); ++i)
+				measure(mTimings[i].update, [&] { mSystemsArray[i]->update(seconds); });
+			return;
+		}
+
 		for (auto& system : mSystemsArray)
 			system->update(seconds);
 	}
 
-	void SystemsQueue::handleEvents(const ActionEvent& event)
+	void SystemsQueue::render(float interpolation)
 	{
+		if (mTimingsEnabled) {
+			for (std::size_t i = 0; i < mSystemsArray.size(); ++i)
+				measure(mTimings[i].render, [&] { mSystemsArray[i]->render(interpolation); });
+			return;
+		}
+
 		for (auto& system : mSystemsArray)
+			system->render(interpolation);
+	}
+
+	void SystemsQueue::setTimingsEnabled(bool enabled)
+	{
+		mTimingsEnabled = enabled;
+		for (auto& timings : mTimings)
+			timings.update = timings.render = SystemTiming();
+	}
+
+	void SystemsQueue::handleEvents(const ActionEvent& event)
+	{
+		for (auto* system : mActionSubscribers[event.mAction])
 			system->onEvent(event);
 	}
 
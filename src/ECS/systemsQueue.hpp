@@ -2,25 +2,59 @@
 
 #include "system.hpp"
 
+#include <array>
 #include <vector>
 #include <memory>
+#include <string>
+#include <chrono>
+#include <typeinfo>
 
 namespace ph {
 
+	struct SystemTiming
+	{
+		void add(std::chrono::nanoseconds duration)
+		{
+			total += duration;
+			if(duration > max)
+				max = duration;
+			++calls;
+		}
+
+		std::chrono::nanoseconds total = std::chrono::nanoseconds::zero();
+		std::chrono::nanoseconds max = std::chrono::nanoseconds::zero();
+		unsigned calls = 0;
+	};
+
+	struct SystemTimings
+	{
+		std::string name;
+		SystemTiming update;
+		SystemTiming render;
+	};
+
 	class SystemsQueue
 	{
 	public:
 		SystemsQueue(entt::registry& registry);
 
 		void update(float seconds);
+		void render(float interpolation);
 		void handleEvents(const ActionEvent& event);
 	
 		template <typename SystemType, typename... Args>
 		void appendSystem(Args... arguments);
 
+		// NOTE: Timings are measured only when they're enabled, so normal game loop doesn't pay for reading clock
+		void setTimingsEnabled(bool enabled);
+		const std::vector<SystemTimings>& getTimings() const { return mTimings; }
+
 	private:
 		entt::registry& mRegistry;
 		std::vector<std::unique_ptr<system::System>> mSystemsArray;
+		std::vector<SystemTimings> mTimings;
+		std::array<std::vector<system::System*>, maxNumberOfActions> mActionSubscribers;
+		bool mTimingsEnabled;
 	};
 }
 
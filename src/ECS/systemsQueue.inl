@@ -4,7 +4,13 @@ namespace ph {
 	template<typename SystemType, typename... Args>
 	void SystemsQueue::appendSystem(Args... arguments)
 	{
-		mSystemsArray.emplace_back(std::unique_ptr<SystemType>(new SystemType(mRegistry, arguments...)));
+		auto& system = mSystemsArray.emplace_back(std::unique_ptr<SystemType>(new SystemType(mRegistry, arguments...)));
+		mTimings.emplace_back().name = typeid(SystemType).name();
+
+		const ActionMask subscribedActions = system->getSubscribedActions();
+		for (ActionID action = 0; action < maxNumberOfActions; ++action)
+			if (subscribedActions & makeActionMask(action))
+				mActionSubscribers[action].emplace_back(system.get());
 	}
 
 }
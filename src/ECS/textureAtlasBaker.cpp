@@ -0,0 +1,240 @@
+#include "textureAtlasBaker.hpp"
+#include "ECS/Components/graphicsComponents.hpp"
+#include "ECS/Components/particleComponents.hpp"
+#include "Utilities/skylinePacker.hpp"
+#include "Utilities/profiling.hpp"
+#include "Logs/logs.hpp"
+#include <algorithm>
+#include <future>
+#include <optional>
+
+namespace ph {
+
+namespace {
+	constexpr int atlasWidth = 1024;
+	constexpr int maxBakedTextureSize = 512;
+	constexpr int extrusion = 2; // NOTE: Border of repeated edge pixels which stops filtering from bleeding between textures
+	const std::string atlasPathPrefix = "atlases/";
+
+	void convertToRGBA(TextureData& data)
+	{
+		if(data.numberOfChannels == 4)
+			return;
+
+		std::vector<unsigned char> rgbaPixels(std::size_t(data.size.x) * data.size.y * 4);
+		for(std::size_t src = 0, dst = 0; dst < rgbaPixels.size(); src += data.numberOfChannels, dst += 4) {
+			rgbaPixels[dst] = data.pixels[src];
+			rgbaPixels[dst + 1] = data.pixels[src + 1];
+			rgbaPixels[dst + 2] = data.pixels[src + 2];
+			rgbaPixels[dst + 3] = 255;
+		}
+		data.pixels = std::move(rgbaPixels);
+		data.numberOfChannels = 4;
+	}
+
+	struct PackedTexture
+	{
+		std::string filePath;
+		TextureData data;
+		sf::Vector2i position;
+	};
+
+	// NOTE: Texture data is stored bottom-up, while packed positions have y axis pointing down
+	void copyToAtlas(const PackedTexture& packed, TextureData& atlas)
+	{
+		const sf::Vector2i size = packed.data.size;
+		for(int y = -extrusion; y < size.y + extrusion; ++y)
+		{
+			const int srcY = std::clamp(y, 0, size.y - 1);
+			const int srcRow = size.y - 1 - srcY;
+			const int dstRow = atlas.size.y - 1 - (packed.position.y + extrusion + y);
+			for(int x = -extrusion; x < size.x + extrusion; ++x)
+			{
+				const int srcX = std::clamp(x, 0, size.x - 1);
+				const int dstX = packed.position.x + extrusion + x;
+				const auto* src = &packed.data.pixels[(std::size_t(srcRow) * size.x + srcX) * 4];
+				auto* dst = &atlas.pixels[(std::size_t(dstRow) * atlas.size.x + dstX) * 4];
+				std::copy(src, src + 4, dst);
+			}
+		}
+	}
+}
+
+TextureAtlasBaker::TextureAtlasBaker(TextureHolder& textureHolder)
+	:mTextureHolder(textureHolder)
+{
+}
+
+void TextureAtlasBaker::bake(entt::registry& templatesRegistry, const std::string& templatesFilePath)
+{
+	PH_PROFILE_FUNCTION();
+
+	collectTexturePaths(templatesRegistry);
+	if(!reuseBakedAtlases(templatesFilePath) && bakeAtlases())
+		rememberBakedAtlases(templatesFilePath);
+	replaceTextures(templatesRegistry);
+
+	mTexturePaths.clear();
+	mBakedTextures.clear();
+}
+
+auto TextureAtlasBaker::getBakedTexturePaths() -> std::unordered_set<std::string>
+{
+	std::unordered_set<std::string> texturePaths;
+	for(const auto& [templatesFilePath, bakedAtlases] : sBakedAtlases)
+		for(const auto& [texturePath, baked] : bakedAtlases.regions)
+			texturePaths.emplace(texturePath);
+	return texturePaths;
+}
+
+void TextureAtlasBaker::collectTexturePaths(entt::registry& templatesRegistry)
+{
+	templatesRegistry.view<component::RenderQuad>(entt::exclude<component::AtlasRegion>).each([this](const component::RenderQuad& quad) {
+		collectTexturePath(quad.texture);
+	});
+	templatesRegistry.view<component::ParticleEmitter>().each([this](const component::ParticleEmitter& emitter) {
+		collectTexturePath(emitter.parTexture);
+	});
+	templatesRegistry.view<component::MultiParticleEmitter>().each([this](const component::MultiParticleEmitter& multiEmitter) {
+		for(const auto& emitter : multiEmitter.particleEmitters)
+			collectTexturePath(emitter.parTexture);
+	});
+}
+
+void TextureAtlasBaker::collectTexturePath(const TextureRef& texture)
+{
+	const std::string filePath = mTextureHolder.getFilePath(texture.getHandle());
+	if(filePath.empty() || filePath.compare(0, atlasPathPrefix.size(), atlasPathPrefix) == 0)
+		return;
+	if(std::find(mTexturePaths.begin(), mTexturePaths.end(), filePath) == mTexturePaths.end())
+		mTexturePaths.emplace_back(filePath);
+}
+
+bool TextureAtlasBaker::reuseBakedAtlases(const std::string& templatesFilePath)
+{
+	// NOTE: Paths are sorted, so the same set of textures always compares equal
+	std::sort(mTexturePaths.begin(), mTexturePaths.end());
+
+	auto found = sBakedAtlases.find(templatesFilePath);
+	if(found == sBakedAtlases.end() || found->second.texturePaths != mTexturePaths)
+		return false;
+
+	// NOTE: Atlas which isn't used by any scene can be evicted from holder, then atlases are baked again
+	const auto& regions = found->second.regions;
+	if(!std::all_of(regions.begin(), regions.end(), [this](const auto& baked) { return mTextureHolder.has(baked.second.atlasPath); }))
+		return false;
+
+	for(const auto& [texturePath, baked] : regions)
+		mBakedTextures.emplace(texturePath, BakedTexture{mTextureHolder.acquire(baked.atlasPath), baked.region});
+
+	PH_LOG_INFO("Reused atlases of " + std::to_string(mBakedTextures.size()) + " entity textures from " + templatesFilePath + ".");
+	return true;
+}
+
+void TextureAtlasBaker::rememberBakedAtlases(const std::string& templatesFilePath)
+{
+	BakedAtlases& bakedAtlases = sBakedAtlases[templatesFilePath];
+	bakedAtlases.texturePaths = mTexturePaths;
+	bakedAtlases.regions.clear();
+	for(const auto& [texturePath, baked] : mBakedTextures)
+		bakedAtlases.regions.emplace(texturePath, BakedRegion{mTextureHolder.getFilePath(baked.atlas.getHandle()), baked.region});
+}
+
+bool TextureAtlasBaker::bakeAtlases()
+{
+	std::vector<std::future<std::optional<TextureData>>> decodedTextures;
+	decodedTextures.reserve(mTexturePaths.size());
+	for(const auto& filePath : mTexturePaths)
+		decodedTextures.emplace_back(mTextureHolder.decodeAsync(filePath));
+
+	std::vector<PackedTexture> textures;
+	for(std::size_t i = 0; i < mTexturePaths.size(); ++i)
+	{
+		auto data = decodedTextures[i].get();
+		if(!data || data->size.x > maxBakedTextureSize || data->size.y > maxBakedTextureSize)
+			continue;
+		if(data->numberOfChannels != 3 && data->numberOfChannels != 4)
+			continue;
+		convertToRGBA(*data);
+		textures.emplace_back(PackedTexture{mTexturePaths[i], std::move(*data), {}});
+	}
+
+	// NOTE: Packing from the tallest texture keeps skyline flat
+	std::sort(textures.begin(), textures.end(), [](const PackedTexture& lhs, const PackedTexture& rhs) {
+		return lhs.data.size.y > rhs.data.size.y;
+	});
+
+	unsigned numberOfAtlases = 0;
+	while(!textures.empty())
+	{
+		SkylinePacker packer({atlasWidth, atlasWidth});
+		std::vector<PackedTexture> packedTextures, remainingTextures;
+		int atlasHeight = 0;
+		for(auto& texture : textures)
+		{
+			const auto position = packer.insert(texture.data.size + sf::Vector2i(extrusion * 2, extrusion * 2));
+			if(!position) {
+				remainingTextures.emplace_back(std::move(texture));
+				continue;
+			}
+			texture.position = *position;
+			atlasHeight = std::max(atlasHeight, position->y + texture.data.size.y + extrusion * 2);
+			packedTextures.emplace_back(std::move(texture));
+		}
+		textures = std::move(remainingTextures);
+
+		TextureData atlasData;
+		atlasData.size = {atlasWidth, atlasHeight};
+		atlasData.numberOfChannels = 4;
+		atlasData.pixels.resize(std::size_t(atlasWidth) * atlasHeight * 4);
+		for(const auto& packed : packedTextures)
+			copyToAtlas(packed, atlasData);
+
+		auto atlas = std::make_unique<Texture>();
+		if(!atlas->loadFromTextureData(atlasData)) {
+			PH_LOG_ERROR("Texture atlas baking failed, entity textures stay unbaked.");
+			return false;
+		}
+
+		const std::string atlasPath = atlasPathPrefix + "entities" + std::to_string(sNumberOfBakedAtlases++);
+		mTextureHolder.insert(atlasPath, std::move(atlas));
+		TextureRef atlasRef = mTextureHolder.acquire(atlasPath);
+		for(const auto& packed : packedTextures)
+			mBakedTextures.emplace(packed.filePath, BakedTexture{atlasRef, IntRect(packed.position + sf::Vector2i(extrusion, extrusion), packed.data.size)});
+
+		++numberOfAtlases;
+	}
+
+	PH_LOG_INFO("Baked " + std::to_string(mBakedTextures.size()) + " of " + std::to_string(mTexturePaths.size()) +
+		" entity textures into " + std::to_string(numberOfAtlases) + " atlases.");
+	return true;
+}
+
+void TextureAtlasBaker::replaceTextures(entt::registry& templatesRegistry)
+{
+	auto renderQuads = templatesRegistry.view<component::RenderQuad>(entt::exclude<component::AtlasRegion>);
+	for(auto entity : renderQuads)
+	{
+		auto& quad = renderQuads.get(entity);
+		auto found = mBakedTextures.find(mTextureHolder.getFilePath(quad.texture.getHandle()));
+		if(found == mBakedTextures.end())
+			continue;
+		quad.texture = found->second.atlas;
+		templatesRegistry.assign<component::AtlasRegion>(entity, found->second.region);
+	}
+
+	auto replaceParticleTexture = [this](component::ParticleEmitter& emitter) {
+		auto found = mBakedTextures.find(mTextureHolder.getFilePath(emitter.parTexture.getHandle()));
+		if(found == mBakedTextures.end())
+			return;
+		emitter.parTexture = found->second.atlas;
+		emitter.parTextureRect = found->second.region;
+	};
+	templatesRegistry.view<component::ParticleEmitter>().each(replaceParticleTexture);
+	templatesRegistry.view<component::MultiParticleEmitter>().each([&](component::MultiParticleEmitter& multiEmitter) {
+		for(auto& emitter : multiEmitter.particleEmitters)
+			replaceParticleTexture(emitter);
+	});
+}
+
+}
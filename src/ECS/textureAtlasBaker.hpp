@@ -0,0 +1,63 @@
+#pragma once
+
+#include "entt/entity/registry.hpp"
+#include "Resources/textureHolder.hpp"
+#include "Utilities/rect.hpp"
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ph {
+
+// NOTE: Packs small textures of entity templates into atlases, so entities spawned from templates
+//       share textures and renderer doesn't have to break batches between them.
+//       Baked entities get AtlasRegion component, their TextureRect stays in coordinates of the original texture.
+//       Atlases are remembered per templates file and reused while the file uses the same textures,
+//       so loading another scene with the same templates doesn't bake them again.
+class TextureAtlasBaker
+{
+public:
+	explicit TextureAtlasBaker(TextureHolder&);
+
+	void bake(entt::registry& templatesRegistry, const std::string& templatesFilePath);
+
+	// NOTE: Textures which were baked into atlases, entities don't load them on their own
+	static auto getBakedTexturePaths() -> std::unordered_set<std::string>;
+
+private:
+	struct BakedTexture
+	{
+		TextureRef atlas;
+		IntRect region;
+	};
+
+	struct BakedRegion
+	{
+		std::string atlasPath;
+		IntRect region;
+	};
+
+	struct BakedAtlases
+	{
+		std::vector<std::string> texturePaths;
+		std::unordered_map<std::string, BakedRegion> regions;
+	};
+
+	void collectTexturePaths(entt::registry& templatesRegistry);
+	void collectTexturePath(const TextureRef& texture);
+	bool reuseBakedAtlases(const std::string& templatesFilePath);
+	bool bakeAtlases();
+	void rememberBakedAtlases(const std::string& templatesFilePath);
+	void replaceTextures(entt::registry& templatesRegistry);
+
+private:
+	TextureHolder& mTextureHolder;
+	std::vector<std::string> mTexturePaths;
+	std::unordered_map<std::string, BakedTexture> mBakedTextures;
+
+	inline static unsigned sNumberOfBakedAtlases = 0;
+	inline static std::unordered_map<std::string, BakedAtlases> sBakedAtlases;
+};
+
+}
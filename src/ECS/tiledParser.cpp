@@ -64,13 +64,15 @@ namespace ph {
 	void TiledParser::loadObjects(const Xml& gameObjectsNode) const
 	{
 		const std::vector<Xml> objects = gameObjectsNode.getChildren("object");
+		std::vector<const Xml*> zombieNodes;
+		std::vector<const Xml*> slowZombieNodes;
 
 		for (const auto& gameObjectNode : objects)
 		{
 			auto objectType = gameObjectNode.getAttribute("type").toString();
 
-			if (objectType == "Zombie") loadZombie(gameObjectNode);
-			else if (objectType == "SlowZombie") loadZombie(gameObjectNode, "SlowZombie");
+			if (objectType == "Zombie") zombieNodes.emplace_back(&gameObjectNode);
+			else if (objectType == "SlowZombie") slowZombieNodes.emplace_back(&gameObjectNode);
 			else if (objectType == "Player") loadPlayer(gameObjectNode);
 			else if (objectType == "Camera") loadCamera(gameObjectNode);
 			else if (objectType == "BulletBox") loadBulletBox(gameObjectNode);
@@ -93,13 +95,22 @@ namespace ph {
 			else if (objectType == "FlowingRiver") loadFlowingRiver(gameObjectNode);
 			else PH_LOG_ERROR("The type of object in map file (" + gameObjectNode.getAttribute("type").toString() + ") is unknown!");
 		}
+
+		loadZombies(zombieNodes, "Zombie");
+		loadZombies(slowZombieNodes, "SlowZombie");
 	}
 
-	void TiledParser::loadZombie(const Xml& zombieNode, std::string zombieTypeName) const
+	void TiledParser::loadZombies(const std::vector<const Xml*>& zombieNodes, const std::string& zombieTypeName) const
 	{
-		auto zombie = mTemplatesStorage.createCopy(zombieTypeName, mGameRegistry);
-		loadPosition(zombieNode, zombie);
-		loadHealthComponent(zombieNode, zombie);
+		if (zombieNodes.empty())
+			return;
+
+		const PrefabID zombiePrefab = mTemplatesStorage.getPrefab(zombieTypeName);
+		mTemplatesStorage.spawn(zombiePrefab, zombieNodes.size(), mGameRegistry, [&](entt::entity zombie, std::size_t index)
+		{
+			loadPosition(*zombieNodes[index], zombie);
+			loadHealthComponent(*zombieNodes[index], zombie);
+		});
 	}
 
 	void TiledParser::loadLootSpawner(const Xml& lootSpawnerNode) const
@@ -324,10 +335,8 @@ namespace ph {
 		// load texture
 		const std::string texturePath = getProperty(spriteNode, "texturePath").toString();
 		if(texturePath != "none") {
-			if(mTextureHolder.load(texturePath))
-				rq.texture = &mTextureHolder.get(texturePath);
-			else
-				PH_EXIT_GAME("TiledParser::loadSprite() wasn't able to load texture \"" + texturePath + "\"");
+			rq.texture = mTextureHolder.loadAsync(texturePath);
+			mGameRegistry.reset<component::AtlasRegion>(spriteEntity);
 		}
 
 		// load texture rect
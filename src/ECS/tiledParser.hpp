@@ -2,12 +2,13 @@
 
 #include "entitiesTemplateStorage.hpp"
 #include "Scenes/sceneManager.hpp"
-#include "Resources/resourceHolder.hpp"
+#include "Resources/textureHolder.hpp"
 #include "Utilities/rect.hpp"
 #include <entt/entity/registry.hpp>
 #include <SFML/Graphics.hpp>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace ph {
 
@@ -27,7 +28,7 @@ namespace ph {
 		Xml findGameObjects(const Xml& mapFile) const;
 		void loadObjects(const Xml& gameObjects) const;
 		
-		void loadZombie(const Xml& zombieNode, std::string zombieTypeName = "Zombie") const;
+		void loadZombies(const std::vector<const Xml*>& zombieNodes, const std::string& zombieTypeName) const;
 		void loadLootSpawner(const Xml& lootSpawnerNode) const;
 		void loadArcadeSpawner(const Xml& arcadeSpawnerNode) const;
 		void loadEntrance(const Xml& entranceNode) const;
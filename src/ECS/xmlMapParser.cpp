@@ -20,21 +20,46 @@ void XmlMapParser::parseFile(const std::string& fileName, AIManager& aiManager,
 	mGameRegistry = &gameRegistry;
 	mTemplates = &templates;
 	mTextures = &textures;
-		
+
+	auto prepared = sPreparedMaps.extract(fileName);
+	const PreparedMap preparedMap = prepared ? std::move(prepared.mapped()) : prepareFile(fileName);
+
+	aiManager.registerMapSize(preparedMap.generalMapInfo.mapSize);
+	parserMapLayers(preparedMap.layersGlobalTileIds, preparedMap.tilesetsData, preparedMap.generalMapInfo, aiManager);
+	createMapBorders(preparedMap.generalMapInfo);
+}
+
+auto XmlMapParser::prepareFile(const std::string& fileName) const -> PreparedMap
+{
 	Xml mapFile;
 	mapFile.loadFromFile(fileName);
+	return prepareMap(mapFile);
+}
+
+auto XmlMapParser::prepareMap(const Xml& mapFile) const -> PreparedMap
+{
 	const Xml mapNode = mapFile.getChild("map");
 	checkMapSupport(mapNode);
 
-	GeneralMapInfo generalMapInfo = getGeneralMapInfo(mapNode);
-	aiManager.registerMapSize(generalMapInfo.mapSize);
-
 	const std::vector<Xml> tilesetNodes = getTilesetNodes(mapNode);
-	const TilesetsData tilesetsData = getTilesetsData(tilesetNodes);
 	const std::vector<Xml> layerNodes = getLayerNodes(mapNode);
-	
-	parserMapLayers(layerNodes, tilesetsData, generalMapInfo, aiManager);
-	createMapBorders(generalMapInfo);
+	std::vector<std::vector<unsigned>> layersGlobalTileIds;
+	layersGlobalTileIds.reserve(layerNodes.size());
+	for(const Xml& layerNode : layerNodes)
+		layersGlobalTileIds.emplace_back(toGlobalTileIds(layerNode.getChild("data")));
+
+	return {getGeneralMapInfo(mapNode), getTilesetsData(tilesetNodes), std::move(layersGlobalTileIds)};
+}
+
+void XmlMapParser::addPreparedMap(const std::string& fileName, PreparedMap preparedMap)
+{
+	sPreparedMaps.erase(fileName);
+	sPreparedMaps.emplace(fileName, std::move(preparedMap));
+}
+
+void XmlMapParser::clearPreparedMaps()
+{
+	sPreparedMaps.clear();
 }
 
 void XmlMapParser::checkMapSupport(const Xml& mapNode) const
@@ -137,14 +162,12 @@ std::vector<Xml> XmlMapParser::getLayerNodes(const Xml& mapNode) const
 	return layerNodes;
 }
 
-void XmlMapParser::parserMapLayers(const std::vector<Xml>& layerNodes, const TilesetsData& tilesets, const GeneralMapInfo& info,
-                                   AIManager& aiManager)
+void XmlMapParser::parserMapLayers(const std::vector<std::vector<unsigned>>& layersGlobalTileIds, const TilesetsData& tilesets,
+                                   const GeneralMapInfo& info, AIManager& aiManager)
 {
 	unsigned char z = 200;
-	for (const Xml& layerNode : layerNodes)
+	for (const auto& globalIds : layersGlobalTileIds)
 	{
-		const Xml dataNode = layerNode.getChild("data");
-		const auto globalIds = toGlobalTileIds(dataNode);
 		createLayer(globalIds, tilesets, info, z, aiManager);
 		--z;
 	}
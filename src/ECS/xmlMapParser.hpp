@@ -1,11 +1,12 @@
 #pragma once
 
 #include "entitiesTemplateStorage.hpp"
-#include "Resources/resourceHolder.hpp"
+#include "Resources/textureHolder.hpp"
 
 #include <entt/entity/registry.hpp>
 #include <SFML/Graphics.hpp>
 #include <string>
+#include <unordered_map>
 
 namespace ph {
 
@@ -34,12 +35,27 @@ struct TilesetsData
 	std::string tilesetFileName;
 };
 
+// NOTE: Map data which doesn't depend on registry, it can be prepared on other thread
+struct PreparedMap
+{
+	GeneralMapInfo generalMapInfo;
+	TilesetsData tilesetsData;
+	std::vector<std::vector<unsigned>> layersGlobalTileIds;
+};
+
 class XmlMapParser
 {
 public:
 	void parseFile(const std::string& fileName, AIManager& aiManager, entt::registry& gameRegistry,
 	               EntitiesTemplateStorage& templates, TextureHolder& textures);
+
+	auto prepareMap(const Xml& mapFile) const -> PreparedMap;
+
+	static void addPreparedMap(const std::string& fileName, PreparedMap);
+	static void clearPreparedMaps();
+
 private:
+	auto prepareFile(const std::string& fileName) const -> PreparedMap;
 	void checkMapSupport(const Xml& mapNode) const;
 	auto getGeneralMapInfo(const Xml& mapNode) const -> GeneralMapInfo;
 	sf::Vector2u getMapSize(const Xml& mapNode) const;
@@ -49,7 +65,7 @@ private:
 	auto getTilesetsData(const std::vector<Xml>& tilesetNodes) const -> const TilesetsData;
 	auto getTilesData(const std::vector<Xml>& tileNodes) const -> TilesData;
 	std::vector<Xml> getLayerNodes(const Xml& mapNode) const;
-	void parserMapLayers(const std::vector<Xml>& layerNodes, const TilesetsData&, const GeneralMapInfo&, AIManager&);
+	void parserMapLayers(const std::vector<std::vector<unsigned>>& layersGlobalTileIds, const TilesetsData&, const GeneralMapInfo&, AIManager&);
 	std::vector<unsigned> toGlobalTileIds(const Xml& dataNode) const;
 	
 	void createLayer(const std::vector<unsigned>& globalTileIds, const TilesetsData&, const GeneralMapInfo&,
@@ -60,6 +76,7 @@ private:
 	void createMapBorders(const GeneralMapInfo& mapInfo);
 
 private:
+	inline static std::unordered_map<std::string, PreparedMap> sPreparedMaps;
 	entt::registry* mGameRegistry;
 	EntitiesTemplateStorage* mTemplates;
 	TextureHolder* mTextures;
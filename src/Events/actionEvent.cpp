@@ -1,6 +1,6 @@
 #include "actionEvent.hpp"
 
-ph::ActionEvent::ActionEvent(const std::string action, const Type type)
+ph::ActionEvent::ActionEvent(ActionID action, Type type)
 	: mAction(action)
 	, mType(type)
 {
@@ -1,17 +1,47 @@
 #pragma once
 
-#include <string>
+#include <cstdint>
 
 namespace ph {
 
+using ActionID = std::uint8_t;
+using ActionMask = std::uint32_t;
+
+constexpr ActionID maxNumberOfActions = 32;
+constexpr ActionID invalidActionID = maxNumberOfActions;
+
+// NOTE: Actions used by the engine have compile time IDs, other actions are interned when they are added
+namespace Actions {
+	enum : ActionID
+	{
+		MovingUp,
+		MovingDown,
+		MovingRight,
+		MovingLeft,
+		Use,
+		ChangeWeapon,
+		GunAttack,
+		MeleeAttack,
+		PauseScreen,
+		NumberOfBuiltInActions
+	};
+}
+
+template<typename... ActionIDs>
+constexpr ActionMask makeActionMask(ActionIDs... actions)
+{
+	return ((ActionMask(1) << actions) | ... | ActionMask(0));
+}
+
 struct ActionEvent
 {
 	enum Type { Pressed, Released };
 
-	std::string mAction;
+	ActionID mAction;
 	Type mType;
 
-	ActionEvent(const std::string action, const Type type);
+	ActionEvent() = default;
+	ActionEvent(ActionID action, Type type);
 };
 
 }
@@ -4,6 +4,25 @@
 
 namespace ph {
 
+bool ActionEventRing::push(const ActionEvent& event)
+{
+	if(mSize == capacity)
+		return false;
+	mEvents[(mFront + mSize) % capacity] = event;
+	++mSize;
+	return true;
+}
+
+bool ActionEventRing::pop(ActionEvent& event)
+{
+	if(mSize == 0)
+		return false;
+	event = mEvents[mFront];
+	mFront = (mFront + 1) % capacity;
+	--mSize;
+	return true;
+}
+
 void ActionEventManager::init()
 {
 	mEnabled = true;
@@ -22,65 +41,112 @@ void ActionEventManager::init()
 	addAction("pauseScreen", sf::Keyboard::Escape);
 }
 
+ActionID ActionEventManager::getActionID(const std::string& action)
+{
+	const auto namesEnd = mActionNames.begin() + mNumberOfActions;
+	const auto found = std::find(mActionNames.begin(), namesEnd, action);
+	return found != namesEnd ? static_cast<ActionID>(found - mActionNames.begin()) : invalidActionID;
+}
+
+ActionID ActionEventManager::internAction(const std::string& action)
+{
+	ActionID id = getActionID(action);
+	if(id != invalidActionID)
+		return id;
+
+	PH_ASSERT_CRITICAL(mNumberOfActions < maxNumberOfActions, "There can't be more than " + std::to_string(maxNumberOfActions) + " actions!");
+	id = mNumberOfActions++;
+	mActionNames[id] = action;
+	return id;
+}
+
+void ActionEventManager::bindKey(ActionID id, sf::Keyboard::Key button)
+{
+	auto& keys = mActionKeys[id];
+	if(std::find(keys.begin(), keys.end(), button) == keys.end())
+		keys.emplace_back(button);
+	if(button >= 0 && button < sf::Keyboard::KeyCount)
+		mKeyActions[button] |= makeActionMask(id);
+}
+
+void ActionEventManager::unbindKey(ActionID id, sf::Keyboard::Key button)
+{
+	auto& keys = mActionKeys[id];
+	keys.erase(std::remove(keys.begin(), keys.end(), button), keys.end());
+	if(button >= 0 && button < sf::Keyboard::KeyCount)
+		mKeyActions[button] &= ~makeActionMask(id);
+}
+
 void ActionEventManager::addAction(const std::string& action, std::vector<sf::Keyboard::Key> buttons)
 {
-	auto last = std::unique(buttons.begin(), buttons.end());
-	buttons.erase(last, buttons.end());
-	mActions[action] = Action{buttons, true};
+	const ActionID id = internAction(action);
+	for(auto button : mActionKeys[id])
+		unbindKey(id, button);
+	for(auto button : buttons)
+		bindKey(id, button);
+	mEnabledActions |= makeActionMask(id);
 	PH_LOG_INFO("Action was added to ActionEventManager.");
 }
 
 void ActionEventManager::addAction(const std::string& action, sf::Keyboard::Key button)
 {
-	mActions[action] = {std::vector<sf::Keyboard::Key>{button}, true};
-	PH_LOG_INFO("Action was added to ActionEventManager.");
+	addAction(action, std::vector<sf::Keyboard::Key>{button});
 }
 
 void ActionEventManager::addKeyToAction(const std::string& action, sf::Keyboard::Key button)
 {
-	auto found = mActions.find(action);
-
-	if(found != mActions.end()) {
-		auto& vec = found->second.keys;
-		if(std::find(vec.begin(), vec.end(), button) == vec.end())
-			vec.emplace_back(button);
-	}
+	const ActionID id = getActionID(action);
+	if(id != invalidActionID)
+		bindKey(id, button);
 	PH_LOG_INFO("Key was added to action.");
 }
 
 void ActionEventManager::deleteKeyFromAction(const std::string& action, sf::Keyboard::Key button)
 {
-	auto found = mActions.find(action);
-
-	if(found != mActions.end()) {
-		auto& vec = found->second.keys;
-		vec.erase(std::remove(vec.begin(), vec.end(), button), vec.end());
-	}
+	const ActionID id = getActionID(action);
+	if(id != invalidActionID)
+		unbindKey(id, button);
 	PH_LOG_INFO("Key was deleted from action.");
 }
 
 void ActionEventManager::deleteAction(const std::string& action)
 {
-	auto found = mActions.find(action);
-	mActions.erase(found);
+	// NOTE: Action keeps its ID, so IDs cached by systems stay valid
+	const ActionID id = getActionID(action);
+	if(id == invalidActionID)
+		return;
+	while(!mActionKeys[id].empty())
+		unbindKey(id, mActionKeys[id].back());
+	mEnabledActions &= ~makeActionMask(id);
 	PH_LOG_INFO("Action was deleted from ActionEventManager.");
 }
+
+void ActionEventManager::setActionEnabled(ActionID id, bool enabled)
+{
+	if(enabled)
+		mEnabledActions |= makeActionMask(id);
+	else
+		mEnabledActions &= ~makeActionMask(id);
+}
+
 void ActionEventManager::setActionEnabled(const std::string& action, bool enabled)
 {
-	auto found = mActions.find(action);
-	if(found != mActions.end())
-		found->second.enabled = enabled;
+	const ActionID id = getActionID(action);
+	if(id != invalidActionID)
+		setActionEnabled(id, enabled);
 }
 
 void ActionEventManager::setAllActionsEnabled(bool enabled)
 {
-	for(auto& action : mActions)
-		action.second.enabled = enabled;
+	mEnabledActions = enabled ? ~ActionMask(0) : 0;
 }
 
 void ActionEventManager::clearAllActions() noexcept
 {
-	mActions.clear();
+	for(auto& keys : mActionKeys)
+		keys.clear();
+	mKeyActions.fill(0);
+	mEnabledActions = 0;
 	PH_LOG_INFO("All actions were cleared.");
 }
 
@@ -89,37 +155,42 @@ void ActionEventManager::setEnabled(bool enabled)
 	mEnabled = enabled;
 }
 
+void ActionEventManager::updatePressedActions()
+{
+	mPressedActions = 0;
+	for(ActionID id = 0; id < mNumberOfActions; ++id)
+		for(const auto& button : mActionKeys[id])
+			if(sf::Keyboard::isKeyPressed(button)) {
+				mPressedActions |= makeActionMask(id);
+				break;
+			}
+}
+
+bool ActionEventManager::isActionPressed(ActionID id)
+{
+	return mEnabled && (mPressedActions & makeActionMask(id));
+}
+
 bool ActionEventManager::isActionPressed(const std::string& action)
 {
-	if(!mEnabled)
-		return false;
+	const ActionID id = getActionID(action);
+	return id != invalidActionID && isActionPressed(id);
+}
 
-	for(const auto& button : mActions[action].keys)
-		if(sf::Keyboard::isKeyPressed(button))
-			return true;
-	return false;
-}
-
-void ActionEventManager::addActionEventsTo(std::vector<ActionEvent>& actionEvents, const sf::Event currentSfmlEvent)
-{
-	if(currentSfmlEvent.type == sf::Event::KeyPressed || currentSfmlEvent.type == sf::Event::KeyReleased)
-	{
-		for(const auto& action : mActions) 
-		{
-			if(action.second.enabled) 
-			{
-				auto actionKeys = action.second.keys;
-				auto found = std::find(actionKeys.begin(), actionKeys.end(), currentSfmlEvent.key.code);
-				if(found != actionKeys.end()) {
-					ActionEvent actionEvent(
-						action.first,
-						currentSfmlEvent.type == sf::Event::KeyPressed ? ActionEvent::Pressed : ActionEvent::Released
-					);
-					actionEvents.emplace_back(actionEvent);
-				}
-			}
-		}
-	}
+void ActionEventManager::addActionEventsTo(ActionEventRing& actionEvents, const sf::Event& currentSfmlEvent)
+{
+	if(currentSfmlEvent.type != sf::Event::KeyPressed && currentSfmlEvent.type != sf::Event::KeyReleased)
+		return;
+
+	const auto key = currentSfmlEvent.key.code;
+	if(key < 0 || key >= sf::Keyboard::KeyCount)
+		return;
+
+	const auto type = currentSfmlEvent.type == sf::Event::KeyPressed ? ActionEvent::Pressed : ActionEvent::Released;
+	ActionMask actions = mKeyActions[key] & mEnabledActions;
+	for(ActionID id = 0; actions; ++id, actions >>= 1)
+		if(actions & 1)
+			actionEvents.push(ActionEvent(id, type));
 }
 
 }
@@ -2,16 +2,27 @@
 
 #include "actionEvent.hpp"
 #include <SFML/Window.hpp>
+#include <array>
 #include <string>
 #include <vector>
-#include <map>
 
 namespace ph {
 
-struct Action
+// NOTE: Fixed capacity queue, so collecting action events doesn't allocate
+class ActionEventRing
 {
-	std::vector<sf::Keyboard::Key> keys;
-	bool enabled;
+public:
+	static constexpr unsigned capacity = 64;
+
+	bool push(const ActionEvent&);
+	bool pop(ActionEvent&);
+	bool isEmpty() const { return mSize == 0; }
+	unsigned getSize() const { return mSize; }
+
+private:
+	std::array<ActionEvent, capacity> mEvents;
+	unsigned mFront = 0;
+	unsigned mSize = 0;
 };
 
 class ActionEventManager
@@ -20,11 +31,14 @@ public:
 	// TODO: Init it somewhere else
 	static void init();
 
+	static ActionID getActionID(const std::string& action);
+
 	static void addAction(const std::string& action, std::vector<sf::Keyboard::Key>);
 	static void addAction(const std::string& action, sf::Keyboard::Key);
 	static void addKeyToAction(const std::string& action, sf::Keyboard::Key);
 	static void deleteKeyFromAction(const std::string& action, sf::Keyboard::Key);
 	static void deleteAction(const std::string& action);
+	static void setActionEnabled(ActionID, bool enabled);
 	static void setActionEnabled(const std::string& action, bool enabled);
 	static void setAllActionsEnabled(bool enabled);
 	static void clearAllActions() noexcept;
@@ -32,12 +46,32 @@ public:
 	static bool isEnabled() { return mEnabled; }
 	static void setEnabled(bool enabled);
 
+	// NOTE: Pressed actions are sampled once per simulation step, so replays can feed them instead of keyboard
+	static void updatePressedActions();
+	static void setPressedActions(ActionMask pressedActions) { mPressedActions = pressedActions; }
+	static ActionMask getPressedActions() { return mPressedActions; }
+
+	static bool isActionPressed(ActionID);
 	static bool isActionPressed(const std::string& action);
 
-	static void addActionEventsTo(std::vector<ActionEvent>&, const sf::Event currentSfmlEvent);
+	static void addActionEventsTo(ActionEventRing&, const sf::Event& currentSfmlEvent);
+
+private:
+	static ActionID internAction(const std::string& action);
+	static void bindKey(ActionID, sf::Keyboard::Key);
+	static void unbindKey(ActionID, sf::Keyboard::Key);
 
 private:
-	inline static std::map<std::string, Action> mActions;
+	inline static std::array<std::string, maxNumberOfActions> mActionNames = {
+		"movingUp", "movingDown", "movingRight", "movingLeft", "use", "changeWeapon", "gunAttack", "meleeAttack", "pauseScreen"
+	};
+	inline static ActionID mNumberOfActions = Actions::NumberOfBuiltInActions;
+	inline static std::array<std::vector<sf::Keyboard::Key>, maxNumberOfActions> mActionKeys;
+
+	// NOTE: Every key has mask of actions it triggers
+	inline static std::array<ActionMask, sf::Keyboard::KeyCount> mKeyActions{};
+	inline static ActionMask mEnabledActions = 0;
+	inline static ActionMask mPressedActions = 0;
 	inline static bool mEnabled;
 };
 
@@ -12,9 +12,9 @@ bool EventDispatcher::dispatchEvent(ph::Event& event, sf::Window& window)
 		return true;
 	}
 
-	if(!mPendingActionEvents.empty()) {
-		event = mPendingActionEvents.back();
-		mPendingActionEvents.pop_back();
+	ActionEvent actionEvent;
+	if(mPendingActionEvents.pop(actionEvent)) {
+		event = actionEvent;
 		return true;
 	}
 
@@ -3,7 +3,6 @@
 #include "actionEventManager.hpp"
 #include "event.hpp"
 #include <variant>
-#include <vector>
 #include <SFML/Window.hpp>
 
 namespace ph {
@@ -14,7 +13,7 @@ public:
 	static bool dispatchEvent(ph::Event&, sf::Window&);
 
 private:
-	inline static std::vector<ActionEvent> mPendingActionEvents;
+	inline static ActionEventRing mPendingActionEvents;
 };
 
 }
\ No newline at end of file
@@ -5,6 +5,7 @@ namespace ph {
 
 GUI::GUI()
 	:mGameData(nullptr)
+	,mGeneration(1)
 {
 }
 
@@ -14,6 +15,8 @@ Widget* GUI::addInterface(const std::string& name)
 	if (iter.second)
 	{
 		iter.first->second->setGameData(mGameData);
+		mInterfacesIndex.emplace(name, iter.first->second.get());
+		invalidateWidgetRefs();
 		return iter.first->second.get();
 	}
 	return nullptr;
@@ -21,7 +24,44 @@ Widget* GUI::addInterface(const std::string& name)
 
 Widget* GUI::getInterface(const std::string& name)
 {
-	return mInterfaceList.find(name)->second.get();
+	return mInterfacesIndex.find(name)->second;
+}
+
+Widget* GUI::getWidget(const std::string& path)
+{
+	auto found = mWidgetsPaths.find(path);
+	if(found != mWidgetsPaths.end())
+		return found->second;
+
+	Widget* widget = findWidget(path);
+	if(widget)
+		mWidgetsPaths.emplace(path, widget);
+	return widget;
+}
+
+Widget* GUI::findWidget(const std::string& path)
+{
+	std::size_t nameBegin = 0;
+	std::size_t nameEnd = path.find('/');
+
+	auto interface = mInterfacesIndex.find(path.substr(0, nameEnd));
+	if(interface == mInterfacesIndex.end())
+		return nullptr;
+
+	Widget* widget = interface->second;
+	while(widget && nameEnd != std::string::npos)
+	{
+		nameBegin = nameEnd + 1;
+		nameEnd = path.find('/', nameBegin);
+		widget = widget->getWidget(path.substr(nameBegin, nameEnd - nameBegin));
+	}
+	return widget;
+}
+
+void GUI::invalidateWidgetRefs()
+{
+	mWidgetsPaths.clear();
+	++mGeneration;
 }
 
 void GUI::move(const sf::Vector2f& delta)
@@ -33,8 +73,11 @@ void GUI::move(const sf::Vector2f& delta)
 void GUI::deleteInterface(const std::string& name)
 {
 	auto k = mInterfaceList.find(name);
-	if(k != mInterfaceList.end())
+	if(k != mInterfaceList.end()) {
+		mInterfacesIndex.erase(name);
 		mInterfaceList.erase(k);
+		invalidateWidgetRefs();
+	}
 }
 
 void GUI::showInterface(const std::string& name)
@@ -95,7 +138,9 @@ void GUI::init(GameData* gamedata)
 
 void GUI::clearGUI()
 {
+	mInterfacesIndex.clear();
 	mInterfaceList.clear();
+	invalidateWidgetRefs();
 }
 
 }
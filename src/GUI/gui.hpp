@@ -5,6 +5,7 @@
 #include "Resources/resourceHolder.hpp"
 #include <SFML/Graphics.hpp>
 #include <memory>
+#include <unordered_map>
 
 namespace ph {
 
@@ -19,6 +20,10 @@ public:
 
 	Widget* getInterface(const std::string& name);
 
+	// NOTE: Path looks like "interfaceName/widgetName/childWidgetName", found widgets are cached.
+	//       Prefer WidgetRef for widgets which are used every frame.
+	Widget* getWidget(const std::string& path);
+
 	void move(const sf::Vector2f&);
 
 	void deleteInterface(const std::string& name);
@@ -41,10 +46,20 @@ public:
 
 	auto getTextures() -> ResourceHolder<sf::Texture>& { return mTextureHolder; }
 
+	// NOTE: Changes every time widgets could have been destroyed or new interface was added
+	unsigned getGeneration() const { return mGeneration; }
+
+private:
+	Widget* findWidget(const std::string& path);
+	void invalidateWidgetRefs();
+
 private:
 	std::map<std::string, std::unique_ptr<Interface>> mInterfaceList;
+	std::unordered_map<std::string, Interface*> mInterfacesIndex;
+	std::unordered_map<std::string, Widget*> mWidgetsPaths;
 	ResourceHolder<sf::Texture> mTextureHolder;
 	GameData* mGameData;
+	unsigned mGeneration;
 };
 
 }
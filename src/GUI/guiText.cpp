@@ -0,0 +1,131 @@
+#include "guiText.hpp"
+#include "Renderer/renderer.hpp"
+#include <SFML/System/String.hpp>
+#include <algorithm>
+
+namespace ph {
+
+void GuiText::setString(const std::string& string)
+{
+	if(string == mString)
+		return;
+	mString = string;
+	mIsLayoutDirty = true;
+}
+
+void GuiText::setFont(const sf::Font& font)
+{
+	if(&font == mFont)
+		return;
+	mFont = &font;
+	mIsLayoutDirty = true;
+}
+
+void GuiText::setCharacterSize(unsigned size)
+{
+	if(size == mCharacterSize)
+		return;
+	mCharacterSize = size;
+	mIsLayoutDirty = true;
+}
+
+auto GuiText::getLocalBounds() const -> sf::FloatRect
+{
+	updateLayout();
+	return mLocalBounds;
+}
+
+auto GuiText::getGlobalBounds() const -> sf::FloatRect
+{
+	return getTransform().transformRect(getLocalBounds());
+}
+
+void GuiText::draw() const
+{
+	if(!mFont)
+		return;
+
+	updateLayout();
+
+	// NOTE: Glyph atlas is taken after layout, because laying out new glyphs can grow it
+	Renderer::submitGuiGlyphs(mGlyphs, mFont->getTexture(mCharacterSize), mFillColor,
+		getTransform().transformPoint(0.f, 0.f), getScale());
+}
+
+void GuiText::updateLayout() const
+{
+	if(!mIsLayoutDirty)
+		return;
+	mIsLayoutDirty = false;
+
+	mGlyphs.clear();
+	mLocalBounds = sf::FloatRect();
+	if(!mFont || mString.empty())
+		return;
+
+	// NOTE: Layout matches sf::Text without styles, so widgets keep their sizes and positions
+
+	const float whitespaceWidth = mFont->getGlyph(L' ', mCharacterSize, false).advance;
+	const float lineSpacing = mFont->getLineSpacing(mCharacterSize);
+	const float padding = 1.f;
+
+	float x = 0.f;
+	float y = static_cast<float>(mCharacterSize);
+	float minX = static_cast<float>(mCharacterSize);
+	float minY = static_cast<float>(mCharacterSize);
+	float maxX = 0.f;
+	float maxY = 0.f;
+
+	const sf::String string(mString);
+	sf::Uint32 previousChar = 0;
+	for(std::size_t i = 0; i < string.getSize(); ++i)
+	{
+		const sf::Uint32 currentChar = string[i];
+		if(currentChar == L'\r')
+			continue;
+
+		x += mFont->getKerning(previousChar, currentChar, mCharacterSize);
+		previousChar = currentChar;
+
+		if(currentChar == L' ' || currentChar == L'\n' || currentChar == L'\t')
+		{
+			minX = std::min(minX, x);
+			minY = std::min(minY, y);
+
+			if(currentChar == L' ')
+				x += whitespaceWidth;
+			else if(currentChar == L'\t')
+				x += whitespaceWidth * 4;
+			else {
+				y += lineSpacing;
+				x = 0.f;
+			}
+
+			maxX = std::max(maxX, x);
+			maxY = std::max(maxY, y);
+			continue;
+		}
+
+		const sf::Glyph& glyph = mFont->getGlyph(currentChar, mCharacterSize, false);
+		const sf::FloatRect bounds = glyph.bounds;
+		const sf::IntRect& textureRect = glyph.textureRect;
+
+		GuiGlyph guiGlyph;
+		guiGlyph.position = {x + bounds.left - padding, y + bounds.top - padding};
+		guiGlyph.size = {bounds.width + 2 * padding, bounds.height + 2 * padding};
+		guiGlyph.textureRect = FloatRect(textureRect.left - padding, textureRect.top - padding,
+			textureRect.width + 2 * padding, textureRect.height + 2 * padding);
+		mGlyphs.emplace_back(guiGlyph);
+
+		minX = std::min(minX, x + bounds.left);
+		maxX = std::max(maxX, x + bounds.left + bounds.width);
+		minY = std::min(minY, y + bounds.top);
+		maxY = std::max(maxY, y + bounds.top + bounds.height);
+
+		x += glyph.advance;
+	}
+
+	mLocalBounds = sf::FloatRect(minX, minY, maxX - minX, maxY - minY);
+}
+
+}
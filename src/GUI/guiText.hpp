@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Renderer/MinorRenderers/quadData.hpp"
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <string>
+#include <vector>
+
+namespace ph {
+
+// NOTE: Replaces sf::Text in GUI. Glyphs are laid out only when string, font or character size changes,
+//       so drawing unchanged text only submits cached glyphs to Renderer. Rotation isn't supported.
+class GuiText : public sf::Transformable
+{
+public:
+	void setString(const std::string&);
+	void setFont(const sf::Font&);
+	void setCharacterSize(unsigned size);
+	void setFillColor(sf::Color color) { mFillColor = color; }
+
+	auto getString() const -> const std::string& { return mString; }
+	auto getFillColor() const -> sf::Color { return mFillColor; }
+	auto getLocalBounds() const -> sf::FloatRect;
+	auto getGlobalBounds() const -> sf::FloatRect;
+
+	void draw() const;
+
+private:
+	void updateLayout() const;
+
+private:
+	std::string mString;
+	const sf::Font* mFont = nullptr;
+	unsigned mCharacterSize = 30;
+	sf::Color mFillColor = sf::Color::White;
+	mutable std::vector<GuiGlyph> mGlyphs;
+	mutable sf::FloatRect mLocalBounds;
+	mutable bool mIsLayoutDirty = false;
+};
+
+}
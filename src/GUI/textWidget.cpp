@@ -1,6 +1,5 @@
 #include "textWidget.hpp"
 #include "gameData.hpp"
-#include "Renderer/renderer.hpp"
 #include <sstream>
 
 namespace ph {
@@ -13,6 +12,10 @@ TextWidget::TextWidget()
 
 void TextWidget::setString(const std::string& text)
 {
+	// NOTE: Counters are set every frame, but text is laid out and widget is resized only when it changes
+	if(text == mText.getString())
+		return;
+
 	mText.setString(text);
 	auto bounds = mText.getGlobalBounds();
 	auto size = getSize();
@@ -92,7 +95,7 @@ void TextWidget::draw()
 			mText.move(0, -0.35f);
 
 		Widget::draw();
-		Renderer::submitSFMLObject(mText);
+		mText.draw();
 	}
 }
 
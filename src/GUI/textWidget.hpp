@@ -1,6 +1,7 @@
 #pragma once
 
 #include "widget.hpp"
+#include "guiText.hpp"
 
 namespace ph {
 
@@ -38,7 +39,7 @@ public:
 	void setScrollingEffect(bool flag);
 
 private:
-	sf::Text mText;
+	GuiText mText;
 	sf::Vector2f mTextPosition;
 	bool scrollingEffect = false;
 };
@@ -21,7 +21,13 @@ void Widget::draw()
 {
 	if(mIsActive)
 	{
-		Renderer::submitSFMLObject(mSprite);
+		if(const sf::Texture* texture = mSprite.getTexture()) {
+			const sf::FloatRect bounds = mSprite.getGlobalBounds();
+			const sf::IntRect& textureRect = mSprite.getTextureRect();
+			Renderer::submitGuiQuad(texture, FloatRect(static_cast<float>(textureRect.left), static_cast<float>(textureRect.top),
+				static_cast<float>(textureRect.width), static_cast<float>(textureRect.height)),
+				mSprite.getColor(), {bounds.left, bounds.top}, {bounds.width, bounds.height});
+		}
 
 		for(auto k = mWidgetList.rbegin(); k != mWidgetList.rend(); k++)
 			if(k->second->isActive())
@@ -74,8 +80,10 @@ void Widget::handleEventOnCurrent(const ph::Event& phEvent)
 
 void Widget::handleEventOnChildren(const ph::Event& phEvent)
 {
+	// NOTE: Hidden subtrees are skipped here, so they don't cost any virtual call
 	for(const auto& widget : mWidgetList)
-		widget.second->handleEvent(phEvent);
+		if(widget.second->mIsActive)
+			widget.second->handleEvent(phEvent);
 }
 
 void Widget::update(sf::Time dt)
@@ -88,12 +96,14 @@ void Widget::update(sf::Time dt)
 			k.second(this);
 
 	for(const auto& k : mWidgetList)
-		k.second->update(dt);
+		if(k.second->mIsActive)
+			k.second->update(dt);
 }
 
 void Widget::addWidget(const std::string& name, Widget* ptr)
 {
 	mWidgetList.insert({name,std::unique_ptr<Widget>(ptr)});
+	mWidgetsIndex.emplace(name, ptr);
 	ptr->setGameData(mGameData);
 	ptr->setRoot(this);
 	ptr->rePosition();
@@ -189,10 +199,10 @@ void Widget::addBehavior(BehaviorType type, const std::function<void(Widget*)>&
 
 Widget* Widget::getWidget(const std::string& name)
 {
-	auto it = mWidgetList.find(name);
+	auto it = mWidgetsIndex.find(name);
 
-	if(it != mWidgetList.end())
-		return it->second.get();
+	if(it != mWidgetsIndex.end())
+		return it->second;
 
 	return nullptr;
 }
@@ -207,11 +217,6 @@ void Widget::setGameData(GameData* GameData)
 	mWindow = dynamic_cast<sf::RenderWindow*>(&GameData->getWindow());
 }
 
-bool Widget::isActive()
-{
-	return mIsActive;
-}
-
 void Widget::setRoot(Widget* ptr)
 {
 	mRoot = ptr;
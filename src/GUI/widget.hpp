@@ -4,6 +4,7 @@
 #include "Events/event.hpp"
 #include <SFML/Graphics.hpp>
 #include <map>
+#include <unordered_map>
 #include <functional>
 #include <memory>
 
@@ -52,7 +53,7 @@ public:
 
 	virtual void setGameData(GameData* GameData);
 
-	virtual bool isActive();
+	bool isActive() const { return mIsActive; }
 
 	virtual void setRoot(Widget* ptr);
 
@@ -72,6 +73,7 @@ private:
 
 protected:
 	std::multimap<std::string, std::unique_ptr<Widget>> mWidgetList;
+	std::unordered_map<std::string, Widget*> mWidgetsIndex; // NOTE: First added widget with given name, like multimap::find()
 	std::multimap < BehaviorType, std::function<void(Widget*)>> mBehaviors;
 	GameData* mGameData;
 	sf::RenderWindow* mWindow;
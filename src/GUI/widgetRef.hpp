@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string>
+
+namespace ph {
+
+class GUI;
+
+// NOTE: Typed handle to widget which is resolved from its path only when it's used for the first time
+//       and again after GUI interfaces changed, so using it every frame costs a pointer dereference.
+//       Ref reads generation of GUI it was created with, so that GUI has to exist as long as the ref is used.
+template<typename WidgetType>
+class WidgetRef
+{
+public:
+	WidgetRef(GUI& gui, std::string path);
+
+	auto get() const -> WidgetType*;
+	auto operator->() const -> WidgetType* { return get(); }
+	auto operator*() const -> WidgetType& { return *get(); }
+	explicit operator bool() const { return get() != nullptr; }
+
+	auto getPath() const -> const std::string& { return mPath; }
+
+private:
+	GUI* mGui;
+	std::string mPath;
+	mutable WidgetType* mWidget;
+	mutable unsigned mGeneration;
+};
+
+}
+
+#include "widgetRef.inl"
@@ -0,0 +1,29 @@
+#include "gui.hpp"
+#include "Logs/logs.hpp"
+
+namespace ph {
+
+template<typename WidgetType>
+WidgetRef<WidgetType>::WidgetRef(GUI& gui, std::string path)
+	:mGui(&gui)
+	,mPath(std::move(path))
+	,mWidget(nullptr)
+	,mGeneration(0)
+{
+}
+
+template<typename WidgetType>
+auto WidgetRef<WidgetType>::get() const -> WidgetType*
+{
+	// NOTE: Missing widget is looked for again, because interface can be filled with widgets after it was added
+	if(mWidget && mGeneration == mGui->getGeneration())
+		return mWidget;
+
+	Widget* widget = mGui->getWidget(mPath);
+	mWidget = dynamic_cast<WidgetType*>(widget);
+	mGeneration = mGui->getGeneration();
+	PH_ASSERT_UNEXPECTED_SITUATION(!widget || mWidget, "Widget (" + mPath + ") has different type than WidgetRef");
+	return mWidget;
+}
+
+}
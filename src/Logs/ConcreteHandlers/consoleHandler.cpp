@@ -11,6 +11,11 @@ namespace ph {
 				  << std::to_string(logRecord.secondsFromStart).erase(5, 4) << "s ]"
 				  << " | " << std::setw(9) << std::left << logLevelToString(logRecord.level)
 				  << " | " << std::setw(9) << std::left << logRecord.filePath
-				  << " | " << std::left << logRecord.message << std::endl;
+				  << " | " << std::left << logRecord.message << '\n';
+	}
+
+	void ConsoleHandler::flush()
+	{
+		std::cout.flush();
 	}
 }
@@ -7,6 +7,7 @@ namespace ph {
 	class ConsoleHandler : public Handler
 	{
 	public:
+		void flush() override;
 
 	private:
 		virtual void utilizeLog(const LogRecord& logRecord);
@@ -38,5 +38,10 @@ void ph::FileHandler::utilizeLog(const LogRecord& logRecord)
 			 << std::to_string(logRecord.secondsFromStart).erase(5, 4) << "s ]"
 			 << " | " << std::setw(9) << std::left << logLevelToString(logRecord.level)
 			 << " | " << std::setw(9) << std::left << logRecord.filePath
-			 << " | " << std::left << logRecord.message << std::endl;
+			 << " | " << std::left << logRecord.message << '\n';
+}
+
+void ph::FileHandler::flush()
+{
+	mLogFile.flush();
 }
@@ -11,6 +11,8 @@ namespace ph {
 	public:
 		FileHandler(std::string fileName);
 
+		void flush() override;
+
 	private:
 		virtual void utilizeLog(const LogRecord& logRecord);
 
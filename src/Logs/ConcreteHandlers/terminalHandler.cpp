@@ -33,7 +33,7 @@ namespace ph {
 			line.mColor = sf::Color(255, 25, 33);
 			break;
 		}
-		mTerminal->pushOutputLine(line);
+		mTerminal->postOutputLine(line);
 	}
 
 	std::string TerminalHandler::logRecordToString(const LogRecord& logRecord)
@@ -43,7 +43,7 @@ namespace ph {
 			   << std::to_string(logRecord.secondsFromStart).erase(5, 4) << "s ]"
 			   << " | " << std::setw(9) << std::left << logLevelToString(logRecord.level)
 			   << " | " << std::setw(9) << std::left << logRecord.filePath
-			   << " | " << std::left << logRecord.message << std::endl;
+			   << " | " << std::left << logRecord.message << '\n';
 
 		return stream.str();
 	}
@@ -1,12 +1,11 @@
 #include "handler.hpp"
-
-#include <algorithm>
+#include "logger.hpp"
 
 namespace ph {
 	
 	Handler::Handler()
+		:mAllowedLogLevels(0)
 	{
-		initializeLogLevels();
 	}
 
 	void Handler::handleLog(const LogRecord& logRecord)
@@ -21,16 +20,16 @@ namespace ph {
 			mAllowedPaths.emplace_back(path);
 		else
 			mDisallowedPaths.emplace_back(path);
+		Logger::invalidateFilters();
 	}
 
 	void Handler::setLogLevelFilter(LogLevel level, bool allowed)
 	{
-		auto iter = std::find_if(mAllowedLogLevels.begin(), mAllowedLogLevels.end(), [&level](const std::pair<LogLevel, bool>& pair) {
-			return pair.first == level;
-			});
-
-		if (iter != mAllowedLogLevels.end())
-			iter->second = allowed;
+		if (allowed)
+			mAllowedLogLevels |= logLevelToBit(level);
+		else
+			mAllowedLogLevels &= ~logLevelToBit(level);
+		Logger::invalidateFilters();
 	}
 
 	bool Handler::isPathAllowed(const std::string& path) const
@@ -58,11 +57,12 @@ namespace ph {
 
 	bool Handler::isLogLevelAllowed(LogLevel level) const
 	{
-		auto iter = std::find_if(mAllowedLogLevels.begin(), mAllowedLogLevels.end(), [&level](const std::pair<LogLevel, bool>& pair) {
-			return pair.first == level;
-			});
+		return level < LogLevel::Count && (mAllowedLogLevels & logLevelToBit(level));
+	}
 
-		return iter != mAllowedLogLevels.end() && iter->second;
+	std::uint8_t Handler::getAllowedLogLevels(const std::string& path) const
+	{
+		return isPathAllowed(path) ? mAllowedLogLevels : 0;
 	}
 
 	void Handler::enableAllPaths()
@@ -71,31 +71,24 @@ namespace ph {
 		mDisallowedPaths.clear();
 		mAllowedPaths.emplace_back(".");
 		mAllowedPaths.emplace_back("/");
+		Logger::invalidateFilters();
 	}
 
 	void Handler::disableAllPaths()
 	{
 		mAllowedPaths.clear();
 		mDisallowedPaths.clear();
+		Logger::invalidateFilters();
 	}
 
 	void Handler::enableAllLogLevels()
 	{
-		for (auto& level : mAllowedLogLevels)
-			level.second = true;
+		mAllowedLogLevels = logLevelToBit(LogLevel::Count) - 1;
+		Logger::invalidateFilters();
 	}
 
 	bool Handler::isPassedByFilter(const LogRecord& logRecord) const
 	{
-		return isPathAllowed(logRecord.filePath) && isLogLevelAllowed(logRecord.level);
-	}
-
-	void Handler::initializeLogLevels()
-	{
-		auto levelsCount = static_cast<std::size_t>(LogLevel::Count);
-		mAllowedLogLevels.resize(levelsCount);
-
-		for (std::size_t level = 0; level < levelsCount; ++level)
-			mAllowedLogLevels.at(level) = std::make_pair(static_cast<LogLevel>(level), false);
+		return isLogLevelAllowed(logRecord.level) && isPathAllowed(logRecord.filePath);
 	}
 }
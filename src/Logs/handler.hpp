@@ -2,9 +2,9 @@
 
 #include "logRecord.hpp"
 
+#include <cstdint>
 #include <string>
 #include <vector>
-#include <utility>
 
 namespace ph {
 	
@@ -12,6 +12,7 @@ namespace ph {
 	{
 	public:
 		Handler();
+		virtual ~Handler() = default;
 
 		void handleLog(const LogRecord& logRecord);
 
@@ -21,19 +22,26 @@ namespace ph {
 		bool isPathAllowed(const std::string& path) const;
 		bool isLogLevelAllowed(LogLevel level) const;
 
+		// NOTE: Returns bits of log levels which are passed by filter for logs created in given path
+		std::uint8_t getAllowedLogLevels(const std::string& path) const;
+
 		void enableAllPaths();
 		void disableAllPaths();
 		void enableAllLogLevels();
 
+		// NOTE: Called by logging thread after every batch of logs
+		virtual void flush() {}
+
 	private:
+		// NOTE: Logger runs utilizeLog() directly, because it caches filter decisions for every source file
+		friend class Logger;
+
 		virtual void utilizeLog(const LogRecord& logRecord) = 0;
 		bool isPassedByFilter(const LogRecord& logRecord) const;
 
-		void initializeLogLevels();
-
 	private:
 		std::vector<std::string> mAllowedPaths;
 		std::vector<std::string> mDisallowedPaths;
-		std::vector<std::pair<LogLevel, bool>> mAllowedLogLevels;
+		std::uint8_t mAllowedLogLevels;
 	};
 }
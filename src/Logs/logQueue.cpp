@@ -0,0 +1,62 @@
+#include "logQueue.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ph {
+
+	LogQueue::LogQueue()
+		:mCells(new Cell[capacity])
+		,mEnqueuePosition(0)
+		,mDequeuePosition(0)
+	{
+		for (std::size_t i = 0; i < capacity; ++i)
+			mCells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	bool LogQueue::tryPush(LogLevel level, const std::string& message, const char* filePath, unsigned short fileLine, std::int64_t nanosecondsFromStart)
+	{
+		std::size_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+		Cell* cell;
+		for (;;)
+		{
+			cell = &mCells[position & (capacity - 1)];
+			const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+			const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+			if (difference == 0)
+			{
+				if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (difference < 0)
+				return false;
+			else
+				position = mEnqueuePosition.load(std::memory_order_relaxed);
+		}
+
+		auto& record = cell->record;
+		record.filePath = filePath;
+		record.nanosecondsFromStart = nanosecondsFromStart;
+		record.fileLine = fileLine;
+		record.level = level;
+		record.messageSize = static_cast<unsigned char>(std::min(message.size(), QueuedLogRecord::maxMessageSize));
+		record.isMessageTruncated = message.size() > QueuedLogRecord::maxMessageSize;
+		std::memcpy(record.message, message.data(), record.messageSize);
+
+		cell->sequence.store(position + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool LogQueue::tryPop(QueuedLogRecord& record)
+	{
+		Cell& cell = mCells[mDequeuePosition & (capacity - 1)];
+		const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+		if (sequence != mDequeuePosition + 1)
+			return false;
+
+		record = cell.record;
+		cell.sequence.store(mDequeuePosition + capacity, std::memory_order_release);
+		++mDequeuePosition;
+		return true;
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "logRecord.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace ph {
+
+	struct QueuedLogRecord
+	{
+		static constexpr std::size_t maxMessageSize = 230;
+
+		const char* filePath; // NOTE: Points to __FILE__ literal, so the same file always has the same pointer
+		std::int64_t nanosecondsFromStart;
+		unsigned short fileLine;
+		LogLevel level;
+		unsigned char messageSize;
+		bool isMessageTruncated;
+		char message[maxMessageSize];
+	};
+
+	// NOTE: Bounded lock-free queue for many producers and one consumer.
+	//       Every cell has sequence number which tells whether it's ready to be written or read.
+	class LogQueue
+	{
+	public:
+		static constexpr std::size_t capacity = 1024; // WARNING: Has to be power of two
+
+		LogQueue();
+		LogQueue(const LogQueue&) = delete;
+		LogQueue& operator=(const LogQueue&) = delete;
+
+		bool tryPush(LogLevel, const std::string& message, const char* filePath, unsigned short fileLine, std::int64_t nanosecondsFromStart);
+
+		// WARNING: Can be called only by one thread
+		bool tryPop(QueuedLogRecord&);
+
+	private:
+		struct Cell
+		{
+			std::atomic<std::size_t> sequence;
+			QueuedLogRecord record;
+		};
+
+		std::unique_ptr<Cell[]> mCells;
+		alignas(64) std::atomic<std::size_t> mEnqueuePosition;
+		alignas(64) std::size_t mDequeuePosition;
+	};
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 namespace ph {
@@ -14,6 +15,11 @@ namespace ph {
 
 	std::string logLevelToString(LogLevel level);
 
+	constexpr std::uint8_t logLevelToBit(LogLevel level)
+	{
+		return static_cast<std::uint8_t>(1u << static_cast<std::size_t>(level));
+	}
+
 	struct LogRecord
 	{
 		LogLevel level;
@@ -1,7 +1,6 @@
 #include "logger.hpp"
 #include "Utilities/filePath.hpp"
 
-#include <chrono>
 #include <ctime>
 #include <string>
 #include <algorithm>
@@ -16,11 +15,9 @@ namespace {
 		return '0' + std::to_string(number);
 	}
 
-	std::string getCurrentTimeAsString()
+	std::string timeToString(std::chrono::system_clock::time_point time)
 	{
-		// TODO: change this function to use <chrono> instead of ctime and add miliseconds
-
-		auto timePoint = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+		auto timePoint = std::chrono::system_clock::to_time_t(time);
 		tm calendarTime;
 		localtime_s(&calendarTime, &timePoint);
 
@@ -30,32 +27,67 @@ namespace {
 	}
 }
 
-void Logger::createLog(LogLevel level, const std::string& message, const std::string& filePath, unsigned short fileLine)
+std::atomic<std::uint32_t> Logger::sFiltersVersion(1);
+
+Logger::Logger()
+	:mNumberOfCreatedLogs(0)
+	,mNumberOfHandledLogs(0)
+	,mIsStopping(false)
+	,mStartTime(std::chrono::steady_clock::now())
+	,mStartSystemTime(std::chrono::system_clock::now())
 {
-	LogRecord logRecord;
-	logRecord.level = level;
-	logRecord.message = message;
-	logRecord.filePath = FilePath::cutFilePathAndFixSeparator(filePath);
-	logRecord.fileLine = fileLine;
-	logRecord.secondsFromStart = getInstance().mClock.getElapsedTime().asSeconds();
-	logRecord.time = getCurrentTimeAsString();
+	mLoggingThread = std::thread(&Logger::processLogs, this);
+}
 
-	auto& handlers = getInstance().mHandlers;
+Logger::~Logger()
+{
+	{
+		std::lock_guard<std::mutex> lock(mLoggingThreadMutex);
+		mIsStopping = true;
+	}
+	mLogsAdded.notify_one();
+	mLoggingThread.join();
+}
+
+void Logger::createLog(LogLevel level, const std::string& message, const char* filePath, unsigned short fileLine)
+{
+	auto& logger = getInstance();
+	const auto nanosecondsFromStart = std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - logger.mStartTime).count();
 
-	for (auto& handler : handlers)
+	// NOTE: Log is counted before it's pushed, so flush() can't miss it
+	++logger.mNumberOfCreatedLogs;
+	while (!logger.mQueue.tryPush(level, message, filePath, fileLine, nanosecondsFromStart))
 	{
-		handler->handleLog(logRecord);
+		// NOTE: Log created by handler can't wait for logging thread, it would wait for itself
+		if (logger.isLoggingThread())
+		{
+			std::lock_guard<std::mutex> lock(logger.mLoggingThreadMutex);
+			++logger.mNumberOfHandledLogs;
+			return;
+		}
+
+		// NOTE: Queue is full, logging thread has to catch up
+		logger.mLogsAdded.notify_one();
+		std::this_thread::yield();
 	}
+
+	// NOTE: Critical log is followed by closing the game, so it has to be handled right away
+	if (level == LogLevel::Critical)
+		flush();
 }
 
 void Logger::addLogsHandler(std::unique_ptr<Handler> handler)
 {
+	std::lock_guard<std::mutex> lock(getInstance().mHandlersMutex);
 	if (handler)
 		getInstance().mHandlers.emplace_back(std::move(handler));
+	invalidateFilters();
 }
 
 bool Logger::removeLogsHandler(const Handler& handler)
 {
+	std::lock_guard<std::mutex> lock(getInstance().mHandlersMutex);
 	auto& handlers = getInstance().mHandlers;
 	auto iter = std::find_if(handlers.begin(), handlers.end(),
 		[&handler](const std::unique_ptr<Handler>& elem) { return elem.get() == &handler; });
@@ -63,15 +95,136 @@ bool Logger::removeLogsHandler(const Handler& handler)
 	if (iter != handlers.end())
 	{
 		handlers.erase(iter);
+		invalidateFilters();
 		return true;
 	}
 	return false;
 }
 
+void Logger::flush()
+{
+	auto& logger = getInstance();
+
+	// NOTE: Logging thread handles its own logs in the next batch, waiting for them would never end
+	if (logger.isLoggingThread())
+		return;
+
+	const std::uint64_t numberOfLogsToHandle = logger.mNumberOfCreatedLogs;
+
+	std::unique_lock<std::mutex> lock(logger.mLoggingThreadMutex);
+	logger.mLogsAdded.notify_one();
+	logger.mLogsHandled.wait(lock, [&logger, numberOfLogsToHandle]() {
+		return logger.mNumberOfHandledLogs >= numberOfLogsToHandle;
+	});
+}
+
+void Logger::invalidateFilters()
+{
+	++sFiltersVersion;
+}
+
+std::uint8_t Logger::getAllowedLogLevels(const char* filePath)
+{
+	const std::string cutFilePath = FilePath::cutFilePathAndFixSeparator(filePath);
+
+	std::lock_guard<std::mutex> lock(getInstance().mHandlersMutex);
+	std::uint8_t allowedLogLevels = 0;
+	for (const auto& handler : getInstance().mHandlers)
+		allowedLogLevels |= handler->getAllowedLogLevels(cutFilePath);
+	return allowedLogLevels;
+}
+
 Logger& Logger::getInstance()
 {
 	static Logger globalLogger;
 	return globalLogger;
 }
 
-}
\ No newline at end of file
+bool Logger::isLoggingThread() const
+{
+	return std::this_thread::get_id() == mLoggingThread.get_id();
+}
+
+void Logger::processLogs()
+{
+	for (;;)
+	{
+		const std::size_t numberOfHandledLogs = handleQueuedLogs();
+
+		std::unique_lock<std::mutex> lock(mLoggingThreadMutex);
+		if (numberOfHandledLogs > 0)
+		{
+			mNumberOfHandledLogs += numberOfHandledLogs;
+			mLogsHandled.notify_all();
+		}
+		else if (mIsStopping)
+			return;
+		else
+			mLogsAdded.wait_for(lock, std::chrono::milliseconds(10));
+	}
+}
+
+std::size_t Logger::handleQueuedLogs()
+{
+	std::lock_guard<std::mutex> lock(mHandlersMutex);
+
+	std::size_t numberOfHandledLogs = 0;
+	QueuedLogRecord queuedRecord;
+	while (mQueue.tryPop(queuedRecord))
+	{
+		++numberOfHandledLogs;
+
+		const auto& filters = getSourceFileFilters(queuedRecord.filePath);
+		const std::uint8_t levelBit = logLevelToBit(queuedRecord.level);
+		if (!(filters.allowedLogLevels & levelBit))
+			continue;
+
+		fillLogRecord(queuedRecord, filters.cutFilePath);
+		for (std::size_t i = 0; i < mHandlers.size(); ++i)
+			if (filters.handlersLogLevels[i] & levelBit)
+				mHandlers[i]->utilizeLog(mLogRecord);
+	}
+
+	// NOTE: Handlers write whole batch at once
+	if (numberOfHandledLogs > 0)
+		for (auto& handler : mHandlers)
+			handler->flush();
+
+	return numberOfHandledLogs;
+}
+
+void Logger::fillLogRecord(const QueuedLogRecord& queuedRecord, const std::string& cutFilePath)
+{
+	const std::chrono::nanoseconds timeFromStart(queuedRecord.nanosecondsFromStart);
+
+	mLogRecord.level = queuedRecord.level;
+	mLogRecord.message.assign(queuedRecord.message, queuedRecord.messageSize);
+	if (queuedRecord.isMessageTruncated)
+		mLogRecord.message += "...";
+	mLogRecord.filePath = cutFilePath;
+	mLogRecord.fileLine = queuedRecord.fileLine;
+	mLogRecord.secondsFromStart = std::chrono::duration<float>(timeFromStart).count();
+	mLogRecord.time = timeToString(mStartSystemTime + std::chrono::duration_cast<std::chrono::system_clock::duration>(timeFromStart));
+}
+
+auto Logger::getSourceFileFilters(const char* filePath) -> const SourceFileFilters&
+{
+	auto& filters = mSourceFilesFilters[filePath];
+	const std::uint32_t filtersVersion = getFiltersVersion();
+	if (filters.filtersVersion == filtersVersion)
+		return filters;
+
+	if (filters.cutFilePath.empty())
+		filters.cutFilePath = FilePath::cutFilePathAndFixSeparator(filePath);
+	filters.handlersLogLevels.clear();
+	filters.allowedLogLevels = 0;
+	for (const auto& handler : mHandlers)
+	{
+		filters.handlersLogLevels.emplace_back(handler->getAllowedLogLevels(filters.cutFilePath));
+		filters.allowedLogLevels |= filters.handlersLogLevels.back();
+	}
+	filters.filtersVersion = filtersVersion;
+	return filters;
+}
+
+}
@@ -1,33 +1,104 @@
 #pragma once
 
 #include "logRecord.hpp"
+#include "logQueue.hpp"
 #include "handler.hpp"
 
-#include <SFML/System/Clock.hpp>
-
-#include <vector>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace ph {
 
+	// NOTE: Logs are put into lock-free queue by the calling thread,
+	//       formatting them and running handlers is done in batches by logging thread.
 	class Logger
 	{
 	private:
-		Logger() = default;
+		Logger();
+		~Logger();
 		Logger(const Logger&) = delete;
 		Logger& operator=(const Logger&) = delete;
 
 	public:
-		static void createLog(LogLevel level, const std::string& message, const std::string& filePath, unsigned short fileLine);
+		static void createLog(LogLevel level, const std::string& message, const char* filePath, unsigned short fileLine);
 
 		static void addLogsHandler(std::unique_ptr<Handler> handler);
 		static bool removeLogsHandler(const Handler& handler);
 
+		// NOTE: Blocks until all logs created before the call are handled, called by handler it returns right away
+		static void flush();
+
+		// NOTE: Makes every call site and source file compute its filter decisions again
+		static void invalidateFilters();
+		static std::uint32_t getFiltersVersion() { return sFiltersVersion.load(std::memory_order_acquire); }
+		static std::uint8_t getAllowedLogLevels(const char* filePath);
+
 	private:
 		static Logger& getInstance();
+		bool isLoggingThread() const;
+
+		void processLogs();
+		std::size_t handleQueuedLogs();
+		void fillLogRecord(const QueuedLogRecord&, const std::string& cutFilePath);
+
+		struct SourceFileFilters
+		{
+			std::string cutFilePath;
+			std::vector<std::uint8_t> handlersLogLevels;
+			std::uint8_t allowedLogLevels = 0;
+			std::uint32_t filtersVersion = 0;
+		};
+		auto getSourceFileFilters(const char* filePath) -> const SourceFileFilters&;
 
 	private:
+		LogQueue mQueue;
 		std::vector<std::unique_ptr<Handler>> mHandlers;
-		sf::Clock mClock;
+		std::mutex mHandlersMutex;
+
+		std::thread mLoggingThread;
+		std::mutex mLoggingThreadMutex;
+		std::condition_variable mLogsAdded;
+		std::condition_variable mLogsHandled;
+		std::atomic<std::uint64_t> mNumberOfCreatedLogs;
+		std::uint64_t mNumberOfHandledLogs;
+		bool mIsStopping;
+
+		// NOTE: These are used only by logging thread
+		LogRecord mLogRecord;
+		std::unordered_map<const char*, SourceFileFilters> mSourceFilesFilters;
+
+		std::chrono::steady_clock::time_point mStartTime;
+		std::chrono::system_clock::time_point mStartSystemTime;
+
+		static std::atomic<std::uint32_t> sFiltersVersion;
+	};
+
+	// NOTE: Caches filter decision of single PH_LOG call site,
+	//       so log which isn't accepted by any handler doesn't even build its message
+	class LogSite
+	{
+	public:
+		bool isEnabled(LogLevel level, const char* filePath)
+		{
+			std::uint64_t state = mState.load(std::memory_order_relaxed);
+			const std::uint32_t filtersVersion = Logger::getFiltersVersion();
+			if (static_cast<std::uint32_t>(state >> 8) != filtersVersion)
+			{
+				state = (static_cast<std::uint64_t>(filtersVersion) << 8) | Logger::getAllowedLogLevels(filePath);
+				mState.store(state, std::memory_order_relaxed);
+			}
+			return state & logLevelToBit(level);
+		}
+
+	private:
+		// NOTE: Filters version and allowed log levels are stored together, so they can't get out of sync between threads
+		std::atomic<std::uint64_t> mState{0};
 	};
 }
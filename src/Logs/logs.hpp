@@ -6,18 +6,43 @@
 #include "Logs/logRecord.hpp"
 #include "Logs/criticalError.hpp"
 
+// NOTE: Message is built only if any handler accepts logs of this level from this file
 #define PH_LOG(logLevel, message)\
-	ph::Logger::createLog(logLevel, message, __FILE__, static_cast<unsigned short>(__LINE__))
+	do {\
+		static ph::LogSite phLogSite;\
+		if (phLogSite.isEnabled(logLevel, __FILE__))\
+			ph::Logger::createLog(logLevel, message, __FILE__, static_cast<unsigned short>(__LINE__));\
+	} while (false)
 
 #define PH_ASSERT_EXPRESSION(expression, code)\
 	if(!(expression)) code
 
 
+// NOTE: Logs with lower level are removed at compile time together with their messages.
+//       0 - Info, 1 - Warning, 2 - Error. Errors and critical errors are never removed.
+#ifndef PH_MIN_LOG_LEVEL
 #ifdef PH_DEBUG_LOGS_ENABLED
+#define PH_MIN_LOG_LEVEL 0
+#else
+#define PH_MIN_LOG_LEVEL 2
+#endif // PH_DEBUG_LOGS_ENABLED
+#endif // !PH_MIN_LOG_LEVEL
+
+
+#if PH_MIN_LOG_LEVEL <= 0
 
 #define PH_LOG_INFO(message)\
 	PH_LOG(ph::LogLevel::Info, message)
 
+#else
+
+#define PH_LOG_INFO(message)
+
+#endif // PH_MIN_LOG_LEVEL <= 0
+
+
+#if PH_MIN_LOG_LEVEL <= 1
+
 #define PH_LOG_WARNING(message)\
 	PH_LOG(ph::LogLevel::Warning, message)
 
@@ -26,11 +51,10 @@
 
 #else
 
-#define PH_LOG_INFO(message)
 #define PH_LOG_WARNING(message)
 #define PH_ASSERT_WARNING(expression, message)
 
-#endif // PH_DEBUG_LOGS_ENABLED
+#endif // PH_MIN_LOG_LEVEL <= 1
 
 
 #define PH_LOG_ERROR(message)\
@@ -0,0 +1,114 @@
+#include <GL/glew.h>
+#include "programBinaryCache.hpp"
+#include "openglErrors.hpp"
+#include "Logs/logs.hpp"
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include <cstdio>
+
+namespace ph {
+
+namespace {
+	uint64_t fnv1a(std::string_view bytes, uint64_t hash = 14695981039346656037ull)
+	{
+		for(char byte : bytes) {
+			hash ^= static_cast<unsigned char>(byte);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	std::string getDriverString(GLenum name)
+	{
+		auto* string = reinterpret_cast<const char*>(glGetString(name));
+		return string ? string : "";
+	}
+}
+
+void ProgramBinaryCache::init(const char* directory)
+{
+	int numberOfFormats = 0;
+	if(GLEW_ARB_get_program_binary) {
+		GLCheck( glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numberOfFormats) );
+	}
+	mIsEnabled = numberOfFormats > 0;
+	if(!mIsEnabled) {
+		PH_LOG_INFO("Driver doesn't support program binaries, shaders will be compiled on every launch.");
+		return;
+	}
+
+	std::error_code error;
+	std::filesystem::create_directories(directory, error);
+	if(error) {
+		PH_LOG_WARNING("Shader cache directory \"" + std::string(directory) + "\" couldn't be created: " + error.message());
+		mIsEnabled = false;
+		return;
+	}
+
+	mDirectory = directory;
+	mDriver = getDriverString(GL_VENDOR) + '|' + getDriverString(GL_RENDERER) + '|' + getDriverString(GL_VERSION);
+}
+
+auto ProgramBinaryCache::makeKey(std::string_view vertexShaderSource, std::string_view fragmentShaderSource) const -> uint64_t
+{
+	// NOTE: Sources are separated, so moving code between shader stages changes the key
+	uint64_t hash = fnv1a(mDriver);
+	hash = fnv1a(vertexShaderSource, fnv1a("|vs|", hash));
+	return fnv1a(fragmentShaderSource, fnv1a("|fs|", hash));
+}
+
+bool ProgramBinaryCache::load(uint64_t key, unsigned programId) const
+{
+	if(!mIsEnabled)
+		return false;
+
+	std::ifstream file(getFilePath(key), std::ios::binary);
+	GLenum format;
+	if(!file.read(reinterpret_cast<char*>(&format), sizeof(format)))
+		return false;
+	std::vector<char> binary{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+	if(binary.empty())
+		return false;
+
+	// NOTE: Driver may reject stale or corrupted binary with GL error, so it isn't checked with GLCheck.
+	//       Then program is compiled from sources and cache entry is overwritten.
+	glProgramBinary(programId, format, binary.data(), static_cast<GLsizei>(binary.size()));
+	int success = GL_FALSE;
+	glGetProgramiv(programId, GL_LINK_STATUS, &success);
+	while(glGetError() != GL_NO_ERROR) {}
+	if(!success)
+		PH_LOG_INFO("Cached shader program binary was rejected by driver, it will be compiled from sources.");
+	return success;
+}
+
+void ProgramBinaryCache::store(uint64_t key, unsigned programId) const
+{
+	if(!mIsEnabled)
+		return;
+
+	int length = 0;
+	GLCheck( glGetProgramiv(programId, GL_PROGRAM_BINARY_LENGTH, &length) );
+	if(length <= 0)
+		return;
+
+	std::vector<char> binary(length);
+	GLenum format;
+	GLCheck( glGetProgramBinary(programId, length, nullptr, &format, binary.data()) );
+
+	std::ofstream file(getFilePath(key), std::ios::binary | std::ios::trunc);
+	file.write(reinterpret_cast<const char*>(&format), sizeof(format));
+	file.write(binary.data(), binary.size());
+	if(!file)
+		PH_LOG_WARNING("Shader program binary couldn't be written to " + getFilePath(key));
+}
+
+auto ProgramBinaryCache::getFilePath(uint64_t key) const -> std::string
+{
+	char fileName[32];
+	std::snprintf(fileName, sizeof(fileName), "%016llx.bin", static_cast<unsigned long long>(key));
+	return mDirectory + '/' + fileName;
+}
+
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+namespace ph {
+
+// NOTE: Keeps linked shader programs on disk, so they aren't compiled again on next launch.
+//       Binaries are valid only for driver which produced them, so driver is a part of the key.
+class ProgramBinaryCache
+{
+public:
+	void init(const char* directory);
+
+	bool isEnabled() const { return mIsEnabled; }
+	auto makeKey(std::string_view vertexShaderSource, std::string_view fragmentShaderSource) const -> uint64_t;
+
+	bool load(uint64_t key, unsigned programId) const;
+	void store(uint64_t key, unsigned programId) const;
+
+private:
+	auto getFilePath(uint64_t key) const -> std::string;
+
+private:
+	std::string mDirectory;
+	std::string mDriver;
+	bool mIsEnabled = false;
+};
+
+}
@@ -1,20 +1,26 @@
 #include "shader.hpp"
 #include "openglErrors.hpp"
+#include "Resources/resourceFileSystem.hpp"
 #include "Logs/logs.hpp"
 #include <GL/glew.h>
-#include <fstream>
-#include <sstream>
 #include <stdexcept>
+#include <numeric>
+#include <vector>
 #include <iostream>
 
 namespace ph {
 
 Shader::Shader()
+	:mBinaryCache(nullptr)
+	,mBinaryKey(0)
+	,mVertexShaderId(0)
+	,mFragmentShaderId(0)
+	,mIsLinking(false)
 {
 	mID = glCreateProgram();
 }
 
-bool Shader::loadFromFile(const char* vertexShaderFilename, const char* fragmentShaderFilename)
+bool Shader::loadFromFile(const char* vertexShaderFilename, const char* fragmentShaderFilename, const ProgramBinaryCache* binaryCache)
 {
 	auto vertexShaderCode = getShaderCodeFromFile(vertexShaderFilename);
 	auto fragmentShaderCode = getShaderCodeFromFile(fragmentShaderFilename);
@@ -22,42 +28,68 @@ bool Shader::loadFromFile(const char* vertexShaderFilename, const char* fragment
 	if(vertexShaderCode == std::nullopt || fragmentShaderCode == std::nullopt)
 		return false;
 
-	loadFromString(vertexShaderCode->c_str(), fragmentShaderCode->c_str());
+	loadFromString(vertexShaderCode->getBytes(), fragmentShaderCode->getBytes(), binaryCache);
 	return true;
 }
 
-auto Shader::getShaderCodeFromFile(const char* filename) -> const std::optional<std::string>
+auto Shader::getShaderCodeFromFile(const char* filename) -> std::optional<ResourceData>
 {
-	std::string code;
-	std::ifstream file;
-	file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-	try {
-		file.open(filename);
-		std::stringstream stream;
-		stream << file.rdbuf();
-		file.close();
-		code = stream.str();
-	}
-	catch(std::istream::failure) {
+	auto code = ResourceFileSystem::read(filename);
+	if(!code)
 		PH_LOG_ERROR("Shader file \"" + std::string(filename) + "\" was not succesfully read. (probably file doesn't exist)");
-		return std::nullopt;
-	}
 	return code;
 }
 
-void Shader::loadFromString(const char* vertexShaderSource, const char* fragmentShaderSource)
+void Shader::loadFromString(std::string_view vertexShaderSource, std::string_view fragmentShaderSource, const ProgramBinaryCache* binaryCache)
 {
-	int vertexShaderId = compileShaderAndGetId(vertexShaderSource, GL_VERTEX_SHADER);
-	int fragmentShaderId = compileShaderAndGetId(fragmentShaderSource, GL_FRAGMENT_SHADER);
-	linkProgram(vertexShaderId, fragmentShaderId);
+	mBinaryCache = binaryCache && binaryCache->isEnabled() ? binaryCache : nullptr;
+	if(mBinaryCache) {
+		mBinaryKey = mBinaryCache->makeKey(vertexShaderSource, fragmentShaderSource);
+		if(mBinaryCache->load(mBinaryKey, mID)) {
+			bindSamplerArraysToTextureUnits();
+			return;
+		}
+		GLCheck( glProgramParameteri(mID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE) );
+	}
+
+	mVertexShaderId = compileShaderAndGetId(vertexShaderSource, GL_VERTEX_SHADER);
+	mFragmentShaderId = compileShaderAndGetId(fragmentShaderSource, GL_FRAGMENT_SHADER);
+	linkProgram();
 }
 
-int Shader::compileShaderAndGetId(const char* sourceCode, const unsigned shaderType)
+void Shader::finishLoading()
+{
+	if(!mIsLinking)
+		return;
+	mIsLinking = false;
+
+	// NOTE: Compilation status is queried only when linking failed, so driver isn't forced to finish compilation earlier
+	int success;
+	GLCheck( glGetProgramiv(mID, GL_LINK_STATUS, &success) );
+	if(!success) {
+		checkCompilationErrors(mVertexShaderId, GL_VERTEX_SHADER);
+		checkCompilationErrors(mFragmentShaderId, GL_FRAGMENT_SHADER);
+		checkLinkingErrors();
+	}
+
+	GLCheck( glDetachShader(mID, mVertexShaderId) );
+	GLCheck( glDetachShader(mID, mFragmentShaderId) );
+	GLCheck( glDeleteShader(mVertexShaderId) );
+	GLCheck( glDeleteShader(mFragmentShaderId) );
+
+	if(mBinaryCache)
+		mBinaryCache->store(mBinaryKey, mID);
+
+	bindSamplerArraysToTextureUnits();
+}
+
+int Shader::compileShaderAndGetId(std::string_view sourceCode, const unsigned shaderType)
 {
 	unsigned shaderId = glCreateShader(shaderType);
-	GLCheck( glShaderSource(shaderId, 1, &sourceCode, nullptr) );
+	const char* source = sourceCode.data();
+	const int sourceLength = static_cast<int>(sourceCode.size());
+	GLCheck( glShaderSource(shaderId, 1, &source, &sourceLength) );
 	GLCheck( glCompileShader(shaderId) );
-	checkCompilationErrors(shaderId, shaderType);
 	return shaderId;
 }
 
@@ -74,12 +106,12 @@ void Shader::checkCompilationErrors(const unsigned shaderId, const unsigned shad
 	}
 }
 
-void Shader::linkProgram(const int vertexShaderId, const int fragmentShaderId)
+void Shader::linkProgram()
 {
-	GLCheck( glAttachShader(mID, vertexShaderId) );
-	GLCheck( glAttachShader(mID, fragmentShaderId) );
+	GLCheck( glAttachShader(mID, mVertexShaderId) );
+	GLCheck( glAttachShader(mID, mFragmentShaderId) );
 	GLCheck( glLinkProgram(mID) );
-	checkLinkingErrors();
+	mIsLinking = true;
 }
 
 void Shader::checkLinkingErrors()
@@ -93,6 +125,28 @@ void Shader::checkLinkingErrors()
 	}
 }
 
+void Shader::bindSamplerArraysToTextureUnits()
+{
+	// NOTE: Element i of every sampler array samples texture unit i. It's set once here, so renderers don't upload it on every bind
+	int nrOfUniforms = 0;
+	GLCheck( glGetProgramiv(mID, GL_ACTIVE_UNIFORMS, &nrOfUniforms) );
+	for(int i = 0; i < nrOfUniforms; ++i)
+	{
+		char name[64];
+		int size;
+		GLenum type;
+		GLCheck( glGetActiveUniform(mID, i, sizeof(name), nullptr, &size, &type, name) );
+		if(type != GL_SAMPLER_2D || size <= 1)
+			continue;
+
+		std::vector<int> textureUnits(size);
+		std::iota(textureUnits.begin(), textureUnits.end(), 0);
+		bind();
+		setUniformIntArray(name, size, textureUnits.data());
+		unbind();
+	}
+}
+
 void Shader::bind() const
 {
 	GLCheck( glUseProgram(mID) );
@@ -103,87 +157,171 @@ void Shader::unbind() const
 	GLCheck( glUseProgram(0) );
 }
 
+auto Shader::getUniform(const char* name) const -> UniformHandle
+{
+	auto found = mUniformsLocationCache.find(name);
+	if(found != mUniformsLocationCache.end())
+		return {found->second};
+
+	GLCheck( int location = glGetUniformLocation(mID, name) );
+	mUniformsLocationCache.emplace(name, location);
+	return {location};
+}
+
+void Shader::setUniformBool(UniformHandle uniform, const bool value) const
+{
+	GLCheck( glUniform1i(uniform.location, static_cast<int>(value)) );
+}
+
+void Shader::setUniformInt(UniformHandle uniform, const int value) const
+{
+	GLCheck( glUniform1i(uniform.location, value) );
+}
+
+void Shader::setUniformUnsignedInt(UniformHandle uniform, const unsigned value) const
+{
+	GLCheck( glUniform1ui(uniform.location, value) );
+}
+
+void Shader::setUniformFloat(UniformHandle uniform, const float value) const
+{
+	GLCheck( glUniform1f(uniform.location, value) );
+}
+
+void Shader::setUniformVector2(UniformHandle uniform, const sf::Vector2f value) const
+{
+	GLCheck( glUniform2f(uniform.location, value.x, value.y) );
+}
+
+void Shader::setUniformVector2(UniformHandle uniform, const float x, const float y) const
+{
+	GLCheck( glUniform2f(uniform.location, x, y) );
+}
+
+void Shader::setUniformVector3(UniformHandle uniform, const sf::Vector3f value) const
+{
+	GLCheck( glUniform3f(uniform.location, value.x, value.y, value.z) );
+}
+
+void Shader::setUniformVector3(UniformHandle uniform, const float x, const float y, const float z) const
+{
+	GLCheck( glUniform3f(uniform.location, x, y, z) );
+}
+
+void Shader::setUniformVector4Color(UniformHandle uniform, const sf::Color& color) const
+{
+	GLCheck( glUniform4f(uniform.location,
+		static_cast<float>(color.r) / 255.f, static_cast<float>(color.g) / 255.f,
+		static_cast<float>(color.b) / 255.f, static_cast<float>(color.a) / 255.f
+	) );
+}
+
+void Shader::setUniformVector4(UniformHandle uniform, const float x, const float y, const float z, const float w) const
+{
+	GLCheck( glUniform4f(uniform.location, x, y, z, w) );
+}
+
+void Shader::setUniformVector4Rect(UniformHandle uniform, const FloatRect& r) const
+{
+	setUniformVector4(uniform, r.left, r.top, r.width, r.height);
+}
+
+void Shader::setUniformMatrix4x4(UniformHandle uniform, const float* transform) const
+{
+	GLCheck( glUniformMatrix4fv(uniform.location, 1, GL_FALSE, transform) );
+}
+
+void Shader::setUniformFloatArray(UniformHandle uniform, int count, const float* data) const
+{
+	GLCheck( glUniform1fv(uniform.location, count, data) );
+}
+
+void Shader::setUniformIntArray(UniformHandle uniform, int count, const int* data) const
+{
+	GLCheck( glUniform1iv(uniform.location, count, data) );
+}
+
 void Shader::setUniformBool(const char* name, const bool value) const
 {
-	GLCheck( glUniform1i(getUniformLocation(name), static_cast<int>(value)) );
+	setUniformBool(getUniform(name), value);
 }
 
 void Shader::setUniformInt(const char* name, const int value) const
 {
-	GLCheck( glUniform1i(getUniformLocation(name), value) );
+	setUniformInt(getUniform(name), value);
 }
 
 void Shader::setUniformUnsignedInt(const char* name, const unsigned value) const
 {
-	GLCheck( glUniform1ui(getUniformLocation(name), value) );
+	setUniformUnsignedInt(getUniform(name), value);
 }
 
 void Shader::setUniformFloat(const char* name, const float value) const
 {
-	GLCheck( glUniform1f(getUniformLocation(name), value) );
+	setUniformFloat(getUniform(name), value);
 }
 
 void Shader::setUniformVector2(const char* name, const sf::Vector2f value) const
 {
-	GLCheck( glUniform2f(getUniformLocation(name), value.x, value.y) );
+	setUniformVector2(getUniform(name), value);
 }
 
 void Shader::setUniformVector2(const char* name, const float x, const float y) const
 {
-	GLCheck( glUniform2f(getUniformLocation(name), x, y) );
+	setUniformVector2(getUniform(name), x, y);
 }
 
 void Shader::setUniformVector3(const char* name, const sf::Vector3f value) const
 {
-	GLCheck( glUniform3f(getUniformLocation(name), value.x, value.y, value.z) );
+	setUniformVector3(getUniform(name), value);
 }
 
 void Shader::setUniformVector3(const char* name, const float x, const float y, const float z) const
 {
-	GLCheck( glUniform3f(getUniformLocation(name), x, y, z) );
+	setUniformVector3(getUniform(name), x, y, z);
 }
 
 void Shader::setUniformVector4Color(const char* name, const sf::Color& color) const
 {
-	GLCheck( glUniform4f(getUniformLocation(name),
-		static_cast<float>(color.r) / 255.f, static_cast<float>(color.g) / 255.f,
-		static_cast<float>(color.b) / 255.f, static_cast<float>(color.a) / 255.f
-	) );
+	setUniformVector4Color(getUniform(name), color);
 }
 
 void Shader::setUniformVector4(const char* name, const float x, const float y, const float z, const float w) const
 {
-	GLCheck( glUniform4f(getUniformLocation(name), x, y, z, w) );
+	setUniformVector4(getUniform(name), x, y, z, w);
 }
 
 void Shader::setUniformVector4Rect(const char* name, const FloatRect& r) const
 {
-	setUniformVector4(name, r.left, r.top, r.width, r.height);
+	setUniformVector4Rect(getUniform(name), r);
 }
 
 void Shader::setUniformMatrix4x4(const char* name, const float* transform) const
 {
-	GLCheck( glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, transform) );
+	setUniformMatrix4x4(getUniform(name), transform);
 }
 
 void Shader::setUniformFloatArray(const char* name, int count, const float* data) const
 {
-	GLCheck( glUniform1fv(getUniformLocation(name), count, data) );
+	setUniformFloatArray(getUniform(name), count, data);
 }
 
 void Shader::setUniformIntArray(const char* name, int count, const int* data) const
 {
-	GLCheck( glUniform1iv(getUniformLocation(name), count, data) );
+	setUniformIntArray(getUniform(name), count, data);
 }
 
-int Shader::getUniformLocation(const char* name) const
+void ShaderLibrary::init()
 {
-	if(mUniformsLocationCache.find(name) != mUniformsLocationCache.end())
-		return mUniformsLocationCache[name];
+	// NOTE: Driver compiles shaders on its own threads, programs are waited for only in get()
+	if(GLEW_KHR_parallel_shader_compile) {
+		GLCheck( glMaxShaderCompilerThreadsKHR(0xFFFFFFFF) );
+	}
+	else if(GLEW_ARB_parallel_shader_compile) {
+		GLCheck( glMaxShaderCompilerThreadsARB(0xFFFFFFFF) );
+	}
 
-	GLCheck( int location = glGetUniformLocation(mID, name) );
-	mUniformsLocationCache[name] = location;
-	return location;
+	mProgramBinaryCache.init("shaderCache");
 }
 
 bool ShaderLibrary::loadFromFile(const std::string& name, const char* vertexShaderFilepath, const char* fragmentShaderFilepath)
@@ -191,7 +329,7 @@ bool ShaderLibrary::loadFromFile(const std::string& name, const char* vertexShad
 	if(mShaders.find(name) != mShaders.end())
 		return true;
 	Shader shader;
-	if(shader.loadFromFile(vertexShaderFilepath, fragmentShaderFilepath)) {
+	if(shader.loadFromFile(vertexShaderFilepath, fragmentShaderFilepath, &mProgramBinaryCache)) {
 		mShaders[name] = shader;
 		return true;
 	}
@@ -199,12 +337,12 @@ bool ShaderLibrary::loadFromFile(const std::string& name, const char* vertexShad
 		return false;
 }
 
-void ShaderLibrary::loadFromString(const std::string& name, const char* vertexShaderCode, const char* fragmentShaderCode)
+void ShaderLibrary::loadFromString(const std::string& name, std::string_view vertexShaderCode, std::string_view fragmentShaderCode)
 {
 	if(mShaders.find(name) != mShaders.end())
 		return;
 	Shader shader;
-	shader.loadFromString(vertexShaderCode, fragmentShaderCode);
+	shader.loadFromString(vertexShaderCode, fragmentShaderCode, &mProgramBinaryCache);
 	mShaders[name] = shader;
 }
 
@@ -214,6 +352,7 @@ Shader* ShaderLibrary::get(const std::string& name)
 	if(found == mShaders.end()) {
 		PH_EXIT_GAME("You try to get a shader that wasn't loaded: " + name);
 	}
+	found->second.finishLoading();
 	return &found->second;
 }
 
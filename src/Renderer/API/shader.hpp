@@ -1,27 +1,56 @@
 #pragma once
 
 #include "Utilities/rect.hpp"
+#include "Resources/resourceSource.hpp"
+#include "programBinaryCache.hpp"
 #include <SFML/System/Vector2.hpp>
 #include <SFML/System/Vector3.hpp>
 #include <SFML/Graphics/Color.hpp>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <optional>
 #include <map>
 
 namespace ph {
 
+// NOTE: Location of uniform resolved once by Shader::getUniform(), setting uniform through it doesn't look up the name
+struct UniformHandle
+{
+	int location = -1;
+};
+
 class Shader
 {
 public:
 	Shader();
 
-	bool loadFromFile(const char* vertexShaderFilename, const char* fragmentShaderFilename);
-	void loadFromString(const char* vertexShaderSource, const char* fragmentShaderSource);
+	// NOTE: Loading only issues compilation and linking, so driver can work on many programs in parallel.
+	//       finishLoading() has to be called before the shader is used.
+	bool loadFromFile(const char* vertexShaderFilename, const char* fragmentShaderFilename, const ProgramBinaryCache* = nullptr);
+	void loadFromString(std::string_view vertexShaderSource, std::string_view fragmentShaderSource, const ProgramBinaryCache* = nullptr);
+	void finishLoading();
 
 	void bind() const;
 	void unbind() const;
 
+	auto getUniform(const char* name) const -> UniformHandle;
+
+	void setUniformBool(UniformHandle, const bool value) const;
+	void setUniformInt(UniformHandle, const int value) const;
+	void setUniformUnsignedInt(UniformHandle, const unsigned value) const;
+	void setUniformFloat(UniformHandle, const float value) const;
+	void setUniformVector2(UniformHandle, const sf::Vector2f value) const;
+	void setUniformVector2(UniformHandle, const float x, const float y) const;
+	void setUniformVector3(UniformHandle, const sf::Vector3f value) const;
+	void setUniformVector3(UniformHandle, const float x, const float y, const float z) const;
+	void setUniformVector4Color(UniformHandle, const sf::Color&) const;
+	void setUniformVector4(UniformHandle, const float x, const float y, const float z, const float w) const;
+	void setUniformVector4Rect(UniformHandle, const FloatRect&) const;
+	void setUniformMatrix4x4(UniformHandle, const float* transform) const;
+	void setUniformFloatArray(UniformHandle, int count, const float* data) const;
+	void setUniformIntArray(UniformHandle, int count, const int* data) const;
+
 	void setUniformBool(const char* name, const bool value) const;
 	void setUniformInt(const char* name, const int value) const;
 	void setUniformUnsignedInt(const char* name, const unsigned value) const;
@@ -40,17 +69,21 @@ public:
 	unsigned getID() const { return mID; }
 
 private:
-	auto getShaderCodeFromFile(const char* filename) -> const std::optional<std::string>;
-	int compileShaderAndGetId(const char* sourceCode, const unsigned shaderType);
+	auto getShaderCodeFromFile(const char* filename) -> std::optional<ResourceData>;
+	int compileShaderAndGetId(std::string_view sourceCode, const unsigned shaderType);
 	void checkCompilationErrors(const unsigned shaderId, const unsigned shaderType);
-	void linkProgram(const int vertexShaderId, const int fragmentShaderId);
+	void linkProgram();
 	void checkLinkingErrors();
-
-	int getUniformLocation(const char* name) const;
+	void bindSamplerArraysToTextureUnits();
 
 private:
 	mutable std::unordered_map<std::string, int> mUniformsLocationCache;
+	const ProgramBinaryCache* mBinaryCache;
+	uint64_t mBinaryKey;
 	unsigned mID;
+	unsigned mVertexShaderId;
+	unsigned mFragmentShaderId;
+	bool mIsLinking;
 };
 
 class ShaderLibrary
@@ -66,12 +99,15 @@ public:
 		return shaderLibary;
 	}
 
+	void init();
+
 	bool loadFromFile(const std::string& name, const char* vertexShaderFilepath, const char* fragmentShaderFilepath);
-	void loadFromString(const std::string& name, const char* vertexShaderCode, const char* fragmentShaderCode);
+	void loadFromString(const std::string& name, std::string_view vertexShaderCode, std::string_view fragmentShaderCode);
 	Shader* get(const std::string& name);
 
 private:
 	std::map<std::string, Shader> mShaders;
+	ProgramBinaryCache mProgramBinaryCache;
 };
 
 }
@@ -1,7 +1,9 @@
 #include "texture.hpp"
 #include "openglErrors.hpp"
+#include "Resources/resourceFileSystem.hpp"
 #include "Logs/logs.hpp"
 #include <stdexcept>
+#include <cstring>
 #include <GL/glew.h>
 
 //#define STB_IMAGE_IMPLEMENTATION - uncomment if we don't link to sfml-graphics module
@@ -10,6 +12,8 @@
 namespace ph {
 
 Texture::Texture()
+	:mSize(0, 0)
+	,mNumberOfChannels(0)
 {
 	GLCheck( glGenTextures(1, &mID) );
 	GLCheck( glBindTexture(GL_TEXTURE_2D, mID) );
@@ -33,33 +37,98 @@ Texture::~Texture()
 
 bool Texture::loadFromFile(const std::string& filepath)
 {
-	stbi_set_flip_vertically_on_load(true);
-	int numberOfChanels;
-	unsigned char* data = stbi_load(filepath.c_str(), &mSize.x, &mSize.y, &numberOfChanels, 0);
-	stbi_set_flip_vertically_on_load(false);
+	TextureData data;
+	if(!decodeFile(filepath, data))
+		return false;
+
+	if(!loadFromTextureData(data))
+		PH_EXIT_GAME("Texture format of \"" + filepath + "\" is unsupported!");
+
+	return true;
+}
 
-	if(data == nullptr)
+bool Texture::loadFromMemory(const void* encodedImage, std::size_t size)
+{
+	TextureData data;
+	if(!decodeMemory(std::string_view(static_cast<const char*>(encodedImage), size), data))
 		return false;
 
+	if(!loadFromTextureData(data))
+		PH_EXIT_GAME("Texture format is unsupported!");
+
+	return true;
+}
+
+bool Texture::loadFromTextureData(const TextureData& data, unsigned pixelBufferID)
+{
 	GLenum dataFormat = 0, internalDataFormat = 0;
-	if(numberOfChanels == 3) {
+	if(data.numberOfChannels == 3) {
 		internalDataFormat = GL_RGB8;
 		dataFormat = GL_RGB;
 		GLCheck( glPixelStorei(GL_UNPACK_ALIGNMENT, 1) );
 	}
-	else if(numberOfChanels == 4) {
+	else if(data.numberOfChannels == 4) {
 		internalDataFormat = GL_RGBA8;
 		dataFormat = GL_RGBA;
 		GLCheck( glPixelStorei(GL_UNPACK_ALIGNMENT, 4) );
 	}
 	else
-		PH_EXIT_GAME("Texture format of \"" + filepath + "\" is unsupported!");
+		return false;
+
+	mSize = data.size;
+	mNumberOfChannels = data.numberOfChannels;
+	GLCheck( glBindTexture(GL_TEXTURE_2D, mID) );
 
-	GLCheck( glTexImage2D(GL_TEXTURE_2D, 0, internalDataFormat, mSize.x, mSize.y, 0, dataFormat, GL_UNSIGNED_BYTE, data) );
+	// NOTE: Staging through pixel buffer lets driver copy pixels asynchronously
+	void* stagedPixels = nullptr;
+	if(pixelBufferID) {
+		GLCheck( glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBufferID) );
+		GLCheck( glBufferData(GL_PIXEL_UNPACK_BUFFER, data.pixels.size(), nullptr, GL_STREAM_DRAW) );
+		stagedPixels = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, data.pixels.size(), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+		if(stagedPixels) {
+			std::memcpy(stagedPixels, data.pixels.data(), data.pixels.size());
+			GLCheck( glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) );
+		}
+		else {
+			GLCheck( glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0) );
+		}
+	}
+
+	const void* pixels = stagedPixels ? nullptr : data.pixels.data();
+	GLCheck( glTexImage2D(GL_TEXTURE_2D, 0, internalDataFormat, mSize.x, mSize.y, 0, dataFormat, GL_UNSIGNED_BYTE, pixels) );
 	GLCheck( glGenerateMipmap(GL_TEXTURE_2D) );
 
-	stbi_image_free(data);
+	if(stagedPixels) {
+		GLCheck( glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0) );
+	}
+
+	return true;
+}
+
+bool Texture::decodeFile(const std::string& filepath, TextureData& data)
+{
+	const auto file = ResourceFileSystem::read(filepath);
+	return file && decodeMemory(file->getBytes(), data);
+}
+
+bool Texture::decodeMemory(std::string_view encodedImage, TextureData& data)
+{
+	// NOTE: We don't use stbi_set_flip_vertically_on_load() because it's global state shared between threads,
+	//       rows are flipped while copying instead
+	int width, height, numberOfChannels;
+	const auto* encoded = reinterpret_cast<const unsigned char*>(encodedImage.data());
+	unsigned char* decoded = stbi_load_from_memory(encoded, static_cast<int>(encodedImage.size()), &width, &height, &numberOfChannels, 0);
+	if(decoded == nullptr)
+		return false;
+
+	const std::size_t rowSize = static_cast<std::size_t>(width) * numberOfChannels;
+	data.pixels.resize(rowSize * height);
+	for(int row = 0; row < height; ++row)
+		std::memcpy(data.pixels.data() + rowSize * row, decoded + rowSize * (height - row - 1), rowSize);
+	data.size = {width, height};
+	data.numberOfChannels = numberOfChannels;
 
+	stbi_image_free(decoded);
 	return true;
 }
 
@@ -71,6 +140,13 @@ void Texture::setData(void* rgbaData, unsigned arraySize, sf::Vector2i textureSi
 	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, textureSize.x, textureSize.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgbaData);
 }
 
+std::size_t Texture::getMemorySize() const
+{
+	// NOTE: Mipmaps take additional third of the base level
+	const std::size_t baseLevelSize = static_cast<std::size_t>(mSize.x) * mSize.y * mNumberOfChannels;
+	return baseLevelSize + baseLevelSize / 3;
+}
+
 void Texture::bind(unsigned slot) const
 {
 	GLCheck( glActiveTexture(GL_TEXTURE0 + slot) );
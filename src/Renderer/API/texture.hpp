@@ -1,10 +1,19 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <vector>
 #include <SFML/System/Vector2.hpp>
 
 namespace ph {
 
+struct TextureData
+{
+	std::vector<unsigned char> pixels;
+	sf::Vector2i size;
+	int numberOfChannels = 0;
+};
+
 class Texture
 {
 public:
@@ -14,17 +23,25 @@ public:
 	~Texture();
 
 	bool loadFromFile(const std::string& filepath);
+	bool loadFromMemory(const void* encodedImage, std::size_t size);
+	bool loadFromTextureData(const TextureData&, unsigned pixelBufferID = 0);
 	void setData(void* rgbaData, unsigned arraySize, sf::Vector2i textureSize);
 
+	// NOTE: Doesn't touch OpenGL so it can be called from any thread
+	static bool decodeFile(const std::string& filepath, TextureData& data);
+	static bool decodeMemory(std::string_view encodedImage, TextureData& data);
+
 	void bind(unsigned slot = 0) const;
 
 	sf::Vector2i getSize() const { return mSize; }
 	int getWidth() const { return mSize.x; }
 	int getHeight() const { return mSize.y; }
+	std::size_t getMemorySize() const;
 
 private:
 	sf::Vector2i mSize;
 	unsigned mID;
+	int mNumberOfChannels;
 };
 
 }
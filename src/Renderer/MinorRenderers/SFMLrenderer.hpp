@@ -5,8 +5,8 @@
 
 namespace ph {
 
-// This is only temporary stuff and it's used only for drawing GUI
-// Later we'll draw everything including GUI with our own renderer
+// This is only temporary stuff and it's used only for drawing terminal and debug counter
+// GUI is already drawn by GuiRenderer, later we'll draw everything with our own renderer
 
 class SFMLRenderer
 {
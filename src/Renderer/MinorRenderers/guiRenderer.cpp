@@ -0,0 +1,168 @@
+#include "guiRenderer.hpp"
+#include "Renderer/API/shader.hpp"
+#include "Renderer/API/openglErrors.hpp"
+#include "Utilities/cast.hpp"
+#include "Utilities/profiling.hpp"
+#include <SFML/Graphics/Texture.hpp>
+#include <GL/glew.h>
+#include <cstring>
+
+namespace ph {
+
+namespace {
+	constexpr unsigned maxTexturesPerDrawCall = 16;
+}
+
+void GuiRenderer::init()
+{
+	mGuiShader = ShaderLibrary::getInstance().get("gui");
+
+	// NOTE: GUI uses the same view as SFMLRenderer
+	mGuiShader->bind();
+	mGuiShader->setUniformVector2("viewSize", 640.f, 480.f);
+
+	unsigned quadIndices[] = {0, 1, 3, 1, 2, 3};
+	mQuadIBO.init();
+	mQuadIBO.setData(quadIndices, sizeof(quadIndices));
+
+	GLCheck( glGenVertexArrays(1, &mVAO) );
+	GLCheck( glBindVertexArray(mVAO) );
+
+	mQuadIBO.bind();
+
+	GLCheck( glGenBuffers(1, &mQuadsDataVBO) );
+	GLCheck( glBindBuffer(GL_ARRAY_BUFFER, mQuadsDataVBO) );
+
+	setQuadsDataLayout(0);
+	for(int i = 0; i < 5; ++i) {
+		GLCheck( glEnableVertexAttribArray(i) );
+		GLCheck( glVertexAttribDivisor(i, 1) );
+	}
+
+	mQuadsData.reserve(256);
+}
+
+void GuiRenderer::shutDown()
+{
+	mQuadIBO.remove();
+	GLCheck( glDeleteBuffers(1, &mQuadsDataVBO) );
+	GLCheck( glDeleteVertexArrays(1, &mVAO) );
+	mUploadedQuadsData.clear();
+}
+
+void GuiRenderer::setDebugNumbersToZero()
+{
+	mNumberOfDrawCalls = 0;
+	mNumberOfDrawnQuads = 0;
+}
+
+void GuiRenderer::submitQuad(const sf::Texture* texture, const FloatRect& textureRect, sf::Color color,
+                             sf::Vector2f position, sf::Vector2f size)
+{
+	GuiQuadData quadData;
+	quadData.color = Cast::toNormalizedColorVector4f(color);
+	quadData.textureRect = textureRect;
+	quadData.position = position;
+	quadData.size = size;
+	quadData.textureSlotRef = texture ? getTextureSlotRef(texture) : -1.f;
+	mQuadsData.emplace_back(quadData);
+}
+
+void GuiRenderer::submitGlyphs(const std::vector<GuiGlyph>& glyphs, const sf::Texture& glyphAtlas, sf::Color color,
+                               sf::Vector2f position, sf::Vector2f scale)
+{
+	if(glyphs.empty())
+		return;
+
+	GuiQuadData quadData;
+	quadData.color = Cast::toNormalizedColorVector4f(color);
+	quadData.textureSlotRef = getTextureSlotRef(&glyphAtlas);
+	for(const auto& glyph : glyphs)
+	{
+		quadData.textureRect = glyph.textureRect;
+		quadData.position = {position.x + glyph.position.x * scale.x, position.y + glyph.position.y * scale.y};
+		quadData.size = {glyph.size.x * scale.x, glyph.size.y * scale.y};
+		mQuadsData.emplace_back(quadData);
+	}
+}
+
+float GuiRenderer::getTextureSlotRef(const sf::Texture* texture)
+{
+	if(!mDrawCalls.empty())
+	{
+		const DrawCall& drawCall = mDrawCalls.back();
+		for(unsigned i = 0; i < drawCall.numberOfTextures; ++i)
+			if(mTextures[drawCall.firstTexture + i] == texture)
+				return static_cast<float>(i);
+	}
+
+	// NOTE: Quads submitted earlier could have been drawn without texture, so the first draw call starts with them
+	if(mDrawCalls.empty())
+		mDrawCalls.emplace_back(DrawCall{0, 0, 0});
+	else if(mDrawCalls.back().numberOfTextures == maxTexturesPerDrawCall)
+		mDrawCalls.emplace_back(DrawCall{static_cast<unsigned>(mQuadsData.size()), static_cast<unsigned>(mTextures.size()), 0});
+
+	mTextures.emplace_back(texture);
+	return static_cast<float>(mDrawCalls.back().numberOfTextures++);
+}
+
+bool GuiRenderer::isBatchTheSameAsUploadedOne() const
+{
+	return mQuadsData.size() == mUploadedQuadsData.size() &&
+		std::memcmp(mQuadsData.data(), mUploadedQuadsData.data(), mQuadsData.size() * sizeof(GuiQuadData)) == 0;
+}
+
+void GuiRenderer::setQuadsDataLayout(unsigned firstQuad)
+{
+	const size_t offset = firstQuad * sizeof(GuiQuadData);
+	GLCheck( glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(GuiQuadData), (void*) (offset + offsetof(GuiQuadData, color))) );
+	GLCheck( glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(GuiQuadData), (void*) (offset + offsetof(GuiQuadData, textureRect))) );
+	GLCheck( glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(GuiQuadData), (void*) (offset + offsetof(GuiQuadData, position))) );
+	GLCheck( glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(GuiQuadData), (void*) (offset + offsetof(GuiQuadData, size))) );
+	GLCheck( glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(GuiQuadData), (void*) (offset + offsetof(GuiQuadData, textureSlotRef))) );
+}
+
+void GuiRenderer::flush()
+{
+	PH_PROFILE_FUNCTION();
+
+	if(mQuadsData.empty()) {
+		mUploadedQuadsData.clear();
+		return;
+	}
+
+	if(mDrawCalls.empty())
+		mDrawCalls.emplace_back(DrawCall{0, 0, 0});
+
+	mGuiShader->bind();
+	GLCheck( glBindVertexArray(mVAO) );
+	GLCheck( glBindBuffer(GL_ARRAY_BUFFER, mQuadsDataVBO) );
+
+	const unsigned numberOfQuads = static_cast<unsigned>(mQuadsData.size());
+	if(!isBatchTheSameAsUploadedOne()) {
+		GLCheck( glBufferData(GL_ARRAY_BUFFER, numberOfQuads * sizeof(GuiQuadData), mQuadsData.data(), GL_DYNAMIC_DRAW) );
+		mUploadedQuadsData.swap(mQuadsData);
+	}
+
+	for(size_t i = 0; i < mDrawCalls.size(); ++i)
+	{
+		const DrawCall& drawCall = mDrawCalls[i];
+		const unsigned endQuad = i + 1 < mDrawCalls.size() ? mDrawCalls[i + 1].firstQuad : numberOfQuads;
+
+		for(unsigned slot = 0; slot < drawCall.numberOfTextures; ++slot) {
+			GLCheck( glActiveTexture(GL_TEXTURE0 + slot) );
+			GLCheck( glBindTexture(GL_TEXTURE_2D, mTextures[drawCall.firstTexture + slot]->getNativeHandle()) );
+		}
+
+		setQuadsDataLayout(drawCall.firstQuad);
+		GLCheck( glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0, endQuad - drawCall.firstQuad) );
+		++mNumberOfDrawCalls;
+	}
+	mNumberOfDrawnQuads += numberOfQuads;
+
+	mQuadsData.clear();
+	mTextures.clear();
+	mDrawCalls.clear();
+}
+
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "quadData.hpp"
+#include "Renderer/API/indexBuffer.hpp"
+#include <SFML/Graphics/Color.hpp>
+#include <vector>
+
+namespace sf {
+	class Texture;
+}
+
+namespace ph {
+
+class Shader;
+
+// NOTE: Draws GUI quads and glyph runs in the order they were submitted, with as few draw calls as possible.
+//       Batch is uploaded again only if it differs from the one drawn in the previous frame.
+class GuiRenderer
+{
+public:
+	void init();
+	void shutDown();
+
+	unsigned getNumberOfDrawCalls() const { return mNumberOfDrawCalls; }
+	unsigned getNumberOfDrawnQuads() const { return mNumberOfDrawnQuads; }
+	void setDebugNumbersToZero();
+
+	void submitQuad(const sf::Texture*, const FloatRect& textureRect, sf::Color, sf::Vector2f position, sf::Vector2f size);
+	void submitGlyphs(const std::vector<GuiGlyph>&, const sf::Texture& glyphAtlas, sf::Color, sf::Vector2f position, sf::Vector2f scale);
+
+	void flush();
+
+private:
+	float getTextureSlotRef(const sf::Texture*);
+	bool isBatchTheSameAsUploadedOne() const;
+	void setQuadsDataLayout(unsigned firstQuad);
+
+private:
+	struct DrawCall
+	{
+		unsigned firstQuad;
+		unsigned firstTexture;
+		unsigned numberOfTextures;
+	};
+
+	std::vector<GuiQuadData> mQuadsData;
+	std::vector<const sf::Texture*> mTextures;
+	std::vector<DrawCall> mDrawCalls;
+	std::vector<GuiQuadData> mUploadedQuadsData;
+	Shader* mGuiShader;
+	IndexBuffer mQuadIBO;
+	unsigned mQuadsDataVBO;
+	unsigned mVAO;
+	unsigned mNumberOfDrawCalls = 0;
+	unsigned mNumberOfDrawnQuads = 0;
+};
+
+}
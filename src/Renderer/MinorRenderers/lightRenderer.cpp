@@ -7,18 +7,31 @@
 #include <optional>
 #include <cmath>
 #include <algorithm>
+#include <cstddef>
 #include <GL/glew.h>
 
 namespace ph {
 
+namespace {
+	// NOTE: Has to match size of lights array in light shaders, 256 lights fit in minimal guaranteed uniform block size
+	constexpr std::size_t maxLightsPerDrawCall = 256;
+	constexpr unsigned lightsUniformBlockBinding = 1;
+}
+
 void LightRenderer::init()
 {
-	auto& sl = ShaderLibrary::getInstance();
-	sl.loadFromFile("light", "resources/shaders/light.vs.glsl", "resources/shaders/light.fs.glsl");
-	mLightShader = sl.get("light");
+	mLightShader = ShaderLibrary::getInstance().get("light");
+	mCameraZoomUniform = mLightShader->getUniform("cameraZoom");
 
 	unsigned uniformBlockIndex = glGetUniformBlockIndex(mLightShader->getID(), "SharedData");
 	glUniformBlockBinding(mLightShader->getID(), uniformBlockIndex, 0);
+	unsigned lightsBlockIndex = glGetUniformBlockIndex(mLightShader->getID(), "LightsData");
+	glUniformBlockBinding(mLightShader->getID(), lightsBlockIndex, lightsUniformBlockBinding);
+
+	glGenBuffers(1, &mLightsUBO);
+	glBindBuffer(GL_UNIFORM_BUFFER, mLightsUBO);
+	glBufferData(GL_UNIFORM_BUFFER, maxLightsPerDrawCall * sizeof(LightUniformData), nullptr, GL_STREAM_DRAW);
+	glBindBufferBase(GL_UNIFORM_BUFFER, lightsUniformBlockBinding, mLightsUBO);
 	
 	glGenVertexArrays(1, &mVAO);
 	glBindVertexArray(mVAO);
@@ -27,13 +40,16 @@ void LightRenderer::init()
 	glBindBuffer(GL_ARRAY_BUFFER, mVBO);
 
 	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), ( void*) 0);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(LightVertex), (void*) offsetof(LightVertex, position));
+	glEnableVertexAttribArray(1);
+	glVertexAttribIPointer(1, 1, GL_INT, sizeof(LightVertex), (void*) offsetof(LightVertex, lightIndex));
 
 	mLightPolygonVertexData.reserve(361);
 }
 
 void LightRenderer::shutDown()
 {
+	glDeleteBuffers(1, &mLightsUBO);
 	glDeleteBuffers(1, &mVBO);
 	glDeleteVertexArrays(1, &mVAO);
 }
@@ -73,8 +89,11 @@ void LightRenderer::flush()
 
 	for(auto& light : mLights)
 	{
+		const int firstVertex = static_cast<int>(mLightPolygonVertexData.size());
+		const int lightIndex = static_cast<int>(mLightFanFirstVertices.size() % maxLightsPerDrawCall);
+
 		// make light position be first vertex of triangle fan
-		mLightPolygonVertexData.emplace_back(light.pos);
+		mLightPolygonVertexData.emplace_back(LightVertex{light.pos, lightIndex});
 
 		// create vertex data
 		{
@@ -97,27 +116,18 @@ void LightRenderer::flush()
 						nearestIntersectionDistance = intersectionDistance;
 					}
 				}
-				mLightPolygonVertexData.emplace_back(nearestIntersectionPoint);
+				mLightPolygonVertexData.emplace_back(LightVertex{nearestIntersectionPoint, lightIndex});
 			}
 		}
 
-		// draw light using triangle fan
-		if(sDebug.drawLight)
-		{
-			PH_PROFILE_SCOPE("draw light triangle fan");
-
-			mLightShader->bind();
-			mLightShader->setUniformVector2("lightPos", light.pos);
-			mLightShader->setUniformVector4Color("color", light.color);
-			mLightShader->setUniformFloat("cameraZoom", mScreenBounds->height / 480);
-			mLightShader->setUniformFloat("a", light.attenuationAddition);
-			mLightShader->setUniformFloat("b", light.attenuationFactor);
-			mLightShader->setUniformFloat("c", light.attenuationSquareFactor);
-			glBindVertexArray(mVAO);
-			glBindBuffer(GL_ARRAY_BUFFER ,mVBO); // TODO: Do I have to bind it?
-			glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 2 * mLightPolygonVertexData.size(), mLightPolygonVertexData.data(), GL_STATIC_DRAW);
-			glDrawArrays(GL_TRIANGLE_FAN, 0, mLightPolygonVertexData.size());
-		}
+		// NOTE: Lights are drawn together after all of them are ray casted
+		mLightFanFirstVertices.emplace_back(firstVertex);
+		mLightFanVertexCounts.emplace_back(static_cast<int>(mLightPolygonVertexData.size()) - firstVertex);
+		mLightsUniformData.emplace_back(LightUniformData{
+			{light.color.r / 255.f, light.color.g / 255.f, light.color.b / 255.f, light.color.a / 255.f},
+			{light.pos.x, light.pos.y},
+			light.attenuationAddition, light.attenuationFactor, light.attenuationSquareFactor, {}
+		});
 
 		// draw debug 
 		if(sDebug.drawWalls)
@@ -126,21 +136,48 @@ void LightRenderer::flush()
 
 		if(sDebug.drawRays)
 		{
-			for(auto& point : mLightPolygonVertexData) {
-				Renderer::submitPoint(point, light.color, 0, 7.f);
-				Renderer::submitLine(light.color, light.pos, point, 3.f);
+			for(auto vertex = mLightPolygonVertexData.begin() + firstVertex; vertex != mLightPolygonVertexData.end(); ++vertex) {
+				Renderer::submitPoint(vertex->position, light.color, 0, 7.f);
+				Renderer::submitLine(light.color, light.pos, vertex->position, 3.f);
 			}
 			for(const auto& light : mLights)
 				Renderer::submitPoint(light.pos, light.color, 0, 15.f);
 		}
-
-		mLightPolygonVertexData.clear();
 	}
 
+	if(sDebug.drawLight && !mLights.empty())
+		drawLights();
+
+	mLightPolygonVertexData.clear();
+	mLightsUniformData.clear();
+	mLightFanFirstVertices.clear();
+	mLightFanVertexCounts.clear();
+
 	mWalls.clear();
 	mLights.clear();
 }
 
+void LightRenderer::drawLights()
+{
+	PH_PROFILE_FUNCTION();
+
+	mLightShader->bind();
+	mLightShader->setUniformFloat(mCameraZoomUniform, mScreenBounds->height / 480);
+	glBindVertexArray(mVAO);
+	glBindBuffer(GL_ARRAY_BUFFER, mVBO);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(LightVertex) * mLightPolygonVertexData.size(), mLightPolygonVertexData.data(), GL_STREAM_DRAW);
+	glBindBuffer(GL_UNIFORM_BUFFER, mLightsUBO);
+
+	// NOTE: Every light is a separate triangle fan which reads its parameters from uniform block by light index
+	for(std::size_t firstLight = 0; firstLight < mLights.size(); firstLight += maxLightsPerDrawCall)
+	{
+		const std::size_t nrOfLights = std::min(maxLightsPerDrawCall, mLights.size() - firstLight);
+		glBufferSubData(GL_UNIFORM_BUFFER, 0, nrOfLights * sizeof(LightUniformData), mLightsUniformData.data() + firstLight);
+		glMultiDrawArrays(GL_TRIANGLE_FAN, mLightFanFirstVertices.data() + firstLight, mLightFanVertexCounts.data() + firstLight,
+			static_cast<GLsizei>(nrOfLights));
+	}
+}
+
 auto LightRenderer::getIntersectionPoint(const sf::Vector2f rayDir, sf::Vector2f lightPos, const Wall& wall) -> std::optional<sf::Vector2f>
 {
 	const float x1 = wall.point1.x;
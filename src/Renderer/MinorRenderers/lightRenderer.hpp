@@ -2,13 +2,12 @@
  
 #include <SFML/Graphics/Color.hpp>
 #include "Utilities/rect.hpp"
+#include "Renderer/API/shader.hpp"
 #include <vector>
 #include <optional>
 
 namespace ph { 
 
-class Shader;
-
 struct LightingDebug
 {
 	bool drawLight = true;
@@ -41,6 +40,23 @@ struct Wall
 	sf::Vector2f point2;
 };
 
+struct LightVertex
+{
+	sf::Vector2f position;
+	int lightIndex;
+};
+
+// NOTE: Matches std140 layout of Light struct in LightsData uniform block of light shaders
+struct LightUniformData
+{
+	float color[4];
+	float position[2];
+	float attenuationAddition;
+	float attenuationFactor;
+	float attenuationSquareFactor;
+	float padding[3];
+};
+
 // TODO_ren: Add submit light blocking line
 
 class LightRenderer
@@ -59,14 +75,19 @@ public:
 
 private:
 	auto getIntersectionPoint(const sf::Vector2f rayDir, sf::Vector2f lightPos, const Wall& wall) -> std::optional<sf::Vector2f>;
+	void drawLights();
 
 private:
 	std::vector<Wall> mWalls;
 	std::vector<Light> mLights;
-	std::vector<sf::Vector2f> mLightPolygonVertexData;
+	std::vector<LightVertex> mLightPolygonVertexData;
+	std::vector<LightUniformData> mLightsUniformData;
+	std::vector<int> mLightFanFirstVertices;
+	std::vector<int> mLightFanVertexCounts;
 	const FloatRect* mScreenBounds;
 	Shader* mLightShader;
-	unsigned mVAO, mVBO;
+	UniformHandle mCameraZoomUniform;
+	unsigned mVAO, mVBO, mLightsUBO;
 
 	inline static LightingDebug sDebug;
 };
@@ -10,9 +10,7 @@ namespace ph {
 
 void LineRenderer::init()
 {
-	auto& sl = ShaderLibrary::getInstance();
-	sl.loadFromFile("line", "resources/shaders/line.vs.glsl", "resources/shaders/line.fs.glsl");
-	mLineShader = sl.get("line");
+	mLineShader = ShaderLibrary::getInstance().get("line");
 
 	GLCheck( unsigned uniformBlockIndex = glGetUniformBlockIndex(mLineShader->getID(), "SharedData") );
 	GLCheck( glUniformBlockBinding(mLineShader->getID(), uniformBlockIndex, 0) );
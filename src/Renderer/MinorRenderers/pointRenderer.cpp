@@ -8,9 +8,7 @@ namespace ph {
 
 void PointRenderer::init()
 {
-	auto& sl = ShaderLibrary::getInstance();
-	sl.loadFromFile("points", "resources/shaders/points.vs.glsl", "resources/shaders/points.fs.glsl");
-	mPointsShader = sl.get("points");
+	mPointsShader = ShaderLibrary::getInstance().get("points");
 
 	glEnable(GL_PROGRAM_POINT_SIZE);
 
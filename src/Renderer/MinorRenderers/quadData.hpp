@@ -19,6 +19,7 @@ struct QuadData
 	sf::Vector2f rotationOrigin;
 	float rotation;
 	float textureSlotRef;
+	float z; // NOTE: It's set by QuadRenderer from z of render group
 };
 
 struct RenderGroupKey
@@ -33,4 +34,21 @@ struct QuadRenderGroup
 	std::vector<const Texture*> textures;
 };
 
+struct GuiQuadData
+{
+	Vector4f color;
+	FloatRect textureRect; // NOTE: In pixels, it's normalized in shader because glyph atlas can grow
+	sf::Vector2f position;
+	sf::Vector2f size;
+	float textureSlotRef;
+};
+
+// NOTE: Glyph quad of laid out text, its position is relative to text origin
+struct GuiGlyph
+{
+	sf::Vector2f position;
+	sf::Vector2f size;
+	FloatRect textureRect;
+};
+
 }
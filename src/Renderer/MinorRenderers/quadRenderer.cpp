@@ -10,6 +10,10 @@
 
 namespace ph {
 
+namespace {
+	constexpr unsigned maxTexturesPerBatch = 32;
+}
+
 // TODO_ren: Use custom allocators in RenderGroupsHashMap
 
 RenderGroupsHashMap::RenderGroupsHashMap()
@@ -70,9 +74,7 @@ bool operator==(const RenderGroupKey& lhs, const RenderGroupKey& rhs)
 
 void QuadRenderer::init()
 {
-	auto& sl = ShaderLibrary::getInstance();
-	sl.loadFromFile("instancedSprite", "resources/shaders/instancedSprite.vs.glsl", "resources/shaders/instancedSprite.fs.glsl");
-	mDefaultInstanedSpriteShader = sl.get("instancedSprite");
+	mDefaultInstanedSpriteShader = ShaderLibrary::getInstance().get("instancedSprite");
 
 	GLCheck( unsigned uniformBlockIndex = glGetUniformBlockIndex(mDefaultInstanedSpriteShader->getID(), "SharedData") );
 	GLCheck( glUniformBlockBinding(mDefaultInstanedSpriteShader->getID(), uniformBlockIndex, 0) );
@@ -96,14 +98,21 @@ void QuadRenderer::init()
 	GLCheck( glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(QuadData), (void*) offsetof(QuadData, rotationOrigin)) );
 	GLCheck( glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(QuadData), (void*) offsetof(QuadData, rotation)) );
 	GLCheck( glVertexAttribPointer(6, 1, GL_FLOAT, GL_FALSE, sizeof(QuadData), (void*) offsetof(QuadData, textureSlotRef)) );
+	GLCheck( glVertexAttribPointer(7, 1, GL_FLOAT, GL_FALSE, sizeof(QuadData), (void*) offsetof(QuadData, z)) );
 
-	for(int i = 0; i < 7; ++i) {
+	for(int i = 0; i < 8; ++i) {
 		GLCheck( glEnableVertexAttribArray(i) );
 	}
-	for(int i = 0; i < 7; ++i) {
+	for(int i = 0; i < 8; ++i) {
 		GLCheck( glVertexAttribDivisor(i, 1) );
 	}
 
+	// NOTE: Without base instance every draw call needs its own upload of instances, so GL 3.3 contexts draw batches one by one
+	mIsMultiDrawIndirectSupported = GLEW_VERSION_4_3 || (GLEW_ARB_multi_draw_indirect && GLEW_ARB_base_instance);
+	if(mIsMultiDrawIndirectSupported) {
+		GLCheck( glGenBuffers(1, &mIndirectBuffer) );
+	}
+
 	mWhiteTexture = new Texture;
 	unsigned whiteData = 0xffffffff;
 	mWhiteTexture->setData(&whiteData, sizeof(unsigned), sf::Vector2i(1, 1));
@@ -114,6 +123,9 @@ void QuadRenderer::shutDown()
 	delete mWhiteTexture;
 	mQuadIBO.remove();
 	GLCheck( glDeleteBuffers(1, &mQuadsDataVBO) );
+	if(mIsMultiDrawIndirectSupported) {
+		GLCheck( glDeleteBuffers(1, &mIndirectBuffer) );
+	}
 	GLCheck( glDeleteVertexArrays(1, &mVAO) );
 }
 
@@ -220,74 +232,145 @@ void QuadRenderer::flush()
 	PH_PROFILE_FUNCTION();
 	mNumberOfRenderGroups = mRenderGroupsHashMap.size();
 
-	mCurrentlyBoundQuadShader = nullptr;
-
 	for(auto& [key, rg] : mRenderGroupsHashMap.getUnderlyingVector())
 	{
 		// update debug info
 		mNumberOfDrawnSprites += rg.quadsData.size();
 		mNumberOfDrawnTextures += rg.textures.size();
 
-		// set up shader
-		if(key.shader != mCurrentlyBoundQuadShader) 
-		{
-			key.shader->bind();
-			mCurrentlyBoundQuadShader = key.shader;
+		addRenderGroupToBatches(key, rg);
+		rg.quadsData.clear();
+		rg.textures.clear();
+	}
 
-			int textures[32];
-			for(int i = 0; i < 32; ++i)
-				textures[i] = i;
-			key.shader->setUniformIntArray("textures", 32, textures);
-		}
-		key.shader->setUniformFloat("z", key.z);
+	mCurrentlyBoundQuadShader = nullptr;
+	if(mIsMultiDrawIndirectSupported)
+		drawBatchesIndirect();
+	else
+		drawBatches();
+
+	mInstances.clear();
+	mCommands.clear();
+	mBatches.clear();
+	mBatchesTextures.clear();
+}
 
-		// sort quads by texture slot ref
+void QuadRenderer::addRenderGroupToBatches(const RenderGroupKey& key, QuadRenderGroup& rg)
+{
+	// NOTE: Sorting by texture makes group which doesn't fit in texture slots split into as few batches as possible
+	if(rg.textures.size() > maxTexturesPerBatch)
 		std::sort(rg.quadsData.begin(), rg.quadsData.end(), [](const QuadData& a, const QuadData& b) {
 			return a.textureSlotRef < b.textureSlotRef;
 		});
 
-		// draw render group
-		for(size_t i = 0; i < rg.quadsData.size(); ++i)
-		{
-			if(i == rg.quadsData.size() - 1)
-			{
-				bindTexturesForNextDrawCall(rg.textures);
-				drawCall(i + 1, rg.quadsData);
-				break;
-			}
-			else if(rg.quadsData[i + 1].textureSlotRef == 32)
-			{
-				bindTexturesForNextDrawCall(rg.textures);
-				drawCall(i + 1, rg.quadsData);
-
-				rg.quadsData.erase(rg.quadsData.begin(), rg.quadsData.begin() + i);
-				
-				for(QuadData& quadData : rg.quadsData)
-					quadData.textureSlotRef -= 32;
-			
-				rg.textures.erase(
-					rg.textures.begin(),
-					rg.textures.size() > 32 ? rg.textures.begin() + 32 : rg.textures.end()
-				);
-
-				i = 0;
+	if(mBatches.empty() || mBatches.back().shader != key.shader)
+		startBatch(key.shader);
+
+	mGroupToBatchTextureSlots.assign(rg.textures.size(), -1);
+	bool hasCommand = false;
+	for(const QuadData& quad : rg.quadsData)
+	{
+		const auto groupTextureSlot = static_cast<std::size_t>(quad.textureSlotRef);
+		int& batchTextureSlot = mGroupToBatchTextureSlots[groupTextureSlot];
+		if(batchTextureSlot == -1) {
+			batchTextureSlot = getBatchTextureSlot(rg.textures[groupTextureSlot]);
+			if(batchTextureSlot == -1) {
+				startBatch(key.shader);
+				std::fill(mGroupToBatchTextureSlots.begin(), mGroupToBatchTextureSlots.end(), -1);
+				batchTextureSlot = getBatchTextureSlot(rg.textures[groupTextureSlot]);
+				hasCommand = false;
 			}
 		}
-		rg.quadsData.clear();
-		rg.textures.clear();
+
+		if(!hasCommand) {
+			mCommands.emplace_back(DrawElementsIndirectCommand{6, 0, 0, 0, static_cast<unsigned>(mInstances.size())});
+			++mBatches.back().nrOfCommands;
+			hasCommand = true;
+		}
+
+		QuadData& instance = mInstances.emplace_back(quad);
+		instance.textureSlotRef = static_cast<float>(batchTextureSlot);
+		instance.z = key.z;
+		++mCommands.back().instanceCount;
+		++mBatches.back().nrOfInstances;
 	}
 }
 
-void QuadRenderer::bindTexturesForNextDrawCall(std::vector<const Texture*>& textures)
+void QuadRenderer::startBatch(const Shader* shader)
 {
-	for(size_t i = 0; i < (textures.size() > 32 ? 32 : textures.size()); ++i)
-		textures[i]->bind(i);
+	mBatches.emplace_back(QuadsBatch{
+		shader,
+		static_cast<unsigned>(mBatchesTextures.size()), 0,
+		static_cast<unsigned>(mInstances.size()), 0,
+		static_cast<unsigned>(mCommands.size()), 0
+	});
+}
+
+auto QuadRenderer::getBatchTextureSlot(const Texture* texture) -> int
+{
+	// NOTE: Render groups often share textures (e.g. tileset), so they are bound only once per batch
+	QuadsBatch& batch = mBatches.back();
+	const auto batchTextures = mBatchesTextures.begin() + batch.firstTexture;
+	const auto found = std::find(batchTextures, mBatchesTextures.end(), texture);
+	if(found != mBatchesTextures.end())
+		return static_cast<int>(found - batchTextures);
+
+	if(batch.nrOfTextures == maxTexturesPerBatch)
+		return -1;
+	mBatchesTextures.emplace_back(texture);
+	return static_cast<int>(batch.nrOfTextures++);
+}
+
+void QuadRenderer::drawBatchesIndirect()
+{
+	if(mInstances.empty())
+		return;
+
+	GLCheck( glBindVertexArray(mVAO) );
+	GLCheck( glBindBuffer(GL_ARRAY_BUFFER, mQuadsDataVBO) );
+	GLCheck( glBufferData(GL_ARRAY_BUFFER, mInstances.size() * sizeof(QuadData), mInstances.data(), GL_STREAM_DRAW) );
+	GLCheck( glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mIndirectBuffer) );
+	GLCheck( glBufferData(GL_DRAW_INDIRECT_BUFFER, mCommands.size() * sizeof(DrawElementsIndirectCommand), mCommands.data(), GL_STREAM_DRAW) );
+
+	for(const QuadsBatch& batch : mBatches)
+	{
+		if(batch.nrOfInstances == 0)
+			continue;
+		bindBatch(batch);
+		const auto* firstCommand = reinterpret_cast<const void*>(batch.firstCommand * sizeof(DrawElementsIndirectCommand));
+		GLCheck( glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, firstCommand, batch.nrOfCommands, 0) );
+		++mNumberOfDrawCalls;
+	}
+
+	GLCheck( glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0) );
+}
+
+void QuadRenderer::drawBatches()
+{
+	for(const QuadsBatch& batch : mBatches)
+	{
+		if(batch.nrOfInstances == 0)
+			continue;
+		bindBatch(batch);
+		drawCall(batch.nrOfInstances, mInstances.data() + batch.firstInstance);
+	}
+}
+
+void QuadRenderer::bindBatch(const QuadsBatch& batch)
+{
+	if(batch.shader != mCurrentlyBoundQuadShader) {
+		batch.shader->bind();
+		mCurrentlyBoundQuadShader = batch.shader;
+	}
+
+	for(unsigned i = 0; i < batch.nrOfTextures; ++i)
+		mBatchesTextures[batch.firstTexture + i]->bind(i);
 }
 
-void QuadRenderer::drawCall(unsigned nrOfInstances, std::vector<QuadData>& quadsData)
+void QuadRenderer::drawCall(unsigned nrOfInstances, const QuadData* instances)
 {
 	GLCheck( glBindBuffer(GL_ARRAY_BUFFER, mQuadsDataVBO) );
-	GLCheck( glBufferData(GL_ARRAY_BUFFER, nrOfInstances * sizeof(QuadData), quadsData.data(), GL_STATIC_DRAW) );
+	GLCheck( glBufferData(GL_ARRAY_BUFFER, nrOfInstances * sizeof(QuadData), instances, GL_STATIC_DRAW) );
 
 	GLCheck( glBindVertexArray(mVAO) );
 	GLCheck( glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0, nrOfInstances) );
@@ -16,6 +16,28 @@ namespace ph {
 class Shader;
 class Texture;
 
+// NOTE: Layout is defined by OpenGL for glMultiDrawElementsIndirect
+struct DrawElementsIndirectCommand
+{
+	unsigned count;
+	unsigned instanceCount;
+	unsigned firstIndex;
+	int baseVertex;
+	unsigned baseInstance;
+};
+
+// NOTE: Consecutive render groups which use the same shader and together fit in 32 texture slots
+struct QuadsBatch
+{
+	const Shader* shader;
+	unsigned firstTexture;
+	unsigned nrOfTextures;
+	unsigned firstInstance;
+	unsigned nrOfInstances;
+	unsigned firstCommand;
+	unsigned nrOfCommands;
+};
+
 bool operator == (const RenderGroupKey& lhs, const RenderGroupKey& rhs);
 
 class RenderGroupsHashMap
@@ -60,18 +82,30 @@ private:
 	bool isInsideScreen(sf::Vector2f position, sf::Vector2f size, float rotation);
 	auto getTextureSlotToWhichThisTextureIsBound(const Texture* texture, const QuadRenderGroup&) -> std::optional<float>;
 	auto getNormalizedTextureRect(const IntRect* pixelTextureRect, sf::Vector2i textureSize) -> FloatRect;
-	void bindTexturesForNextDrawCall(std::vector<const Texture*>& textures);
-	void drawCall(unsigned nrOfInstances, std::vector<QuadData>& quadsData);
+	void addRenderGroupToBatches(const RenderGroupKey&, QuadRenderGroup&);
+	void startBatch(const Shader*);
+	auto getBatchTextureSlot(const Texture*) -> int;
+	void drawBatchesIndirect();
+	void drawBatches();
+	void bindBatch(const QuadsBatch&);
+	void drawCall(unsigned nrOfInstances, const QuadData* instances);
 
 private:
 	RenderGroupsHashMap mRenderGroupsHashMap;
+	std::vector<QuadData> mInstances;
+	std::vector<DrawElementsIndirectCommand> mCommands;
+	std::vector<QuadsBatch> mBatches;
+	std::vector<const Texture*> mBatchesTextures;
+	std::vector<int> mGroupToBatchTextureSlots;
 	const FloatRect* mScreenBounds;
 	const Shader* mCurrentlyBoundQuadShader;
 	Shader* mDefaultInstanedSpriteShader;
 	Texture* mWhiteTexture;
 	IndexBuffer mQuadIBO;
 	unsigned mQuadsDataVBO;
+	unsigned mIndirectBuffer;
 	unsigned mVAO;
+	bool mIsMultiDrawIndirectSupported;
 	unsigned mNumberOfDrawCalls = 0;
 	unsigned mNumberOfDrawnSprites = 0;
 	unsigned mNumberOfDrawnTextures = 0;
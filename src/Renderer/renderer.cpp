@@ -3,6 +3,7 @@
 #include "MinorRenderers/quadRenderer.hpp"
 #include "MinorRenderers/lineRenderer.hpp"
 #include "MinorRenderers/SFMLrenderer.hpp"
+#include "MinorRenderers/guiRenderer.hpp"
 #include "MinorRenderers/pointRenderer.hpp"
 #include "MinorRenderers/lightRenderer.hpp"
 #include "API/shader.hpp"
@@ -38,6 +39,7 @@ namespace {
 	ph::PointRenderer pointRenderer;
 	ph::LineRenderer lineRenderer;
 	ph::SFMLRenderer sfmlRenderer;
+	ph::GuiRenderer guiRenderer;
 	ph::LightRenderer lightRenderer;
 }
 
@@ -53,11 +55,23 @@ void Renderer::init(unsigned screenWidth, unsigned screenHeight)
 	if(glewInit() != GLEW_OK)
 		PH_EXIT_GAME("GLEW wasn't initialized correctly!");
 
+	// start loading all built-in shaders, so driver can compile them in parallel
+	auto& sl = ShaderLibrary::getInstance();
+	sl.init();
+	sl.loadFromFile("instancedSprite", "resources/shaders/instancedSprite.vs.glsl", "resources/shaders/instancedSprite.fs.glsl");
+	sl.loadFromFile("line", "resources/shaders/line.vs.glsl", "resources/shaders/line.fs.glsl");
+	sl.loadFromFile("points", "resources/shaders/points.vs.glsl", "resources/shaders/points.fs.glsl");
+	sl.loadFromFile("light", "resources/shaders/light.vs.glsl", "resources/shaders/light.fs.glsl");
+	sl.loadFromFile("gui", "resources/shaders/gui.vs.glsl", "resources/shaders/gui.fs.glsl");
+	sl.loadFromFile("defaultFramebuffer", "resources/shaders/defaultFramebuffer.vs.glsl", "resources/shaders/defaultFramebuffer.fs.glsl");
+	sl.loadFromFile("gaussianBlurFramebuffer", "resources/shaders/defaultFramebuffer.vs.glsl", "resources/shaders/gaussianBlur.fs.glsl");
+
 	// initialize minor renderers
 	quadRenderer.init();
 	lineRenderer.init();
 	pointRenderer.init();
 	lightRenderer.init();
+	guiRenderer.init();
 	quadRenderer.setScreenBoundsPtr(&screenBounds);
 	pointRenderer.setScreenBoundsPtr(&screenBounds);
 	lineRenderer.setScreenBoundsPtr(&screenBounds);
@@ -74,10 +88,10 @@ void Renderer::init(unsigned screenWidth, unsigned screenHeight)
 	glBindBufferRange(GL_UNIFORM_BUFFER, 0, sharedDataUBO, 0, 16 * sizeof(float));
 
 	// set up framebuffer
-	auto& sl = ShaderLibrary::getInstance();
-	sl.loadFromFile("defaultFramebuffer", "resources/shaders/defaultFramebuffer.vs.glsl", "resources/shaders/defaultFramebuffer.fs.glsl");
 	defaultFramebufferShader = sl.get("defaultFramebuffer");
-	sl.loadFromFile("gaussianBlurFramebuffer", "resources/shaders/defaultFramebuffer.vs.glsl", "resources/shaders/gaussianBlur.fs.glsl");
+	defaultFramebufferShader->bind();
+	defaultFramebufferShader->setUniformInt("gameObjectsTexture", 0);
+	defaultFramebufferShader->setUniformInt("lightingTexture", 1);
 	gaussianBlurFramebufferShader = sl.get("gaussianBlurFramebuffer");
 
 	float framebufferQuad[] = {
@@ -115,6 +129,7 @@ void Renderer::shutDown()
 	quadRenderer.shutDown();
 	lineRenderer.shutDown();
 	lightRenderer.shutDown();
+	guiRenderer.shutDown();
 	framebufferVertexArray.remove();
 	gameObjectsFramebuffer.remove();
 	lightingFramebuffer.remove();
@@ -169,16 +184,17 @@ void Renderer::endScene(sf::RenderWindow& window, DebugCounter& debugCounter)
 	GLCheck( glBindFramebuffer(GL_FRAMEBUFFER, 0) );
 	GLCheck( glClear(GL_COLOR_BUFFER_BIT) );
 	defaultFramebufferShader->bind();
-	defaultFramebufferShader->setUniformInt("gameObjectsTexture", 0);
 	gameObjectsFramebuffer.bindTextureColorBuffer(0);
-	defaultFramebufferShader->setUniformInt("lightingTexture", 1);
 	lightingGaussianBlurFramebuffer.bindTextureColorBuffer(1);
 	GLCheck( glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0) );
 
+	// render gui on top of the scene
+	guiRenderer.flush();
+
 	// pass debug data to debug counter
 	debugCounter.setAllDrawCallsPerFrame(
 		sfmlRenderer.getNumberOfSubmitedObjects() + quadRenderer.getNumberOfDrawCalls() +
-		lineRenderer.getNumberOfDrawCalls() + pointRenderer.getNrOfDrawCalls()
+		lineRenderer.getNumberOfDrawCalls() + pointRenderer.getNrOfDrawCalls() + guiRenderer.getNumberOfDrawCalls()
 	);
 	debugCounter.setNumberOfInstancedDrawCalls(quadRenderer.getNumberOfDrawCalls());
 	debugCounter.setNumberOfRenderGroups(quadRenderer.getNumberOfRenderGroups());
@@ -189,11 +205,14 @@ void Renderer::endScene(sf::RenderWindow& window, DebugCounter& debugCounter)
 	debugCounter.setNumberOfDrawnLines(lineRenderer.getNumberOfDrawnLines());
 	debugCounter.setNumberOfPointDrawCalls(pointRenderer.getNrOfDrawCalls());
 	debugCounter.setNumberOfDrawnPoints(pointRenderer.getNrOfDrawnPoints());
+	debugCounter.setNumberOfGuiDrawCalls(guiRenderer.getNumberOfDrawCalls());
+	debugCounter.setNumberOfDrawnGuiQuads(guiRenderer.getNumberOfDrawnQuads());
 	quadRenderer.setDebugNumbersToZero();
 	lineRenderer.setDebugNumbersToZero();
 	pointRenderer.setDebugNumbersToZero();
+	guiRenderer.setDebugNumbersToZero();
 
-	// draw gui using sfml
+	// draw terminal and debug counter using sfml
 	sfmlRenderer.flush(window);
 }
 
@@ -235,6 +254,18 @@ void Renderer::submitLightBlockingQuad(sf::Vector2f position, sf::Vector2f size)
 	lightRenderer.submitLightBlockingQuad(position, size);
 }
 
+void Renderer::submitGuiQuad(const sf::Texture* texture, const FloatRect& textureRect, sf::Color color,
+                             sf::Vector2f position, sf::Vector2f size)
+{
+	guiRenderer.submitQuad(texture, textureRect, color, position, size);
+}
+
+void Renderer::submitGuiGlyphs(const std::vector<GuiGlyph>& glyphs, const sf::Texture& glyphAtlas, sf::Color color,
+                               sf::Vector2f position, sf::Vector2f scale)
+{
+	guiRenderer.submitGlyphs(glyphs, glyphAtlas, color, position, scale);
+}
+
 void Renderer::submitSFMLObject(const sf::Drawable& object)
 {
 	sfmlRenderer.submit(&object);
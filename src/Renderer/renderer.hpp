@@ -9,6 +9,7 @@
 namespace sf {
 	class Drawable;
 	class RenderWindow;
+	class Texture;
 }
 
 namespace ph {
@@ -44,6 +45,10 @@ namespace Renderer
 
 	void submitLightBlockingQuad(sf::Vector2f position, sf::Vector2f size);
 
+	void submitGuiQuad(const sf::Texture*, const FloatRect& textureRect, sf::Color, sf::Vector2f position, sf::Vector2f size);
+
+	void submitGuiGlyphs(const std::vector<GuiGlyph>&, const sf::Texture& glyphAtlas, sf::Color, sf::Vector2f position, sf::Vector2f scale);
+
 	void submitSFMLObject(const sf::Drawable&);
 
 	void setAmbientLightColor(sf::Color);
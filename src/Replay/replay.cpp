@@ -0,0 +1,226 @@
+#include "replay.hpp"
+#include "Logs/logs.hpp"
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace ph {
+
+namespace {
+
+constexpr char replayMagic[4] = {'P', 'H', 'R', 'P'};
+constexpr std::uint16_t replayVersion = 1;
+
+// NOTE: Pressed actions and simulation step are written only when they changed since the previous step
+enum StepFlags : std::uint8_t
+{
+	PressedActionsChanged = 1 << 0,
+	SimulationStepChanged = 1 << 1
+};
+
+template<typename T>
+void write(std::ofstream& file, T value)
+{
+	static_assert(std::is_trivially_copyable_v<T>);
+	file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool read(std::ifstream& file, T& value)
+{
+	static_assert(std::is_trivially_copyable_v<T>);
+	return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+}
+
+std::optional<ReplaySettings> parseReplaySettings(int argc, char** argv)
+{
+	if(argc < 2)
+		return std::nullopt;
+
+	ReplaySettings settings;
+	if(std::strcmp(argv[1], "--record") == 0)
+		settings.mode = ReplaySettings::Record;
+	else if(std::strcmp(argv[1], "--replay") == 0)
+		settings.mode = ReplaySettings::Play;
+	else
+		return std::nullopt;
+
+	if(argc < 3)
+		PH_EXIT_GAME(std::string(argv[1]) + " needs a replay file, for example: " + argv[1] + " fight.phr");
+	settings.filePath = argv[2];
+
+	for(int i = 3; i < argc; ++i)
+	{
+		if(settings.mode == ReplaySettings::Play && std::strcmp(argv[i], "--headless") == 0)
+			settings.isHeadless = true;
+		else if(settings.mode == ReplaySettings::Play && std::strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+			settings.resultsPath = argv[++i];
+		else
+			PH_EXIT_GAME(std::string("Unknown replay option: ") + argv[i]);
+	}
+	return settings;
+}
+
+ReplayRecorder::ReplayRecorder(const std::string& filePath)
+	:mFilePath(filePath)
+	,mLastPressedActions(0)
+	,mLastSimulationStep(0.f)
+{
+}
+
+void ReplayRecorder::start(const ReplayHeader& header)
+{
+	mFile.close();
+	mFile.open(mFilePath, std::ios::binary | std::ios::trunc);
+	if(!mFile.is_open()) {
+		PH_LOG_ERROR("Replay file " + mFilePath + " couldn't be opened for recording");
+		return;
+	}
+
+	mFile.write(replayMagic, sizeof(replayMagic));
+	write(mFile, replayVersion);
+	write(mFile, static_cast<std::uint32_t>(header.seed));
+	write(mFile, header.simulationStep);
+	write(mFile, static_cast<std::uint8_t>(header.hasPlayer));
+	write(mFile, static_cast<std::int32_t>(header.playerStatus.healthPoints));
+	write(mFile, static_cast<std::int32_t>(header.playerStatus.numOfPistolBullets));
+	write(mFile, static_cast<std::int32_t>(header.playerStatus.numOfShotgunBullets));
+	write(mFile, header.playerPosition.x);
+	write(mFile, header.playerPosition.y);
+	write(mFile, static_cast<std::uint16_t>(header.scenePath.size()));
+	mFile.write(header.scenePath.data(), header.scenePath.size());
+
+	mFrame.actionEvents.clear();
+	mFrame.steps.clear();
+	mLastPressedActions = 0;
+	mLastSimulationStep = header.simulationStep;
+
+	PH_LOG_INFO("Recording replay of " + header.scenePath + " to " + mFilePath);
+}
+
+void ReplayRecorder::recordActionEvent(const ActionEvent& event)
+{
+	if(mFile.is_open())
+		mFrame.actionEvents.emplace_back(event);
+}
+
+void ReplayRecorder::recordStep(ActionMask pressedActions, float simulationStep)
+{
+	if(mFile.is_open())
+		mFrame.steps.push_back({pressedActions, simulationStep});
+}
+
+void ReplayRecorder::endFrame()
+{
+	// NOTE: Events of frames without simulation steps are handled before steps of the next frame anyway
+	if(!mFile.is_open() || mFrame.steps.empty())
+		return;
+
+	PH_ASSERT_UNEXPECTED_SITUATION(mFrame.steps.size() <= UINT8_MAX, "Too many simulation steps in one frame!");
+	PH_ASSERT_UNEXPECTED_SITUATION(mFrame.actionEvents.size() <= UINT16_MAX, "Too many action events in one frame!");
+
+	write(mFile, static_cast<std::uint8_t>(mFrame.steps.size()));
+	write(mFile, static_cast<std::uint16_t>(mFrame.actionEvents.size()));
+	for(const auto& event : mFrame.actionEvents)
+		write(mFile, static_cast<std::uint8_t>(event.mAction << 1 | event.mType));
+
+	for(const auto& step : mFrame.steps)
+	{
+		std::uint8_t flags = 0;
+		if(step.pressedActions != mLastPressedActions)
+			flags |= PressedActionsChanged;
+		if(step.simulationStep != mLastSimulationStep)
+			flags |= SimulationStepChanged;
+
+		write(mFile, flags);
+		if(flags & PressedActionsChanged)
+			write(mFile, step.pressedActions);
+		if(flags & SimulationStepChanged)
+			write(mFile, step.simulationStep);
+
+		mLastPressedActions = step.pressedActions;
+		mLastSimulationStep = step.simulationStep;
+	}
+
+	mFrame.actionEvents.clear();
+	mFrame.steps.clear();
+}
+
+bool ReplayPlayer::open(const std::string& filePath)
+{
+	mFile.open(filePath, std::ios::binary);
+	if(!mFile.is_open()) {
+		PH_LOG_ERROR("Replay file " + filePath + " couldn't be opened");
+		return false;
+	}
+
+	char magic[sizeof(replayMagic)];
+	std::uint16_t version;
+	mFile.read(magic, sizeof(magic));
+	if(!mFile || std::memcmp(magic, replayMagic, sizeof(magic)) != 0 || !read(mFile, version) || version != replayVersion) {
+		PH_LOG_ERROR(filePath + " isn't a replay file of this version of the game");
+		return false;
+	}
+
+	std::uint32_t seed;
+	std::uint8_t hasPlayer;
+	std::int32_t healthPoints, numOfPistolBullets, numOfShotgunBullets;
+	std::uint16_t scenePathSize;
+	read(mFile, seed);
+	read(mFile, mHeader.simulationStep);
+	read(mFile, hasPlayer);
+	read(mFile, healthPoints);
+	read(mFile, numOfPistolBullets);
+	read(mFile, numOfShotgunBullets);
+	read(mFile, mHeader.playerPosition.x);
+	read(mFile, mHeader.playerPosition.y);
+	read(mFile, scenePathSize);
+	mHeader.scenePath.resize(scenePathSize);
+	mFile.read(mHeader.scenePath.data(), scenePathSize);
+	if(!mFile) {
+		PH_LOG_ERROR("Header of replay file " + filePath + " is incomplete");
+		return false;
+	}
+
+	mHeader.seed = seed;
+	mHeader.hasPlayer = hasPlayer != 0;
+	mHeader.playerStatus = PlayerStatus{healthPoints, numOfPistolBullets, numOfShotgunBullets};
+	mLastPressedActions = 0;
+	mLastSimulationStep = mHeader.simulationStep;
+	return true;
+}
+
+bool ReplayPlayer::readFrame(ReplayFrame& frame)
+{
+	std::uint8_t stepsCount;
+	std::uint16_t eventsCount;
+	if(!read(mFile, stepsCount) || !read(mFile, eventsCount))
+		return false;
+
+	frame.actionEvents.clear();
+	for(std::uint16_t i = 0; i < eventsCount; ++i)
+	{
+		std::uint8_t event;
+		read(mFile, event);
+		frame.actionEvents.emplace_back(static_cast<ActionID>(event >> 1), static_cast<ActionEvent::Type>(event & 1));
+	}
+
+	frame.steps.clear();
+	for(std::uint8_t i = 0; i < stepsCount; ++i)
+	{
+		std::uint8_t flags;
+		read(mFile, flags);
+		if(flags & PressedActionsChanged)
+			read(mFile, mLastPressedActions);
+		if(flags & SimulationStepChanged)
+			read(mFile, mLastSimulationStep);
+		frame.steps.push_back({mLastPressedActions, mLastSimulationStep});
+	}
+
+	// NOTE: Frame cut off by closing the game in the middle of writing is dropped
+	return static_cast<bool>(mFile);
+}
+
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Events/actionEvent.hpp"
+#include "Scenes/playerStatus.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ph {
+
+/// Replay is a binary log of everything which drives simulation of one scene:
+/// scene file, seed of Random, player state at the start, action events and pressed actions of every simulation step.
+/// Recording restarts whenever new scene is loaded, so the log always holds the last played scene.
+/// Usage: PopHead --record <file>
+///        PopHead --replay <file> [--headless] [--output file.json]
+
+struct ReplaySettings
+{
+	enum Mode { Record, Play };
+
+	Mode mode;
+	std::string filePath;
+	std::string resultsPath = "replayResults.json";
+	bool isHeadless = false;
+};
+
+std::optional<ReplaySettings> parseReplaySettings(int argc, char** argv);
+
+struct ReplayHeader
+{
+	std::string scenePath;
+	PlayerStatus playerStatus;
+	sf::Vector2f playerPosition;
+	unsigned seed = 0;
+	float simulationStep = 1.f / 60.f;
+	bool hasPlayer = false;
+};
+
+struct ReplayStep
+{
+	ActionMask pressedActions;
+	float simulationStep;
+};
+
+// NOTE: Frame holds action events which were handled before its simulation steps
+struct ReplayFrame
+{
+	std::vector<ActionEvent> actionEvents;
+	std::vector<ReplayStep> steps;
+};
+
+class ReplayRecorder
+{
+public:
+	explicit ReplayRecorder(const std::string& filePath);
+
+	void start(const ReplayHeader&);
+
+	void recordActionEvent(const ActionEvent&);
+	void recordStep(ActionMask pressedActions, float simulationStep);
+	void endFrame();
+
+private:
+	ReplayFrame mFrame;
+	std::ofstream mFile;
+	std::string mFilePath;
+	ActionMask mLastPressedActions;
+	float mLastSimulationStep;
+};
+
+class ReplayPlayer
+{
+public:
+	bool open(const std::string& filePath);
+	const ReplayHeader& getHeader() const { return mHeader; }
+
+	// NOTE: Returns false when there are no more frames
+	bool readFrame(ReplayFrame&);
+
+private:
+	ReplayHeader mHeader;
+	std::ifstream mFile;
+	ActionMask mLastPressedActions;
+	float mLastSimulationStep;
+};
+
+}
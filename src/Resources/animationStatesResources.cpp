@@ -1,12 +1,26 @@
 #include "animationStatesResources.hpp"
 #include "Utilities/xml.hpp"
 #include "Logs/logs.hpp"
-#include <algorithm>
+#include <map>
+#include <unordered_map>
 
 namespace ph {
 
 static std::map<std::string, AnimationStatesData> allAnimationsStateData;
 
+AnimationStateId getAnimationStateId(const std::string& stateName)
+{
+	// NOTE: Function local, because systems resolve their state ids in static initializers
+	static std::unordered_map<std::string, AnimationStateId> stateIds;
+
+	auto found = stateIds.find(stateName);
+	if(found != stateIds.end())
+		return found->second;
+	const auto id = static_cast<AnimationStateId>(stateIds.size());
+	stateIds.emplace(stateName, id);
+	return id;
+}
+
 void loadAnimationStatesFromFile(const std::string& filepath)
 {
 	if(allAnimationsStateData.find(filepath) != allAnimationsStateData.end())
@@ -19,22 +33,30 @@ void loadAnimationStatesFromFile(const std::string& filepath)
 	const auto statesData = animationStatesFile.getChildren("state");
 	for(const auto& data : statesData)
 	{
-		StateData state;
-		state.startFrame = IntRect(
+		const IntRect startFrame(
 			data.getAttribute("startFrameX").toUnsigned(),
 			data.getAttribute("startFrameY").toUnsigned(),
 			data.getAttribute("startFrameWidth").toUnsigned(),
 			data.getAttribute("startFrameHeight").toUnsigned()
 		);
+
+		StateData state;
+		state.firstFrame = static_cast<std::uint32_t>(animation.frames.size());
 		state.frameCount = data.getAttribute("frameCount").toUnsigned();
-		const std::string stateName = data.getAttribute("name").toString();
-		animation[stateName] = state;
+		PH_ASSERT_CRITICAL(state.frameCount > 0, "Animation state in \"" + filepath + "\" has no frames!");
+		for(std::uint32_t i = 0; i < state.frameCount; ++i)
+			animation.frames.emplace_back(startFrame.left + startFrame.width * i, startFrame.top, startFrame.width, startFrame.height);
+
+		const AnimationStateId id = getAnimationStateId(data.getAttribute("name").toString());
+		if(id >= animation.states.size())
+			animation.states.resize(id + 1);
+		animation.states[id] = state;
 	}
 	 
-	allAnimationsStateData[filepath] = animation;
+	allAnimationsStateData[filepath] = std::move(animation);
 }
 
-AnimationStatesData* getAnimationStates(const std::string& filepath)
+const AnimationStatesData* getAnimationStates(const std::string& filepath)
 {
 	auto found = allAnimationsStateData.find(filepath);
 	PH_ASSERT_CRITICAL(found != allAnimationsStateData.end(), "Animation states data \"" + filepath + "\" not found!");
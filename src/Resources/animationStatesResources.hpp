@@ -1,22 +1,33 @@
 #pragma once
 
 #include "Utilities/rect.hpp"
+#include <cstdint>
 #include <string>
 #include <vector>
-#include <map>
-#include <utility>
 
 namespace ph {
 
+// NOTE: State names are shared by all animation sets, so the same name has the same id in every set
+using AnimationStateId = std::uint16_t;
+
 struct StateData
 {
-	IntRect startFrame;
-	unsigned frameCount;
+	std::uint32_t firstFrame = 0;
+	std::uint32_t frameCount = 0;
 };
 
-using AnimationStatesData = std::map<std::string, StateData>;
+struct AnimationStatesData
+{
+	bool hasState(AnimationStateId id) const { return id < states.size() && states[id].frameCount != 0; }
+	const StateData& getState(AnimationStateId id) const { return states[id]; }
+	const IntRect& getFrame(const StateData& state, std::size_t frameIndex) const { return frames[state.firstFrame + frameIndex]; }
+
+	std::vector<StateData> states; // indexed by AnimationStateId
+	std::vector<IntRect> frames;
+};
 
 void loadAnimationStatesFromFile(const std::string& filepath);
-AnimationStatesData* getAnimationStates(const std::string& filepath);
+const AnimationStatesData* getAnimationStates(const std::string& filepath);
+AnimationStateId getAnimationStateId(const std::string& stateName);
 
 }
@@ -0,0 +1,262 @@
+#include "resourceArchive.hpp"
+#include "Utilities/lz4.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifdef PH_WINDOWS
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // PH_WINDOWS
+
+namespace ph {
+
+static_assert(sizeof(ResourceArchiveHeader) == 16, "Archive header has to be 16 bytes so entries are aligned");
+static_assert(sizeof(ResourceArchiveEntry) == 32, "Archive entry has to be 32 bytes so entries are aligned");
+
+ResourceArchive::~ResourceArchive()
+{
+	close();
+}
+
+bool ResourceArchive::open(const std::string& archiveFilePath)
+{
+	close();
+	if(!mapFile(archiveFilePath))
+		return false;
+
+	if(mMappedSize < sizeof(ResourceArchiveHeader)) {
+		close();
+		return false;
+	}
+	const auto* header = reinterpret_cast<const ResourceArchiveHeader*>(mMappedData);
+	const std::size_t entriesEnd = sizeof(ResourceArchiveHeader) + std::size_t(header->numberOfEntries) * sizeof(ResourceArchiveEntry);
+	if(std::memcmp(header->magic, sMagic, sizeof(sMagic)) != 0 || header->version != sVersion ||
+	   entriesEnd > mMappedSize || header->pathsSize > mMappedSize - entriesEnd)
+	{
+		close();
+		return false;
+	}
+
+	mNumberOfEntries = header->numberOfEntries;
+	mEntries = reinterpret_cast<const ResourceArchiveEntry*>(mMappedData + sizeof(ResourceArchiveHeader));
+	mPaths = mMappedData + entriesEnd;
+
+	if(!validate()) {
+		close();
+		return false;
+	}
+	return true;
+}
+
+void ResourceArchive::close()
+{
+	unmapFile();
+	mEntries = nullptr;
+	mPaths = nullptr;
+	mNumberOfEntries = 0;
+}
+
+auto ResourceArchive::read(const std::string& filePath) const -> std::optional<ResourceData>
+{
+	const ResourceArchiveEntry* entry = findEntry(filePath);
+	if(!entry)
+		return std::nullopt;
+
+	const std::string_view storedBytes(mMappedData + entry->offset, static_cast<std::size_t>(entry->storedSize));
+	if(entry->storedSize == entry->size)
+		return ResourceData(storedBytes);
+
+	std::vector<char> bytes(static_cast<std::size_t>(entry->size));
+	if(!Lz4::decompress(storedBytes, bytes.data(), bytes.size()))
+		return std::nullopt;
+	return ResourceData(std::move(bytes));
+}
+
+bool ResourceArchive::has(const std::string& filePath) const
+{
+	return findEntry(filePath) != nullptr;
+}
+
+bool ResourceArchive::build(const std::string& archiveFilePath, std::vector<std::string> filePaths, bool compress)
+{
+	std::sort(filePaths.begin(), filePaths.end());
+	filePaths.erase(std::unique(filePaths.begin(), filePaths.end()), filePaths.end());
+
+	auto alignUp = [](std::size_t offset) {
+		return (offset + sDataAlignment - 1) / sDataAlignment * sDataAlignment;
+	};
+
+	std::vector<ResourceArchiveEntry> entries(filePaths.size());
+	std::vector<std::vector<char>> storedData(filePaths.size());
+	std::string paths;
+	LooseFilesSource looseFiles;
+
+	for(std::size_t i = 0; i < filePaths.size(); ++i)
+	{
+		auto file = looseFiles.read(filePaths[i]);
+		if(!file)
+			return false;
+
+		entries[i].pathOffset = static_cast<std::uint32_t>(paths.size());
+		entries[i].pathLength = static_cast<std::uint32_t>(filePaths[i].size());
+		paths += filePaths[i];
+
+		entries[i].size = file->size();
+		if(compress) {
+			// NOTE: Compression is kept only if it pays off, already compressed formats like png or ogg are stored
+			auto compressed = Lz4::compress(file->getBytes());
+			if(compressed.size() < file->size() - file->size() / 8)
+				storedData[i] = std::move(compressed);
+		}
+		if(storedData[i].empty())
+			storedData[i].assign(file->data(), file->data() + file->size());
+		entries[i].storedSize = storedData[i].size();
+	}
+
+	std::size_t offset = alignUp(sizeof(ResourceArchiveHeader) + entries.size() * sizeof(ResourceArchiveEntry) + paths.size());
+	for(auto& entry : entries) {
+		entry.offset = offset;
+		offset = alignUp(offset + static_cast<std::size_t>(entry.storedSize));
+	}
+
+	ResourceArchiveHeader header;
+	std::memcpy(header.magic, sMagic, sizeof(sMagic));
+	header.version = sVersion;
+	header.numberOfEntries = static_cast<std::uint32_t>(entries.size());
+	header.pathsSize = static_cast<std::uint32_t>(paths.size());
+
+	std::ofstream archive(archiveFilePath, std::ios::binary | std::ios::trunc);
+	if(!archive.is_open())
+		return false;
+
+	const char padding[sDataAlignment] = {};
+	auto writePadding = [&]() {
+		const std::size_t position = static_cast<std::size_t>(archive.tellp());
+		archive.write(padding, alignUp(position) - position);
+	};
+
+	archive.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	archive.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(ResourceArchiveEntry));
+	archive.write(paths.data(), paths.size());
+	writePadding();
+	for(const auto& data : storedData) {
+		archive.write(data.data(), data.size());
+		writePadding();
+	}
+	return archive.good();
+}
+
+bool ResourceArchive::validate() const
+{
+	const std::size_t pathsSize = reinterpret_cast<const ResourceArchiveHeader*>(mMappedData)->pathsSize;
+	for(std::size_t i = 0; i < mNumberOfEntries; ++i)
+	{
+		const ResourceArchiveEntry& entry = mEntries[i];
+		if(entry.pathOffset > pathsSize || entry.pathLength > pathsSize - entry.pathOffset)
+			return false;
+		if(entry.offset % sDataAlignment != 0 || entry.offset > mMappedSize || entry.storedSize > mMappedSize - entry.offset)
+			return false;
+		if(i > 0 && !(getEntryPath(mEntries[i - 1]) < getEntryPath(entry)))
+			return false;
+	}
+	return true;
+}
+
+auto ResourceArchive::findEntry(std::string_view filePath) const -> const ResourceArchiveEntry*
+{
+	const ResourceArchiveEntry* entriesEnd = mEntries + mNumberOfEntries;
+	const ResourceArchiveEntry* found = std::lower_bound(mEntries, entriesEnd, filePath,
+		[this](const ResourceArchiveEntry& entry, std::string_view path) {
+			return getEntryPath(entry) < path;
+		});
+	if(found == entriesEnd || getEntryPath(*found) != filePath)
+		return nullptr;
+	return found;
+}
+
+auto ResourceArchive::getEntryPath(const ResourceArchiveEntry& entry) const -> std::string_view
+{
+	return std::string_view(mPaths + entry.pathOffset, entry.pathLength);
+}
+
+#ifdef PH_WINDOWS
+
+bool ResourceArchive::mapFile(const std::string& archiveFilePath)
+{
+	HANDLE file = CreateFileA(archiveFilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if(file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER fileSize;
+	if(!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+		CloseHandle(file);
+		return false;
+	}
+
+	// NOTE: View keeps mapping alive, so handles can be closed right away
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if(!mapping)
+		return false;
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if(!view)
+		return false;
+
+	mMappedData = static_cast<const char*>(view);
+	mMappedSize = static_cast<std::size_t>(fileSize.QuadPart);
+	return true;
+}
+
+void ResourceArchive::unmapFile()
+{
+	if(mMappedData)
+		UnmapViewOfFile(mMappedData);
+	mMappedData = nullptr;
+	mMappedSize = 0;
+}
+
+#else
+
+bool ResourceArchive::mapFile(const std::string& archiveFilePath)
+{
+	const int file = ::open(archiveFilePath.c_str(), O_RDONLY);
+	if(file == -1)
+		return false;
+
+	struct stat fileStatus;
+	if(fstat(file, &fileStatus) == -1 || fileStatus.st_size == 0) {
+		::close(file);
+		return false;
+	}
+
+	// NOTE: Mapping stays valid after descriptor is closed
+	void* view = mmap(nullptr, static_cast<std::size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+	::close(file);
+	if(view == MAP_FAILED)
+		return false;
+
+	mMappedData = static_cast<const char*>(view);
+	mMappedSize = static_cast<std::size_t>(fileStatus.st_size);
+	return true;
+}
+
+void ResourceArchive::unmapFile()
+{
+	if(mMappedData)
+		munmap(const_cast<char*>(mMappedData), mMappedSize);
+	mMappedData = nullptr;
+	mMappedSize = 0;
+}
+
+#endif // PH_WINDOWS
+
+}
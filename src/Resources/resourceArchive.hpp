@@ -0,0 +1,67 @@
+#pragma once
+
+#include "resourceSource.hpp"
+#include <cstdint>
+
+namespace ph {
+
+// NOTE: Archive layout: header | entries sorted by path | paths | data of entries
+//       Data of every entry starts at 16 byte boundary. Entry is LZ4 compressed when its stored size differs from its size.
+
+struct ResourceArchiveHeader
+{
+	char magic[4];
+	std::uint32_t version;
+	std::uint32_t numberOfEntries;
+	std::uint32_t pathsSize;
+};
+
+struct ResourceArchiveEntry
+{
+	std::uint64_t offset;
+	std::uint64_t size;
+	std::uint64_t storedSize;
+	std::uint32_t pathOffset;
+	std::uint32_t pathLength;
+};
+
+class ResourceArchive : public ResourceSource
+{
+public:
+	ResourceArchive() = default;
+	ResourceArchive(const ResourceArchive&) = delete;
+	ResourceArchive& operator=(const ResourceArchive&) = delete;
+	~ResourceArchive();
+
+	bool open(const std::string& archiveFilePath);
+	void close();
+	bool isOpen() const { return mMappedData != nullptr; }
+
+	auto read(const std::string& filePath) const -> std::optional<ResourceData> override;
+	bool has(const std::string& filePath) const override;
+
+	std::size_t getNumberOfEntries() const { return mNumberOfEntries; }
+
+	// NOTE: File paths are stored in archive as they are given, so they should be relative to the game working directory
+	static bool build(const std::string& archiveFilePath, std::vector<std::string> filePaths, bool compress);
+
+private:
+	bool mapFile(const std::string& archiveFilePath);
+	void unmapFile();
+	bool validate() const;
+	auto findEntry(std::string_view filePath) const -> const ResourceArchiveEntry*;
+	auto getEntryPath(const ResourceArchiveEntry&) const -> std::string_view;
+
+private:
+	inline static constexpr char sMagic[4] = {'P', 'H', 'R', 'A'};
+	inline static constexpr std::uint32_t sVersion = 1;
+	inline static constexpr std::size_t sDataAlignment = 16;
+
+	const char* mMappedData = nullptr;
+	std::size_t mMappedSize = 0;
+	const ResourceArchiveEntry* mEntries = nullptr;
+	const char* mPaths = nullptr;
+	std::size_t mNumberOfEntries = 0;
+};
+
+}
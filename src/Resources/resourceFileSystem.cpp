@@ -0,0 +1,39 @@
+#include "resourceFileSystem.hpp"
+#include "Logs/logs.hpp"
+
+namespace ph {
+
+bool ResourceFileSystem::mountArchive(const std::string& archiveFilePath)
+{
+	if(!sArchive.open(archiveFilePath)) {
+		PH_LOG_WARNING("Resource archive \"" + archiveFilePath + "\" couldn't be mounted, loose files will be used.");
+		return false;
+	}
+	PH_LOG_INFO("Resource archive \"" + archiveFilePath + "\" was mounted with " + std::to_string(sArchive.getNumberOfEntries()) + " files.");
+	return true;
+}
+
+void ResourceFileSystem::unmountArchive()
+{
+	sArchive.close();
+}
+
+auto ResourceFileSystem::read(const std::string& filePath) -> std::optional<ResourceData>
+{
+#ifdef PH_DISTRIBUTION
+	if(auto data = sArchive.read(filePath))
+		return data;
+	return sLooseFiles.read(filePath);
+#else
+	if(auto data = sLooseFiles.read(filePath))
+		return data;
+	return sArchive.read(filePath);
+#endif // PH_DISTRIBUTION
+}
+
+bool ResourceFileSystem::has(const std::string& filePath)
+{
+	return sArchive.has(filePath) || sLooseFiles.has(filePath);
+}
+
+}
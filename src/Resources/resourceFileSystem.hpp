@@ -0,0 +1,26 @@
+#pragma once
+
+#include "resourceArchive.hpp"
+
+namespace ph {
+
+// NOTE: Every resource file should be read through this class.
+//       Distribution build reads mounted archive first and falls back to loose files,
+//       other builds read loose files first, so resources can be edited without rebuilding archive.
+//       Archive has to be mounted before any other thread starts reading.
+class ResourceFileSystem
+{
+public:
+	static bool mountArchive(const std::string& archiveFilePath);
+	static void unmountArchive();
+	static bool isArchiveMounted() { return sArchive.isOpen(); }
+
+	static auto read(const std::string& filePath) -> std::optional<ResourceData>;
+	static bool has(const std::string& filePath);
+
+private:
+	inline static ResourceArchive sArchive;
+	inline static LooseFilesSource sLooseFiles;
+};
+
+}
@@ -1,29 +1,131 @@
 #pragma once
 
 #include "Renderer/API/texture.hpp"
+#include "Resources/resourceFileSystem.hpp"
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace ph {
 
+template< typename ResourceType >
+class ResourceHolder;
+
+template< typename ResourceType >
+struct ResourceHandle
+{
+	std::uint32_t index = 0;
+	std::uint32_t generation = 0;
+
+	bool isValid() const { return generation != 0; }
+	bool operator==(const ResourceHandle& rhs) const { return index == rhs.index && generation == rhs.generation; }
+	bool operator!=(const ResourceHandle& rhs) const { return !(*this == rhs); }
+};
+
+// NOTE: Keeps resource from being evicted as long as it exists.
+//       Destroyed ref releases its reference in the holder, so holder has to outlive every ref acquired from it.
+template< typename ResourceType >
+class ResourceRef
+{
+public:
+	ResourceRef() = default;
+	ResourceRef(std::nullptr_t) {}
+	ResourceRef(ResourceHolder<ResourceType>& holder, ResourceHandle<ResourceType> handle);
+	ResourceRef(const ResourceRef&);
+	ResourceRef(ResourceRef&&) noexcept;
+	ResourceRef& operator=(const ResourceRef&);
+	ResourceRef& operator=(ResourceRef&&) noexcept;
+	~ResourceRef();
+
+	auto get() const -> ResourceType*;
+	auto operator->() const -> ResourceType* { return get(); }
+	auto operator*() const -> ResourceType& { return *get(); }
+	explicit operator bool() const { return get() != nullptr; }
+
+	auto getHandle() const -> ResourceHandle<ResourceType> { return mHandle; }
+	void reset();
+
+private:
+	ResourceHolder<ResourceType>* mHolder = nullptr;
+	ResourceHandle<ResourceType> mHandle;
+};
+
+// NOTE: Resources loaded with load() or accessed with get(filePath) are pinned, because their users keep plain references.
+//       Resources which are only acquired or inserted are evicted, least recently used first,
+//       when nothing references them and holder exceeds its memory budget.
 template< typename ResourceType >
 class ResourceHolder
 {
 public:
-    bool load(const std::string& filePath);
-    auto get(const std::string& filePath) -> ResourceType&;
-    bool free(const std::string& filePath);
+	ResourceHolder() = default;
+	virtual ~ResourceHolder() = default;
+	ResourceHolder(const ResourceHolder&) = delete;
+	ResourceHolder& operator=(const ResourceHolder&) = delete;
+
+	virtual bool load(const std::string& filePath);
+	auto acquire(const std::string& filePath) -> ResourceRef<ResourceType>;
+	auto get(const std::string& filePath) -> ResourceType&;
+	auto get(ResourceHandle<ResourceType> handle) const -> ResourceType*;
+	auto getHandle(const std::string& filePath) const -> ResourceHandle<ResourceType>;
+	auto getFilePath(ResourceHandle<ResourceType> handle) const -> std::string;
+	bool free(const std::string& filePath);
+	bool has(const std::string& filePath) const;
+	bool insert(const std::string& filePath, std::unique_ptr<ResourceType> resource);
+
+	void setMemoryBudget(std::size_t bytes);
+	std::size_t getMemoryBudget() const { return mMemoryBudget; }
+	std::size_t getMemoryUsage() const { return mMemoryUsage; }
+	std::size_t getNumberOfResources() const { return mIndices.size(); }
+	void trim();
+
+protected:
+	auto loadResource(const std::string& filePath) -> ResourceHandle<ResourceType>;
+	auto emplace(const std::string& filePath, std::unique_ptr<ResourceType> resource, ResourceData file = {}) -> ResourceHandle<ResourceType>;
+	void updateMemorySize(ResourceHandle<ResourceType> handle);
+	auto getReferenceCount(ResourceHandle<ResourceType> handle) const -> std::uint32_t;
+
+private:
+	friend class ResourceRef<ResourceType>;
+	void addReference(ResourceHandle<ResourceType> handle);
+	void removeReference(ResourceHandle<ResourceType> handle);
+	void evict(std::uint32_t index);
 
 private:
-	std::unordered_map< std::string, std::unique_ptr<ResourceType> > mResources;
+	struct Slot
+	{
+		std::unique_ptr<ResourceType> resource;
+		ResourceData file;
+		std::string filePath;
+		std::size_t memorySize = 0;
+		std::uint64_t lastUseTime = 0;
+		std::uint32_t generation = 1;
+		std::uint32_t referenceCount = 0;
+		bool isPinned = false;
+	};
+
+	std::vector<Slot> mSlots;
+	std::vector<std::uint32_t> mFreeSlots;
+	std::unordered_map<std::string, std::uint32_t> mIndices;
+	std::size_t mMemoryBudget = std::numeric_limits<std::size_t>::max();
+	std::size_t mMemoryUsage = 0;
+	std::uint64_t mUseTime = 0;
 };
 
+inline std::size_t getResourceMemorySize(const Texture& texture) { return texture.getMemorySize(); }
+inline std::size_t getResourceMemorySize(const sf::Texture& texture) { return std::size_t(texture.getSize().x) * texture.getSize().y * 4; }
+inline std::size_t getResourceMemorySize(const sf::SoundBuffer& buffer) { return std::size_t(buffer.getSampleCount()) * sizeof(sf::Int16); }
+inline std::size_t getResourceMemorySize(const sf::Font&) { return 0; }
+
 using SoundBufferHolder = ResourceHolder<sf::SoundBuffer>;
-using TextureHolder = ResourceHolder<ph::Texture>;
 using FontHolder = ResourceHolder<sf::Font>;
+using TextureRef = ResourceRef<Texture>;
+using SoundBufferRef = ResourceRef<sf::SoundBuffer>;
 
 }
 
@@ -1,43 +1,313 @@
 #include "Logs/logs.hpp"
 #include "resourceHolder.hpp"
+#include <algorithm>
 
 template< typename ResourceType >
-bool ph::ResourceHolder<ResourceType>::load(const std::string& filePath)
+ph::ResourceRef<ResourceType>::ResourceRef(ResourceHolder<ResourceType>& holder, ResourceHandle<ResourceType> handle)
+	:mHolder(&holder)
+	,mHandle(handle)
 {
-	std::string fullFilePath = "resources/" + filePath;
-	if (mResources.find(fullFilePath) != mResources.end())
-		return true;
-	auto resource = std::make_unique< ResourceType >();
-	if (resource->loadFromFile(fullFilePath))
+	mHolder->addReference(mHandle);
+}
+
+template< typename ResourceType >
+ph::ResourceRef<ResourceType>::ResourceRef(const ResourceRef& rhs)
+	:mHolder(rhs.mHolder)
+	,mHandle(rhs.mHandle)
+{
+	if (mHolder)
+		mHolder->addReference(mHandle);
+}
+
+template< typename ResourceType >
+ph::ResourceRef<ResourceType>::ResourceRef(ResourceRef&& rhs) noexcept
+	:mHolder(rhs.mHolder)
+	,mHandle(rhs.mHandle)
+{
+	rhs.mHolder = nullptr;
+	rhs.mHandle = {};
+}
+
+template< typename ResourceType >
+auto ph::ResourceRef<ResourceType>::operator=(const ResourceRef& rhs) -> ResourceRef&
+{
+	if (this != &rhs)
 	{
-		mResources.insert(std::make_pair(fullFilePath, std::move(resource)));
-		return true;
+		reset();
+		mHolder = rhs.mHolder;
+		mHandle = rhs.mHandle;
+		if (mHolder)
+			mHolder->addReference(mHandle);
 	}
-	else
+	return *this;
+}
+
+template< typename ResourceType >
+auto ph::ResourceRef<ResourceType>::operator=(ResourceRef&& rhs) noexcept -> ResourceRef&
+{
+	if (this != &rhs)
 	{
-		PH_LOG_ERROR("unable to load file \"" + fullFilePath + "\"");
-		return false;
+		reset();
+		mHolder = rhs.mHolder;
+		mHandle = rhs.mHandle;
+		rhs.mHolder = nullptr;
+		rhs.mHandle = {};
 	}
+	return *this;
+}
+
+template< typename ResourceType >
+ph::ResourceRef<ResourceType>::~ResourceRef()
+{
+	reset();
+}
+
+template< typename ResourceType >
+auto ph::ResourceRef<ResourceType>::get() const -> ResourceType*
+{
+	return mHolder ? mHolder->get(mHandle) : nullptr;
+}
+
+template< typename ResourceType >
+void ph::ResourceRef<ResourceType>::reset()
+{
+	if (mHolder)
+		mHolder->removeReference(mHandle);
+	mHolder = nullptr;
+	mHandle = {};
+}
+
+template< typename ResourceType >
+bool ph::ResourceHolder<ResourceType>::load(const std::string& filePath)
+{
+	ResourceHandle<ResourceType> handle = getHandle(filePath);
+	if (!handle.isValid())
+		handle = loadResource(filePath);
+	if (!handle.isValid())
+		return false;
+	mSlots[handle.index].isPinned = true;
+	trim();
+	return true;
+}
+
+template< typename ResourceType >
+auto ph::ResourceHolder<ResourceType>::acquire(const std::string& filePath) -> ResourceRef<ResourceType>
+{
+	ResourceHandle<ResourceType> handle = getHandle(filePath);
+	if (!handle.isValid())
+		handle = loadResource(filePath);
+	if (!handle.isValid())
+		return {};
+	ResourceRef<ResourceType> ref(*this, handle);
+	trim();
+	return ref;
 }
 
 template< typename ResourceType >
 auto ph::ResourceHolder<ResourceType>::get(const std::string& filePath) -> ResourceType &
 {
-	std::string fullFilePath = "resources/" + filePath;
-	auto found = mResources.find(fullFilePath);
-	if (found == mResources.end())
+	auto found = mIndices.find(filePath);
+	if (found == mIndices.end())
 	{
+		std::string fullFilePath = "resources/" + filePath;
 		PH_LOG_ERROR("You try to get a resource that wasn't loaded: " + fullFilePath);
 		throw std::runtime_error("You try to get a resource that wasn't loaded: " + fullFilePath);
 	}
-	return *found->second;
+	Slot& slot = mSlots[found->second];
+	slot.isPinned = true;
+	return *slot.resource;
+}
+
+template< typename ResourceType >
+auto ph::ResourceHolder<ResourceType>::get(ResourceHandle<ResourceType> handle) const -> ResourceType*
+{
+	if (handle.index >= mSlots.size())
+		return nullptr;
+	const Slot& slot = mSlots[handle.index];
+	return slot.generation == handle.generation ? slot.resource.get() : nullptr;
+}
+
+template< typename ResourceType >
+auto ph::ResourceHolder<ResourceType>::getHandle(const std::string& filePath) const -> ResourceHandle<ResourceType>
+{
+	auto found = mIndices.find(filePath);
+	if (found == mIndices.end())
+		return {};
+	return {found->second, mSlots[found->second].generation};
+}
+
+template< typename ResourceType >
+auto ph::ResourceHolder<ResourceType>::getFilePath(ResourceHandle<ResourceType> handle) const -> std::string
+{
+	return get(handle) ? mSlots[handle.index].filePath : std::string();
 }
 
 template< typename ResourceType >
 bool ph::ResourceHolder<ResourceType>::free(const std::string& filePath)
+{
+	auto found = mIndices.find(filePath);
+	PH_ASSERT_WARNING(found != mIndices.end(), "You try to free resources/" + filePath + ". A resource with this name does not exist.");
+	if (found == mIndices.end())
+		return false;
+
+	const std::uint32_t index = found->second;
+	PH_ASSERT_WARNING(mSlots[index].referenceCount == 0, "You try to free resources/" + filePath + " which is still referenced.");
+	if (mSlots[index].referenceCount != 0)
+		return false;
+
+	evict(index);
+	return true;
+}
+
+template< typename ResourceType >
+bool ph::ResourceHolder<ResourceType>::has(const std::string& filePath) const
+{
+	return mIndices.find(filePath) != mIndices.end();
+}
+
+template< typename ResourceType >
+bool ph::ResourceHolder<ResourceType>::insert(const std::string& filePath, std::unique_ptr<ResourceType> resource)
+{
+	if (has(filePath))
+		return false;
+	emplace(filePath, std::move(resource));
+	return true;
+}
+
+template< typename ResourceType >
+void ph::ResourceHolder<ResourceType>::setMemoryBudget(std::size_t bytes)
+{
+	mMemoryBudget = bytes;
+	trim();
+}
+
+template< typename ResourceType >
+void ph::ResourceHolder<ResourceType>::trim()
+{
+	if (mMemoryUsage <= mMemoryBudget)
+		return;
+
+	std::vector<std::uint32_t> evictable;
+	for (std::uint32_t i = 0; i < mSlots.size(); ++i)
+	{
+		const Slot& slot = mSlots[i];
+		if (slot.resource && !slot.isPinned && slot.referenceCount == 0)
+			evictable.emplace_back(i);
+	}
+	std::sort(evictable.begin(), evictable.end(), [this](std::uint32_t lhs, std::uint32_t rhs) {
+		return mSlots[lhs].lastUseTime < mSlots[rhs].lastUseTime;
+	});
+
+	for (std::uint32_t index : evictable)
+	{
+		if (mMemoryUsage <= mMemoryBudget)
+			break;
+		PH_LOG_INFO("Evicting unused resource: resources/" + mSlots[index].filePath);
+		evict(index);
+	}
+}
+
+template< typename ResourceType >
+auto ph::ResourceHolder<ResourceType>::loadResource(const std::string& filePath) -> ResourceHandle<ResourceType>
 {
 	std::string fullFilePath = "resources/" + filePath;
-	auto amountOfDeletedResources = mResources.erase(fullFilePath);   // can be equal 0 or 1
+	auto file = ph::ResourceFileSystem::read(fullFilePath);
+	auto resource = std::make_unique< ResourceType >();
+	if (!file || !resource->loadFromMemory(file->data(), file->size()))
+	{
+		PH_LOG_ERROR("unable to load file \"" + fullFilePath + "\"");
+		return {};
+	}
+
+	// NOTE: sf::Font reads its file lazily, so file has to outlive the font
+	if constexpr (std::is_same_v<ResourceType, sf::Font>)
+		return emplace(filePath, std::move(resource), std::move(*file));
+	else
+		return emplace(filePath, std::move(resource));
+}
+
+template< typename ResourceType >
+auto ph::ResourceHolder<ResourceType>::emplace(const std::string& filePath, std::unique_ptr<ResourceType> resource, ResourceData file) -> ResourceHandle<ResourceType>
+{
+	std::uint32_t index;
+	if (mFreeSlots.empty())
+	{
+		index = static_cast<std::uint32_t>(mSlots.size());
+		mSlots.emplace_back();
+	}
+	else
+	{
+		index = mFreeSlots.back();
+		mFreeSlots.pop_back();
+	}
+
+	Slot& slot = mSlots[index];
+	slot.resource = std::move(resource);
+	slot.file = std::move(file);
+	slot.filePath = filePath;
+	slot.memorySize = getResourceMemorySize(*slot.resource) + slot.file.size();
+	slot.lastUseTime = ++mUseTime;
+	slot.referenceCount = 0;
+	slot.isPinned = false;
+
+	mMemoryUsage += slot.memorySize;
+	mIndices.emplace(filePath, index);
+	return {index, slot.generation};
+}
+
+template< typename ResourceType >
+void ph::ResourceHolder<ResourceType>::updateMemorySize(ResourceHandle<ResourceType> handle)
+{
+	if (!get(handle))
+		return;
+	Slot& slot = mSlots[handle.index];
+	mMemoryUsage -= slot.memorySize;
+	slot.memorySize = getResourceMemorySize(*slot.resource) + slot.file.size();
+	mMemoryUsage += slot.memorySize;
+}
+
+template< typename ResourceType >
+auto ph::ResourceHolder<ResourceType>::getReferenceCount(ResourceHandle<ResourceType> handle) const -> std::uint32_t
+{
+	return get(handle) ? mSlots[handle.index].referenceCount : 0;
+}
+
+template< typename ResourceType >
+void ph::ResourceHolder<ResourceType>::addReference(ResourceHandle<ResourceType> handle)
+{
+	if (!get(handle))
+		return;
+	Slot& slot = mSlots[handle.index];
+	++slot.referenceCount;
+	slot.lastUseTime = ++mUseTime;
+}
+
+template< typename ResourceType >
+void ph::ResourceHolder<ResourceType>::removeReference(ResourceHandle<ResourceType> handle)
+{
+	if (!get(handle))
+		return;
+	Slot& slot = mSlots[handle.index];
+	PH_ASSERT_UNEXPECTED_SITUATION(slot.referenceCount > 0, "Resource reference count is broken!");
+	--slot.referenceCount;
+	slot.lastUseTime = ++mUseTime;
+}
+
+template< typename ResourceType >
+void ph::ResourceHolder<ResourceType>::evict(std::uint32_t index)
+{
+	Slot& slot = mSlots[index];
+	mMemoryUsage -= slot.memorySize;
+	mIndices.erase(slot.filePath);
 
-	PH_ASSERT_WARNING(amountOfDeletedResources == 1, "You try to free " + fullFilePath + ". A resource with this name does not exist.");
+	// NOTE: Resource is destroyed before its file, see loadResource()
+	slot.resource.reset();
+	slot.file = ResourceData();
+	slot.filePath.clear();
+	slot.memorySize = 0;
+	slot.referenceCount = 0;
+	slot.isPinned = false;
+	if (++slot.generation == 0)
+		slot.generation = 1;
+	mFreeSlots.emplace_back(index);
 }
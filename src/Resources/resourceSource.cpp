@@ -0,0 +1,38 @@
+#include "resourceSource.hpp"
+#include <fstream>
+
+namespace ph {
+
+ResourceData::ResourceData(std::string_view mappedBytes)
+	:mBytes(mappedBytes)
+{
+}
+
+ResourceData::ResourceData(std::vector<char> ownedBytes)
+	:mOwnedBytes(std::move(ownedBytes))
+	,mBytes(mOwnedBytes.data(), mOwnedBytes.size())
+{
+}
+
+auto LooseFilesSource::read(const std::string& filePath) const -> std::optional<ResourceData>
+{
+	std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+	if(!file.is_open())
+		return std::nullopt;
+
+	const std::streamsize fileSize = file.tellg();
+	if(fileSize < 0)
+		return std::nullopt;
+	std::vector<char> bytes(static_cast<std::size_t>(fileSize));
+	file.seekg(0);
+	if(!file.read(bytes.data(), fileSize))
+		return std::nullopt;
+	return ResourceData(std::move(bytes));
+}
+
+bool LooseFilesSource::has(const std::string& filePath) const
+{
+	return std::ifstream(filePath).is_open();
+}
+
+}
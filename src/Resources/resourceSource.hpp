@@ -0,0 +1,47 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ph {
+
+// NOTE: Bytes of resource file, they are either owned or point into memory mapped archive
+class ResourceData
+{
+public:
+	ResourceData() = default;
+	explicit ResourceData(std::string_view mappedBytes);
+	explicit ResourceData(std::vector<char> ownedBytes);
+	ResourceData(ResourceData&&) = default;
+	ResourceData& operator=(ResourceData&&) = default;
+	ResourceData(const ResourceData&) = delete;
+	ResourceData& operator=(const ResourceData&) = delete;
+
+	auto getBytes() const -> std::string_view { return mBytes; }
+	const char* data() const { return mBytes.data(); }
+	std::size_t size() const { return mBytes.size(); }
+
+private:
+	std::vector<char> mOwnedBytes;
+	std::string_view mBytes;
+};
+
+class ResourceSource
+{
+public:
+	virtual ~ResourceSource() = default;
+
+	virtual auto read(const std::string& filePath) const -> std::optional<ResourceData> = 0;
+	virtual bool has(const std::string& filePath) const = 0;
+};
+
+class LooseFilesSource : public ResourceSource
+{
+public:
+	auto read(const std::string& filePath) const -> std::optional<ResourceData> override;
+	bool has(const std::string& filePath) const override;
+};
+
+}
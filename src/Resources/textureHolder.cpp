@@ -0,0 +1,91 @@
+#include "textureHolder.hpp"
+#include "Renderer/API/openglErrors.hpp"
+#include "Utilities/threadPool.hpp"
+#include "Utilities/profiling.hpp"
+#include "Logs/logs.hpp"
+#include <GL/glew.h>
+
+namespace ph {
+
+TextureHolder::TextureHolder()
+	:mPixelBufferID(0)
+{
+}
+
+TextureHolder::~TextureHolder()
+{
+	// wait for decoding before textures are destroyed
+	for(auto& pending : mPendingTextures)
+		pending.decodedData.wait();
+
+	if(mPixelBufferID) {
+		GLCheck( glDeleteBuffers(1, &mPixelBufferID) );
+	}
+}
+
+bool TextureHolder::load(const std::string& filePath)
+{
+	if(isLoading() && has(filePath))
+		finishLoading();
+	return ResourceHolder<Texture>::load(filePath);
+}
+
+auto TextureHolder::loadAsync(const std::string& filePath) -> TextureRef
+{
+	if(has(filePath))
+		return acquire(filePath);
+
+	TextureRef texture(*this, emplace(filePath, std::make_unique<Texture>()));
+	mPendingTextures.emplace_back(PendingTexture{filePath, texture, decodeAsync(filePath)});
+	return texture;
+}
+
+auto TextureHolder::decodeAsync(const std::string& filePath) -> std::future<std::optional<TextureData>>
+{
+	if(!mThreadPool)
+		mThreadPool = std::make_unique<ThreadPool>();
+
+	return mThreadPool->submit([fullFilePath = "resources/" + filePath]() -> std::optional<TextureData> {
+		TextureData data;
+		if(Texture::decodeFile(fullFilePath, data))
+			return data;
+		return std::nullopt;
+	});
+}
+
+bool TextureHolder::finishLoading()
+{
+	PH_PROFILE_FUNCTION();
+
+	if(mPendingTextures.empty())
+		return true;
+
+	if(!mPixelBufferID) {
+		GLCheck( glGenBuffers(1, &mPixelBufferID) );
+	}
+
+	bool loadedAll = true;
+	for(auto& pending : mPendingTextures)
+	{
+		const auto data = pending.decodedData.get();
+
+		// NOTE: Nobody uses texture anymore, for example it was baked into atlas
+		if(getReferenceCount(pending.texture.getHandle()) == 1) {
+			pending.texture.reset();
+			free(pending.filePath);
+			continue;
+		}
+
+		if(!data || !pending.texture->loadFromTextureData(*data, mPixelBufferID)) {
+			// NOTE: Texture stays in holder because somebody can already point to it
+			PH_LOG_ERROR("unable to load file \"resources/" + pending.filePath + "\"");
+			loadedAll = false;
+		}
+		updateMemorySize(pending.texture.getHandle());
+	}
+	mPendingTextures.clear();
+	trim();
+	return loadedAll;
+}
+
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Resources/resourceHolder.hpp"
+#include "Renderer/API/texture.hpp"
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ph {
+
+class ThreadPool;
+
+class TextureHolder : public ResourceHolder<Texture>
+{
+public:
+	TextureHolder();
+	~TextureHolder();
+
+	bool load(const std::string& filePath) override;
+
+	// NOTE: Returned texture is decoded on thread pool and it's empty until finishLoading() uploads it
+	auto loadAsync(const std::string& filePath) -> TextureRef;
+	bool finishLoading();
+
+	// NOTE: Decodes texture on thread pool without adding it to holder
+	auto decodeAsync(const std::string& filePath) -> std::future<std::optional<TextureData>>;
+
+	bool isLoading() const { return !mPendingTextures.empty(); }
+
+private:
+	struct PendingTexture
+	{
+		std::string filePath;
+		TextureRef texture;
+		std::future<std::optional<TextureData>> decodedData;
+	};
+	std::vector<PendingTexture> mPendingTextures;
+	std::unique_ptr<ThreadPool> mThreadPool;
+	unsigned mPixelBufferID;
+};
+
+}
@@ -75,7 +75,7 @@ void GateGuardDialogue::update(const sf::Time dt)
 			else
 			{
 				auto& animationData = playerView.get<component::AnimationData>(player);
-				animationData.currentStateName = "rightUp";
+				animationData.currentStateId = animationStates::rightUp;
 				mPlayerOnThePosition = true;
 				auto leverListenerView = mRegistry.view<component::LeverListener>();
 				leverListenerView.each([](component::LeverListener& leverListenerDetails) {
@@ -33,6 +33,7 @@
 #include "ECS/Systems/areasDebug.hpp"
 #include "ECS/Systems/cars.hpp"
 #include "ECS/Systems/cutscenesActivating.hpp"
+#include "ECS/Systems/triggerVolumes.hpp"
 
 #include "ECS/Components/charactersComponents.hpp"
 #include "ECS/Components/physicsComponents.hpp"
@@ -41,7 +42,7 @@
 namespace ph {
 
 Scene::Scene(MusicPlayer& musicPlayer, SoundPlayer& soundPlayer, AIManager& aiManager, Terminal& terminal,
-             SceneManager& sceneManager, GUI& gui, Texture& tilesetTexture)
+             SceneManager& sceneManager, GUI& gui, Texture& tilesetTexture, EntitiesTemplateStorage& templateStorage)
 	:mCutSceneManager()
 	,mSystemsQueue(mRegistry)
 	,mPause(false)
@@ -53,18 +54,19 @@ Scene::Scene(MusicPlayer& musicPlayer, SoundPlayer& soundPlayer, AIManager& aiMa
 	mSystemsQueue.appendSystem<system::GameplayUI>(std::ref(gui));
 	mSystemsQueue.appendSystem<system::PlayerMovementInput>(std::ref(aiManager), std::ref(gui), this);
 	mSystemsQueue.appendSystem<system::ZombieSystem>(&aiManager);
-	mSystemsQueue.appendSystem<system::HostileCollisions>();
 	mSystemsQueue.appendSystem<system::KinematicCollisions>();
 	mSystemsQueue.appendSystem<system::PlayerCameraMovement>();
-	mSystemsQueue.appendSystem<system::PickupItems>();
 	mSystemsQueue.appendSystem<system::StaticCollisions>();
+	mSystemsQueue.appendSystem<system::TriggerVolumes>();
+	mSystemsQueue.appendSystem<system::HostileCollisions>();
+	mSystemsQueue.appendSystem<system::PickupItems>();
 	mSystemsQueue.appendSystem<system::AreasDebug>();
 	mSystemsQueue.appendSystem<system::IsPlayerAlive>();
 	mSystemsQueue.appendSystem<system::VelocityChangingAreas>();
 	mSystemsQueue.appendSystem<system::PushingAreas>();
 	mSystemsQueue.appendSystem<system::HintAreas>(std::ref(gui));
 	mSystemsQueue.appendSystem<system::GunPositioningAndTexture>();
-	mSystemsQueue.appendSystem<system::GunAttacks>();
+	mSystemsQueue.appendSystem<system::GunAttacks>(std::ref(templateStorage));
 	mSystemsQueue.appendSystem<system::MeleeAttacks>();
 	mSystemsQueue.appendSystem<system::DamageAndDeath>(std::ref(gui), std::ref(aiManager));
 	mSystemsQueue.appendSystem<system::Levers>();
@@ -74,7 +76,7 @@ Scene::Scene(MusicPlayer& musicPlayer, SoundPlayer& soundPlayer, AIManager& aiMa
 	mSystemsQueue.appendSystem<system::Lifetime>();
 	mSystemsQueue.appendSystem<system::AnimationSystem>();
 	mSystemsQueue.appendSystem<system::VelocityClear>();
-	mSystemsQueue.appendSystem<system::EntityDestroying>();
+	mSystemsQueue.appendSystem<system::EntityDestroying>(std::ref(templateStorage));
 	mSystemsQueue.appendSystem<system::Entrances>(std::ref(sceneManager));
 	mSystemsQueue.appendSystem<system::AudioSystem>(std::ref(musicPlayer), std::ref(soundPlayer));
 	mSystemsQueue.appendSystem<system::Cars>();
@@ -99,6 +101,15 @@ void Scene::update(sf::Time dt)
 		mSystemsQueue.update(dt.asSeconds());
 }
 
+void Scene::render(float interpolation)
+{
+	if(mPause)
+		return;
+
+	if(!mCutSceneManager.isCutSceneActive() || !mCutSceneManager.pausesSystems())
+		mSystemsQueue.render(interpolation);
+}
+
 void Scene::setPlayerStatus(const PlayerStatus& status)
 {
 	auto playerView = mRegistry.view<component::Bullets, component::Health, component::Player>();
@@ -125,6 +136,14 @@ void Scene::setPlayerPosition(sf::Vector2f newPosition)
 	bodyRect.rect.setPosition(newPosition);
 }
 
+sf::Vector2f Scene::getPlayerPosition()
+{
+	auto playerView = mRegistry.view<component::Player, component::BodyRect>();
+	for(auto player : playerView)
+		return playerView.get<component::BodyRect>(player).rect.getTopLeft();
+	return {};
+}
+
 entt::registry& Scene::getRegistry()
 {
 	return mRegistry;
@@ -19,14 +19,16 @@ class Terminal;
 class SceneManager;
 class GUI;
 class Texture;
+class EntitiesTemplateStorage;
 
 class Scene
 {
 public:
-    Scene(MusicPlayer&, SoundPlayer&, AIManager&, Terminal&, SceneManager&, GUI&, Texture& tilesetTexture);
+    Scene(MusicPlayer&, SoundPlayer&, AIManager&, Terminal&, SceneManager&, GUI&, Texture& tilesetTexture, EntitiesTemplateStorage&);
 
 	void handleEvent(const ActionEvent& event);
     void update(sf::Time dt);
+	void render(float interpolation);
 
 	void setPause(bool pause) { mPause = pause; }
 	bool getPause() const { return mPause; }
@@ -36,6 +38,7 @@ public:
 	void setPlayerStatus(const PlayerStatus& status);
 	PlayerStatus getPlayerStatus();
 	void setPlayerPosition(sf::Vector2f newPosition);
+	sf::Vector2f getPlayerPosition();
 
 	entt::registry& getRegistry();
 
@@ -8,6 +8,8 @@
 #include "gameData.hpp"
 #include "ECS/entitiesParser.hpp"
 #include "ECS/tiledParser.hpp"
+#include "Utilities/random.hpp"
+#include <ctime>
 
 namespace ph {
 
@@ -18,17 +20,27 @@ SceneManager::SceneManager()
 	,mIsPopping(false)
 	,mHasPlayerPositionForNextScene(false)
 	,mLastPlayerStatus()
-	,mTilesetTexture(nullptr)
+	,mSeedForNextScene(0)
+	,mCurrentSceneSeed(0)
+	,mHasSeedForNextScene(false)
 {
 }
 
-void SceneManager::changingScenesProcess()
+bool SceneManager::changingScenesProcess()
 {
 	if (mIsPopping)
 		popAction();
 
 	if (mIsReplacing)
-		replaceAction();
+		return replaceAction();
+
+	return false;
+}
+
+void SceneManager::setSeedForNextScene(unsigned seed)
+{
+	mSeedForNextScene = seed;
+	mHasSeedForNextScene = true;
 }
 
 bool SceneManager::hasPlayerPositionForNextScene() const
@@ -53,23 +65,31 @@ void SceneManager::popAction()
 	mIsPopping = false;
 }
 
-void SceneManager::replaceAction()
+bool SceneManager::replaceAction()
 {
 	mGameData->getGui().clearGUI();
 
-	if(mCurrentSceneFile == mFileOfSceneToMake && mHasPlayerPositionForNextScene)
+	const bool isNewSceneLoaded = mCurrentSceneFile != mFileOfSceneToMake || !mHasPlayerPositionForNextScene;
+	if(!isNewSceneLoaded)
 		mScene->setPlayerPosition(mPlayerPositionForNextScene);
 	else {
+		mCurrentSceneSeed = mHasSeedForNextScene ? mSeedForNextScene : static_cast<unsigned>(std::time(nullptr));
+		mHasSeedForNextScene = false;
+		Random::setSeed(mCurrentSceneSeed);
+
 		bool thereIsPlayerStatus = mScene && mGameData->getAIManager().isPlayerOnScene();
 		if (thereIsPlayerStatus)
 			mLastPlayerStatus = mScene->getPlayerStatus();
+
+		mScenePrefetcher.install(mFileOfSceneToMake, mGameData->getTextures());
 		
 		mScene.reset(new Scene(mGameData->getMusicPlayer(), mGameData->getSoundPlayer(),
-			mGameData->getAIManager(), mGameData->getTerminal(), *this, mGameData->getGui(), *mTilesetTexture));
+			mGameData->getAIManager(), mGameData->getTerminal(), *this, mGameData->getGui(), *mTilesetTexture, mEntitiesTemplateStorage));
 		SceneParser<XmlGuiParser, XmlMapParser, TiledParser, XmlAudioParser, EntitiesParser>
 			sceneParser(mGameData, mScene->getCutSceneManager(), mEntitiesTemplateStorage, mScene->getRegistry(),
 				mFileOfSceneToMake, mGameData->getTextures(), mScene->getSystemsQueue(), mGameData->getGui(),
 				mGameData->getMusicPlayer(), mGameData->getAIManager());
+		mScenePrefetcher.clearInstalled();
 
 		if(mGameData->getAIManager().isPlayerOnScene()) {
 			mScene->setPlayerStatus(mLastPlayerStatus);
@@ -81,6 +101,7 @@ void SceneManager::replaceAction()
 	PH_LOG_INFO("The scene was replaced by new scene (" + mFileOfSceneToMake + ").");
 	mIsReplacing = false;
 	mCurrentSceneFile = std::move(mFileOfSceneToMake);
+	return isNewSceneLoaded;
 }
 
 void SceneManager::handleEvent(const Event& e)
@@ -95,11 +116,17 @@ void SceneManager::update(sf::Time dt)
 	mScene->update(dt);
 }
 
+void SceneManager::render(float interpolation)
+{
+	PH_ASSERT_UNEXPECTED_SITUATION(mScene != nullptr, "There is no active scene");
+	mScene->render(interpolation);
+}
+
 void SceneManager::setGameData(GameData* const gameData)
 {
 	mGameData = gameData;
-	gameData->getTextures().load("textures/map/extrudedTileset.png");
-	mTilesetTexture = &gameData->getTextures().get("textures/map/extrudedTileset.png");
+	// NOTE: It's uploaded together with textures of the first scene
+	mTilesetTexture = gameData->getTextures().loadAsync("textures/map/extrudedTileset.png");
 }
 
 void SceneManager::replaceScene(const std::string& sceneSourceCodeFilePath)
@@ -122,4 +149,15 @@ void SceneManager::popScene()
     mIsPopping = true;
 }
 
+void SceneManager::prefetchScene(const std::string& sceneSourceCodeFilePath)
+{
+	if(sceneSourceCodeFilePath != mCurrentSceneFile)
+		mScenePrefetcher.prefetch(sceneSourceCodeFilePath);
+}
+
+void SceneManager::cancelScenePrefetch(const std::string& sceneSourceCodeFilePath)
+{
+	mScenePrefetcher.cancel(sceneSourceCodeFilePath);
+}
+
 }
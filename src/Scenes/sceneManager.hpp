@@ -1,6 +1,7 @@
 #pragma once
 
 #include "scene.hpp"
+#include "scenePrefetcher.hpp"
 #include "Events/event.hpp"
 #include "ECS/entitiesTemplateStorage.hpp"
 #include <SFML/System.hpp>
@@ -19,37 +20,51 @@ public:
     void replaceScene(const std::string& sceneSourceCodeFilePath);
     void replaceScene(const std::string& sceneSourceCodeFilePath, const sf::Vector2f& playerPosition);
     void popScene();
+	void prefetchScene(const std::string& sceneSourceCodeFilePath);
+	void cancelScenePrefetch(const std::string& sceneSourceCodeFilePath);
     
-	void changingScenesProcess();
+	// NOTE: Returns true if new scene was loaded
+	bool changingScenesProcess();
+
+	// NOTE: Random is reseeded before every scene is loaded, so scene can be replayed with the same seed
+	void setSeedForNextScene(unsigned seed);
+	unsigned getCurrentSceneSeed() const { return mCurrentSceneSeed; }
 
 	bool hasPlayerPositionForNextScene() const;
 	const sf::Vector2f& getPlayerPositionForNextScene() const;
 
 private:
-	void replaceAction();
+	bool replaceAction();
 	void popAction();
 
 public:
 	void handleEvent(const Event& event);
     void update(sf::Time dt);
+    void render(float interpolation);
 
 	Scene& getScene() { return *mScene.get(); }
 	void setGameData(GameData* const);
 
 	std::string getCurrentMapName() const { return mCurrentSceneFile; }
+	const EntitiesTemplateStorage& getEntitiesTemplateStorage() const { return mEntitiesTemplateStorage; }
+	EntitiesTemplateStorage& getEntitiesTemplateStorage() { return mEntitiesTemplateStorage; }
 
 private:
 	EntitiesTemplateStorage mEntitiesTemplateStorage;
+	ScenePrefetcher mScenePrefetcher;
     std::unique_ptr<Scene> mScene;
 	PlayerStatus mLastPlayerStatus;
 	std::string mFileOfSceneToMake;
 	std::string mCurrentSceneFile;
     GameData* mGameData;
-	Texture* mTilesetTexture;
+	TextureRef mTilesetTexture;
 	sf::Vector2f mPlayerPositionForNextScene;
+	unsigned mSeedForNextScene;
+	unsigned mCurrentSceneSeed;
     bool mIsReplacing;
     bool mIsPopping;
 	bool mHasPlayerPositionForNextScene;
+	bool mHasSeedForNextScene;
 };
 
 }
\ No newline at end of file
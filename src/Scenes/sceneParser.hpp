@@ -1,7 +1,7 @@
 #pragma once
 
 #include "ECS/entitiesTemplateStorage.hpp"
-#include "Resources/resourceHolder.hpp"
+#include "Resources/textureHolder.hpp"
 #include <entt/entity/registry.hpp>
 #include <string>
 
@@ -16,9 +16,6 @@ SceneParser<GuiParser, MapParser, ObjectsParser, AudioParser, EnttParser>
 {
 	PH_LOG_INFO("Scene linking file (" + sceneFileName + ") is being parsed.");
 
-	// TODO: place it somewhere else
-	textureHolder.load("textures/map/FULL_DESERT_TILESET_WIP.png");
-
 	Xml sceneFile;
 	sceneFile.loadFromFile(sceneFileName);
 	const auto sceneLinksNode = sceneFile.getChild("scenelinks");
@@ -33,6 +30,10 @@ SceneParser<GuiParser, MapParser, ObjectsParser, AudioParser, EnttParser>
 	parseAudio(sceneLinksNode, gameData->getSoundPlayer(), gameData->getMusicPlayer());
 	parseAmbientLight(sceneLinksNode);
 	parseArcadeMode(sceneLinksNode, systemsQueue, gui, aiManager, musicPlayer, templateStorage);
+
+	// textures requested by parsers are decoded in parallel, upload them all at once
+	if(!textureHolder.finishLoading())
+		PH_EXIT_GAME("SceneParser wasn't able to load textures of scene \"" + sceneFileName + "\"");
 }
 
 template<typename GuiParser, typename MapParser, typename ObjectsParser, typename AudioParser, typename EnttParser>
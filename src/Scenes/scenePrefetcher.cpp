@@ -0,0 +1,240 @@
+#include "scenePrefetcher.hpp"
+#include "ECS/textureAtlasBaker.hpp"
+#include "Resources/resourceFileSystem.hpp"
+#include "Utilities/xml.hpp"
+#include "Logs/logs.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace ph {
+
+ScenePrefetcher::~ScenePrefetcher()
+{
+	for(auto& [sceneFilePath, prefetch] : mPrefetches)
+		prefetch.isCancelled->store(true);
+	for(auto& [sceneFilePath, prefetch] : mPrefetches)
+		prefetch.scene.wait();
+	for(auto& prefetch : mCancelledPrefetches)
+		prefetch.scene.wait();
+}
+
+void ScenePrefetcher::prefetch(const std::string& sceneFilePath)
+{
+	removeFinishedCancelledPrefetches();
+	if(mPrefetches.find(sceneFilePath) != mPrefetches.end() || mPrefetches.size() >= maxPrefetches)
+		return;
+
+	// NOTE: Textures which are already baked into entity atlases don't have to be decoded
+	PH_LOG_INFO("Scene (" + sceneFilePath + ") is being prefetched.");
+	auto isCancelled = std::make_shared<std::atomic<bool>>(false);
+	auto scene = std::async(std::launch::async, [sceneFilePath, bakedTextures = TextureAtlasBaker::getBakedTexturePaths(), isCancelled]() {
+		return warmScene(sceneFilePath, bakedTextures, *isCancelled);
+	});
+	mPrefetches.emplace(sceneFilePath, Prefetch{std::move(scene), std::move(isCancelled)});
+}
+
+void ScenePrefetcher::cancel(const std::string& sceneFilePath)
+{
+	auto found = mPrefetches.find(sceneFilePath);
+	if(found == mPrefetches.end())
+		return;
+
+	PH_LOG_INFO("Prefetching scene (" + sceneFilePath + ") was cancelled.");
+	dropPrefetch(std::move(found->second));
+	mPrefetches.erase(found);
+}
+
+void ScenePrefetcher::dropPrefetch(Prefetch&& prefetch)
+{
+	// NOTE: Future of std::async blocks in destructor, so unfinished prefetch is kept until its thread notices it was cancelled
+	prefetch.isCancelled->store(true);
+	if(prefetch.scene.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		mCancelledPrefetches.emplace_back(std::move(prefetch));
+}
+
+void ScenePrefetcher::removeFinishedCancelledPrefetches()
+{
+	mCancelledPrefetches.erase(std::remove_if(mCancelledPrefetches.begin(), mCancelledPrefetches.end(), [](const Prefetch& prefetch) {
+		return prefetch.scene.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+	}), mCancelledPrefetches.end());
+}
+
+bool ScenePrefetcher::install(const std::string& sceneFilePath, TextureHolder& textures)
+{
+	auto found = mPrefetches.find(sceneFilePath);
+	const bool isPrefetched = found != mPrefetches.end();
+	Prefetch prefetch;
+	if(isPrefetched) {
+		prefetch = std::move(found->second);
+		mPrefetches.erase(found);
+	}
+
+	// NOTE: Entrances of the old scene are gone, so scenes prefetched for them won't be entered
+	while(!mPrefetches.empty())
+		cancel(mPrefetches.begin()->first);
+
+	if(!isPrefetched)
+		return false;
+
+	std::unique_ptr<PrefetchedScene> scene;
+	try {
+		scene = prefetch.scene.get();
+	}
+	catch(const std::exception& e) {
+		PH_LOG_WARNING("Prefetching scene (" + sceneFilePath + ") failed: " + e.what());
+		return false;
+	}
+	if(!scene)
+		return false;
+
+	for(auto& [filePath, content] : scene->fileContents)
+		Xml::preloadFile(filePath, std::move(content));
+
+	for(auto& [fileName, preparedMap] : scene->preparedMaps)
+		XmlMapParser::addPreparedMap(fileName, std::move(preparedMap));
+
+	for(const auto& [filePath, textureData] : scene->textures) {
+		if(textures.has(filePath))
+			continue;
+		auto texture = std::make_unique<Texture>();
+		if(texture->loadFromTextureData(textureData))
+			textures.insert(filePath, std::move(texture));
+	}
+
+	mIsInstalled = true;
+	PH_LOG_INFO("Prefetched scene (" + sceneFilePath + ") was installed.");
+	return true;
+}
+
+void ScenePrefetcher::clearInstalled()
+{
+	if(!mIsInstalled)
+		return;
+
+	Xml::clearPreloadedFiles();
+	XmlMapParser::clearPreparedMaps();
+	mIsInstalled = false;
+}
+
+auto ScenePrefetcher::warmScene(const std::string& sceneFilePath, const std::unordered_set<std::string>& bakedTextures,
+                                const std::atomic<bool>& isCancelled) -> std::unique_ptr<PrefetchedScene>
+{
+	// NOTE: File paths must match the ones used by SceneParser
+
+	auto scene = std::make_unique<PrefetchedScene>();
+	std::vector<std::string> texturePaths;
+
+	if(!readFile(sceneFilePath, *scene))
+		return nullptr;
+	Xml sceneFile;
+	sceneFile.loadFromString(scene->fileContents[sceneFilePath]);
+	const Xml sceneLinksNode = sceneFile.getChild("scenelinks");
+
+	const auto entitiesNodes = sceneLinksNode.getChildren("ecsObjects");
+	if(entitiesNodes.size() == 1) {
+		const std::string filePath = "scenes/ecs/" + entitiesNodes[0].getAttribute("filename").toString();
+		if(!readFile(filePath, *scene))
+			return nullptr;
+		Xml entitiesFile;
+		entitiesFile.loadFromString(scene->fileContents[filePath]);
+		collectEntitiesTextures(entitiesFile, texturePaths);
+		texturePaths.erase(std::remove_if(texturePaths.begin(), texturePaths.end(), [&bakedTextures](const std::string& texturePath) {
+			return bakedTextures.find(texturePath) != bakedTextures.end();
+		}), texturePaths.end());
+	}
+
+	if(isCancelled)
+		return nullptr;
+
+	const auto mapNodes = sceneLinksNode.getChildren("map");
+	if(mapNodes.size() == 1) {
+		const std::string filePath = "scenes/map/" + mapNodes[0].getAttribute("filename").toString();
+		if(!readFile(filePath, *scene))
+			return nullptr;
+		readFile("scenes/map/objecttypes.xml", *scene);
+		Xml mapFile;
+		mapFile.loadFromString(scene->fileContents[filePath]);
+		collectMapTextures(mapFile, texturePaths);
+		XmlMapParser mapParser;
+		scene->preparedMaps.emplace(filePath, mapParser.prepareMap(mapFile));
+	}
+
+	if(isCancelled)
+		return nullptr;
+
+	const auto guiNodes = sceneLinksNode.getChildren("gui");
+	if(guiNodes.size() == 1)
+		readFile("scenes/gui/" + guiNodes[0].getAttribute("filename").toString(), *scene);
+
+	const auto audioNodes = sceneLinksNode.getChildren("audio");
+	if(audioNodes.size() == 1)
+		readFile("scenes/audio/" + audioNodes[0].getAttribute("filename").toString(), *scene);
+
+	for(const auto& texturePath : texturePaths) {
+		if(isCancelled)
+			return nullptr;
+		decodeTexture(texturePath, *scene);
+	}
+
+	return scene;
+}
+
+bool ScenePrefetcher::readFile(const std::string& filePath, PrefetchedScene& scene)
+{
+	if(scene.fileContents.find(filePath) != scene.fileContents.end())
+		return true;
+
+	// NOTE: Missing files are reported by scene parsing
+	const auto file = ResourceFileSystem::read(filePath);
+	if(!file)
+		return false;
+	scene.fileContents.emplace(filePath, std::string(file->getBytes()));
+	return true;
+}
+
+void ScenePrefetcher::decodeTexture(const std::string& filePath, PrefetchedScene& scene)
+{
+	if(scene.textures.find(filePath) != scene.textures.end())
+		return;
+
+	TextureData data;
+	if(Texture::decodeFile("resources/" + filePath, data))
+		scene.textures.emplace(filePath, std::move(data));
+}
+
+void ScenePrefetcher::collectEntitiesTextures(const Xml& entitiesFile, std::vector<std::string>& texturePaths)
+{
+	const Xml entityTemplatesNode = entitiesFile.getChild("entityTemplates");
+	for(const Xml& entityTemplateNode : entityTemplatesNode.getChildren("entityTemplate")) {
+		for(const Xml& componentNode : entityTemplateNode.getChildren("component")) {
+			if(componentNode.hasAttribute("textureFilepath"))
+				texturePaths.emplace_back(componentNode.getAttribute("textureFilepath").toString());
+			else if(componentNode.getAttribute("name").toString() == "ParticleEmitter")
+				for(const Xml& attribNode : componentNode.getChildren("particleAttrib"))
+					if(attribNode.getAttribute("name").toString() == "texture")
+						texturePaths.emplace_back(attribNode.getAttribute("filepath").toString());
+		}
+	}
+}
+
+void ScenePrefetcher::collectMapTextures(const Xml& mapFile, std::vector<std::string>& texturePaths)
+{
+	const Xml mapNode = mapFile.getChild("map");
+	for(const Xml& objectGroupNode : mapNode.getChildren("objectgroup")) {
+		if(!objectGroupNode.hasAttribute("name") || objectGroupNode.getAttribute("name").toString() != "gameObjects")
+			continue;
+		for(const Xml& objectNode : objectGroupNode.getChildren("object")) {
+			if(objectNode.getAttribute("type").toString() != "Sprite" || objectNode.getChildren("properties").empty())
+				continue;
+			for(const Xml& propertyNode : objectNode.getChild("properties").getChildren("property")) {
+				if(propertyNode.getAttribute("name").toString() != "texturePath")
+					continue;
+				const std::string texturePath = propertyNode.getAttribute("value").toString();
+				if(texturePath != "none")
+					texturePaths.emplace_back(texturePath);
+			}
+		}
+	}
+}
+
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "ECS/xmlMapParser.hpp"
+#include "Resources/textureHolder.hpp"
+#include <atomic>
+#include <future>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ph {
+
+struct PrefetchedScene
+{
+	std::unordered_map<std::string, std::string> fileContents;
+	std::unordered_map<std::string, PreparedMap> preparedMaps;
+	std::unordered_map<std::string, TextureData> textures;
+};
+
+// NOTE: Warms scenes player can enter on other threads, so replacing scene only has to instantiate it.
+//       Scene is prefetched while player is near its entrance and dropped when player walks away from it.
+class ScenePrefetcher
+{
+public:
+	~ScenePrefetcher();
+
+	void prefetch(const std::string& sceneFilePath);
+	void cancel(const std::string& sceneFilePath);
+	bool install(const std::string& sceneFilePath, TextureHolder&);
+	void clearInstalled();
+
+private:
+	struct Prefetch
+	{
+		std::future<std::unique_ptr<PrefetchedScene>> scene;
+		std::shared_ptr<std::atomic<bool>> isCancelled;
+	};
+
+	void dropPrefetch(Prefetch&&);
+	void removeFinishedCancelledPrefetches();
+
+	static auto warmScene(const std::string& sceneFilePath, const std::unordered_set<std::string>& bakedTextures,
+	                      const std::atomic<bool>& isCancelled) -> std::unique_ptr<PrefetchedScene>;
+	static bool readFile(const std::string& filePath, PrefetchedScene&);
+	static void decodeTexture(const std::string& filePath, PrefetchedScene&);
+	static void collectEntitiesTextures(const Xml& entitiesFile, std::vector<std::string>& texturePaths);
+	static void collectMapTextures(const Xml& mapFile, std::vector<std::string>& texturePaths);
+
+private:
+	// NOTE: A few entrances can be near player at once, for example on both sides of a narrow corridor
+	static constexpr std::size_t maxPrefetches = 3;
+
+	std::unordered_map<std::string, Prefetch> mPrefetches;
+	std::vector<Prefetch> mCancelledPrefetches;
+	bool mIsInstalled = false;
+};
+
+}
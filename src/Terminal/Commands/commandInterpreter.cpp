@@ -33,6 +33,8 @@ void CommandInterpreter::init()
 	mCommandsMap["view"] =						&CommandInterpreter::executeView;
 	mCommandsMap["gotoscene"] =					&CommandInterpreter::executeGotoScene;
 	mCommandsMap["light"] =						&CommandInterpreter::executeLight;
+	mCommandsMap["simrate"] =					&CommandInterpreter::executeSimulationRate;
+	mCommandsMap["framerate"] =					&CommandInterpreter::executeFramerate;
 	mCommandsMap["m"] =							&CommandInterpreter::executeMove;
 	mCommandsMap[""] =							&CommandInterpreter::executeInfoMessage;
 }
@@ -90,7 +92,7 @@ void CommandInterpreter::executeHelp() const
 		"SETVOLUME", "TELEPORT"
 	};
 	const std::vector<std::string> commandsList2{
-		"CURRENTPOS", "COLLISIONDEBUG", "SPAWN", "VIEW"
+		"CURRENTPOS", "COLLISIONDEBUG", "SPAWN", "VIEW", "SIMRATE", "FRAMERATE"
 	};
 
 	if (commandContains('2')){
@@ -293,6 +295,34 @@ void CommandInterpreter::executeLight() const
 		lightDebug.drawLight = on;
 }
 
+void CommandInterpreter::executeSimulationRate() const
+{
+	const float stepsPerSecond = getVolumeFromCommand();
+	if(stepsPerSecond < 1.f || stepsPerSecond > 1000.f) {
+		executeMessage("Incorrect simulation rate! Enter value from 1 to 1000 steps per second", MessageType::ERROR);
+		return;
+	}
+	mGameData->getFixedTimestep().setSimulationRate(stepsPerSecond);
+}
+
+void CommandInterpreter::executeFramerate() const
+{
+	auto& window = mGameData->getWindow();
+	if(commandContains("vsync")) {
+		window.setFramerateLimit(0);
+		window.setVerticalSyncEnabled(true);
+		return;
+	}
+
+	const float framerateLimit = getVolumeFromCommand();
+	if((!commandContains('0') && framerateLimit == 0.f) || framerateLimit < 0.f) {
+		executeMessage("Incorrect argument! Enter 'vsync', 0 for unlimited or frames per second limit", MessageType::ERROR);
+		return;
+	}
+	window.setVerticalSyncEnabled(false);
+	window.setFramerateLimit(static_cast<unsigned>(framerateLimit));
+}
+
 auto CommandInterpreter::getVector2Argument() const -> sf::Vector2f
 {
 	const std::string numbers("1234567890-");
@@ -55,6 +55,9 @@ private:
 
 	void executeLight() const;
 
+	void executeSimulationRate() const;
+	void executeFramerate() const;
+
 	auto getVector2Argument() const -> sf::Vector2f;
 	sf::Vector2f handleGetVector2ArgumentError() const;
 
@@ -1,6 +1,7 @@
 #include "terminal.hpp"
 
 #include "gameData.hpp"
+#include "Logs/logger.hpp"
 
 namespace ph {
 
@@ -12,6 +13,12 @@ Terminal::Terminal()
 {
 }
 
+Terminal::~Terminal()
+{
+	// NOTE: Logging thread mustn't post logs which are still queued to destroyed terminal
+	Logger::flush();
+}
+
 void Terminal::init(GameData* gameData)
 {
 	mGameData = gameData;
@@ -34,6 +41,13 @@ void Terminal::handleEvent(const ph::Event& phEvent)
 
 void Terminal::update()
 {
+	{
+		std::lock_guard<std::mutex> lock(mPostedOutputLinesMutex);
+		for(const auto& line : mPostedOutputLines)
+			pushOutputLine(line);
+		mPostedOutputLines.clear();
+	}
+
 	if(mKeyboardInputHandler.isEnterClicked()) {
 		auto& content = mTerminalSharedData->mContent;
 		mCommandInterpreter.handleCommand(content);
@@ -51,4 +65,10 @@ void Terminal::pushOutputLine(const OutputLine& line)
 	mTerminalImage.getOutputArea().pushOutputLine(line);
 }
 
+void Terminal::postOutputLine(const OutputLine& line)
+{
+	std::lock_guard<std::mutex> lock(mPostedOutputLinesMutex);
+	mPostedOutputLines.emplace_back(line);
+}
+
 }
@@ -3,6 +3,8 @@
 #include <SFML/Graphics.hpp>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include "terminalSharedData.hpp"
 #include "Input/terminalInputHandler.hpp"
 #include "Commands/commandInterpreter.hpp"
@@ -18,6 +20,7 @@ class Terminal
 {
 public:
 	Terminal();
+	~Terminal();
 	void init(GameData*);
 
 	void setSceneRegistry(entt::registry*);
@@ -25,6 +28,9 @@ public:
 	void update();
 	void pushOutputLine(const OutputLine&);
 
+	// NOTE: Can be called from any thread, line is pushed in the next update()
+	void postOutputLine(const OutputLine&);
+
 	auto getSharedData() -> TerminalSharedData & { return mTerminalSharedData; }
 
 private:
@@ -33,6 +39,8 @@ private:
 	TerminalInputHandler mKeyboardInputHandler;
 	CommandInterpreter mCommandInterpreter;
 	GameData* mGameData;
+	std::vector<OutputLine> mPostedOutputLines;
+	std::mutex mPostedOutputLinesMutex;
 };
 
 }
@@ -0,0 +1,158 @@
+#include "lz4.hpp"
+#include <cstdint>
+#include <cstring>
+
+namespace ph {
+
+namespace {
+	constexpr std::size_t minMatchLength = 4;
+	constexpr std::size_t lastLiteralsLength = 5;
+	constexpr std::size_t matchStartMargin = 12;
+	constexpr std::size_t maxOffset = 65535;
+	constexpr unsigned hashLog = 12;
+
+	std::uint32_t read32(const unsigned char* source)
+	{
+		std::uint32_t value;
+		std::memcpy(&value, source, sizeof(value));
+		return value;
+	}
+
+	std::uint32_t hash(std::uint32_t sequence)
+	{
+		return (sequence * 2654435761u) >> (32 - hashLog);
+	}
+
+	void writeLengthExtension(std::vector<char>& destination, std::size_t length)
+	{
+		while(length >= 255) {
+			destination.push_back(static_cast<char>(255));
+			length -= 255;
+		}
+		destination.push_back(static_cast<char>(length));
+	}
+
+	void writeLiterals(std::vector<char>& destination, const unsigned char* literals, std::size_t literalsLength, unsigned char matchToken)
+	{
+		const unsigned char literalsToken = literalsLength >= 15 ? 15 : static_cast<unsigned char>(literalsLength);
+		destination.push_back(static_cast<char>((literalsToken << 4) | matchToken));
+		if(literalsLength >= 15)
+			writeLengthExtension(destination, literalsLength - 15);
+		destination.insert(destination.end(), literals, literals + literalsLength);
+	}
+
+	bool readLengthExtension(const unsigned char* source, std::size_t sourceSize, std::size_t& position, std::size_t& length)
+	{
+		unsigned char byte;
+		do {
+			if(position >= sourceSize)
+				return false;
+			byte = source[position++];
+			length += byte;
+		} while(byte == 255);
+		return true;
+	}
+}
+
+std::vector<char> Lz4::compress(std::string_view source)
+{
+	const auto* src = reinterpret_cast<const unsigned char*>(source.data());
+	const std::size_t sourceSize = source.size();
+
+	std::vector<char> destination;
+	destination.reserve(sourceSize + sourceSize / 255 + 16);
+
+	std::size_t anchor = 0;
+	if(sourceSize > matchStartMargin)
+	{
+		// NOTE: Hash table stores positions + 1, so 0 means empty slot
+		std::vector<std::uint32_t> hashTable(std::size_t(1) << hashLog, 0);
+		const std::size_t matchEndLimit = sourceSize - lastLiteralsLength;
+		const std::size_t matchStartLimit = sourceSize - matchStartMargin;
+
+		std::size_t position = 0;
+		while(position < matchStartLimit)
+		{
+			const std::uint32_t sequence = read32(src + position);
+			std::uint32_t& slot = hashTable[hash(sequence)];
+			const std::size_t candidate = slot;
+			slot = static_cast<std::uint32_t>(position + 1);
+
+			if(candidate == 0 || position - (candidate - 1) > maxOffset || read32(src + candidate - 1) != sequence) {
+				++position;
+				continue;
+			}
+
+			const std::size_t matchPosition = candidate - 1;
+			std::size_t matchLength = minMatchLength;
+			while(position + matchLength < matchEndLimit && src[matchPosition + matchLength] == src[position + matchLength])
+				++matchLength;
+
+			const std::size_t extraMatchLength = matchLength - minMatchLength;
+			const unsigned char matchToken = extraMatchLength >= 15 ? 15 : static_cast<unsigned char>(extraMatchLength);
+			writeLiterals(destination, src + anchor, position - anchor, matchToken);
+
+			const std::size_t offset = position - matchPosition;
+			destination.push_back(static_cast<char>(offset & 0xFF));
+			destination.push_back(static_cast<char>(offset >> 8));
+			if(extraMatchLength >= 15)
+				writeLengthExtension(destination, extraMatchLength - 15);
+
+			position += matchLength;
+			anchor = position;
+		}
+	}
+
+	writeLiterals(destination, src + anchor, sourceSize - anchor, 0);
+	return destination;
+}
+
+bool Lz4::decompress(std::string_view compressed, char* destination, std::size_t destinationSize)
+{
+	const auto* src = reinterpret_cast<const unsigned char*>(compressed.data());
+	const std::size_t sourceSize = compressed.size();
+	std::size_t sourcePosition = 0;
+	std::size_t destinationPosition = 0;
+
+	while(true)
+	{
+		if(sourcePosition >= sourceSize)
+			return false;
+		const unsigned char token = src[sourcePosition++];
+
+		std::size_t literalsLength = token >> 4;
+		if(literalsLength == 15 && !readLengthExtension(src, sourceSize, sourcePosition, literalsLength))
+			return false;
+		if(literalsLength > sourceSize - sourcePosition || literalsLength > destinationSize - destinationPosition)
+			return false;
+		std::memcpy(destination + destinationPosition, src + sourcePosition, literalsLength);
+		sourcePosition += literalsLength;
+		destinationPosition += literalsLength;
+
+		// NOTE: Last sequence contains only literals
+		if(sourcePosition == sourceSize)
+			return destinationPosition == destinationSize;
+
+		if(sourceSize - sourcePosition < 2)
+			return false;
+		const std::size_t offset = src[sourcePosition] | (src[sourcePosition + 1] << 8);
+		sourcePosition += 2;
+		if(offset == 0 || offset > destinationPosition)
+			return false;
+
+		std::size_t matchLength = token & 0x0F;
+		if(matchLength == 15 && !readLengthExtension(src, sourceSize, sourcePosition, matchLength))
+			return false;
+		matchLength += minMatchLength;
+		if(matchLength > destinationSize - destinationPosition)
+			return false;
+
+		// NOTE: Match can overlap with bytes it's producing, so it's copied byte by byte
+		const char* match = destination + destinationPosition - offset;
+		for(std::size_t i = 0; i < matchLength; ++i)
+			destination[destinationPosition + i] = match[i];
+		destinationPosition += matchLength;
+	}
+}
+
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+#include <cstddef>
+
+namespace ph {
+
+// NOTE: Implements LZ4 block format (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md)
+//       Compression is greedy and fast rather than strong, it's used only by offline tools
+
+namespace Lz4 {
+	std::vector<char> compress(std::string_view source);
+
+	bool decompress(std::string_view compressed, char* destination, std::size_t destinationSize);
+}
+
+}
@@ -3,7 +3,10 @@
 #include "Utilities/forceInline.hpp"
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Graphics/Rect.hpp>
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <optional>
 
 namespace ph::Math {
 
@@ -29,6 +32,9 @@ namespace ph::Math {
 
 	FORCE_INLINE bool areApproximatelyEqual(float a, float b, float maxApproximation);
 	FORCE_INLINE bool areApproximatelyEqual(const sf::Vector2f a, const sf::Vector2f b, float maxApproximation);
+
+	// NOTE: Returns t for which rayOrigin + rayDirection * t enters the rect, it's 0 if ray starts inside of the rect
+	FORCE_INLINE std::optional<float> getRayIntersectionDistance(const sf::Vector2f rayOrigin, const sf::Vector2f rayDirection, const sf::FloatRect& rect);
 }
 
 #include "math.inl"
@@ -70,4 +70,36 @@ namespace ph::Math {
 		return areApproximatelyEqual(a.x, b.x, maxApproximation) && areApproximatelyEqual(a.y, b.y, maxApproximation);
 	}
 
+	std::optional<float> getRayIntersectionDistance(const sf::Vector2f rayOrigin, const sf::Vector2f rayDirection, const sf::FloatRect& rect)
+	{
+		float entering = 0.f;
+		float leaving = std::numeric_limits<float>::max();
+
+		const float origins[] = {rayOrigin.x, rayOrigin.y};
+		const float directions[] = {rayDirection.x, rayDirection.y};
+		const float slabsMin[] = {rect.left, rect.top};
+		const float slabsMax[] = {rect.left + rect.width, rect.top + rect.height};
+
+		for(int axis = 0; axis < 2; ++axis)
+		{
+			if(directions[axis] == 0.f) {
+				if(origins[axis] < slabsMin[axis] || origins[axis] > slabsMax[axis])
+					return std::nullopt;
+				continue;
+			}
+
+			float slabEntering = (slabsMin[axis] - origins[axis]) / directions[axis];
+			float slabLeaving = (slabsMax[axis] - origins[axis]) / directions[axis];
+			if(slabEntering > slabLeaving)
+				std::swap(slabEntering, slabLeaving);
+
+			entering = std::max(entering, slabEntering);
+			leaving = std::min(leaving, slabLeaving);
+			if(entering > leaving)
+				return std::nullopt;
+		}
+
+		return entering;
+	}
+
 }
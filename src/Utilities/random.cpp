@@ -1,32 +1,166 @@
 #include "random.hpp"
 #include "Logs/logs.hpp"
-#include <random>
+#include <atomic>
 #include <ctime>
 
-namespace ph::Random {
+namespace ph {
 
-static std::default_random_engine engine = std::default_random_engine(static_cast<unsigned>(time(nullptr)));
+namespace {
 
-float generateNumber(const float min, const float max)
+std::uint64_t splitMix64(std::uint64_t& state)
+{
+	std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+std::uint32_t rotateLeft(const std::uint32_t x, int k)
+{
+	return (x << k) | (x >> (32 - k));
+}
+
+std::atomic<std::uint64_t> globalSeed = static_cast<std::uint64_t>(std::time(nullptr));
+std::atomic<std::uint32_t> globalSeedVersion = 0;
+std::atomic<std::uint32_t> nextWorkerThreadStream = Random::Streams::FirstWorkerThread;
+
+struct ThreadGenerator
+{
+	RandomGenerator generator;
+	std::uint32_t stream = Random::Streams::MainThread;
+	std::uint32_t seedVersion = ~0u;
+	bool hasStream = false;
+};
+
+thread_local ThreadGenerator threadGenerator;
+
+RandomGenerator& getThreadGenerator()
+{
+	const std::uint32_t seedVersion = globalSeedVersion.load(std::memory_order_acquire);
+	if(threadGenerator.seedVersion != seedVersion) {
+		if(!threadGenerator.hasStream) {
+			threadGenerator.stream = nextWorkerThreadStream++;
+			threadGenerator.hasStream = true;
+		}
+		threadGenerator.generator.seed(globalSeed.load(std::memory_order_relaxed), threadGenerator.stream);
+		threadGenerator.seedVersion = seedVersion;
+	}
+	return threadGenerator.generator;
+}
+
+}
+
+RandomGenerator::RandomGenerator(std::uint64_t seed, std::uint32_t stream)
+{
+	this->seed(seed, stream);
+}
+
+void RandomGenerator::seed(std::uint64_t seed, std::uint32_t stream)
+{
+	// NOTE: Streams are separated by hashing, state made only of zeros is impossible because splitMix64 is a bijection
+	std::uint64_t state = seed ^ (static_cast<std::uint64_t>(stream) * 0xD1B54A32D192ED03ull);
+	const std::uint64_t a = splitMix64(state);
+	const std::uint64_t b = splitMix64(state);
+	mState[0] = static_cast<std::uint32_t>(a);
+	mState[1] = static_cast<std::uint32_t>(a >> 32);
+	mState[2] = static_cast<std::uint32_t>(b);
+	mState[3] = static_cast<std::uint32_t>(b >> 32);
+}
+
+std::uint32_t RandomGenerator::next()
+{
+	const std::uint32_t result = rotateLeft(mState[1] * 5, 7) * 9;
+	const std::uint32_t t = mState[1] << 9;
+	mState[2] ^= mState[0];
+	mState[3] ^= mState[1];
+	mState[1] ^= mState[2];
+	mState[0] ^= mState[3];
+	mState[2] ^= t;
+	mState[3] = rotateLeft(mState[3], 11);
+	return result;
+}
+
+float RandomGenerator::generateUnitNumber()
+{
+	// NOTE: 24 high bits fill mantissa of float, result is in [0, 1)
+	return static_cast<float>(next() >> 8) * (1.f / 16777216.f);
+}
+
+float RandomGenerator::generateNumber(const float min, const float max)
 {
 	PH_ASSERT(min <= max, "Min can't be greater than max");
-	std::uniform_real_distribution<float> dist(min, max);
-	return dist(engine);
+	return min + (max - min) * generateUnitNumber();
 }
 
-int generateNumber(const int min, const int max)
+int RandomGenerator::generateNumber(const int min, const int max)
 {
 	PH_ASSERT(min <= max, "Min can't be greater than max");
-	std::uniform_int_distribution<> dist(min, max);
-	return dist(engine);
+	const std::uint64_t range = static_cast<std::uint64_t>(static_cast<std::int64_t>(max) - min) + 1;
+	return static_cast<int>(min + static_cast<std::int64_t>((next() * range) >> 32));
 }
 
-sf::Vector2f generateVector(const sf::Vector2f min, const sf::Vector2f max)
+sf::Vector2f RandomGenerator::generateVector(const sf::Vector2f min, const sf::Vector2f max)
+{
+	PH_ASSERT(min.x <= max.x && min.y <= max.y, "Min can't be greater than max");
+	const float x = min.x + (max.x - min.x) * generateUnitNumber();
+	const float y = min.y + (max.y - min.y) * generateUnitNumber();
+	return sf::Vector2f(x, y);
+}
+
+void RandomGenerator::generateNumbers(float* out, std::size_t count, const float min, const float max)
+{
+	PH_ASSERT(min <= max, "Min can't be greater than max");
+	const float range = max - min;
+	for(std::size_t i = 0; i < count; ++i)
+		out[i] = min + range * generateUnitNumber();
+}
+
+void RandomGenerator::generateVectors(sf::Vector2f* out, std::size_t count, const sf::Vector2f min, const sf::Vector2f max)
 {
 	PH_ASSERT(min.x <= max.x && min.y <= max.y, "Min can't be greater than max");
-	std::uniform_real_distribution<float> distX(min.x, max.x);
-	std::uniform_real_distribution<float> distY(min.y, max.y);
-	return sf::Vector2f(distX(engine), distY(engine));
+	const sf::Vector2f range = max - min;
+	for(std::size_t i = 0; i < count; ++i) {
+		out[i].x = min.x + range.x * generateUnitNumber();
+		out[i].y = min.y + range.y * generateUnitNumber();
+	}
+}
+
+namespace Random {
+
+void setSeed(std::uint64_t seed)
+{
+	globalSeed.store(seed, std::memory_order_relaxed);
+	globalSeedVersion.fetch_add(1, std::memory_order_release);
+	threadGenerator.stream = Streams::MainThread;
+	threadGenerator.hasStream = true;
+	getThreadGenerator();
+}
+
+std::uint64_t getSeed()
+{
+	return globalSeed.load(std::memory_order_relaxed);
+}
+
+RandomGenerator makeStream(std::uint32_t stream)
+{
+	return RandomGenerator(getSeed(), stream);
+}
+
+float generateNumber(const float min, const float max)
+{
+	return getThreadGenerator().generateNumber(min, max);
+}
+
+int generateNumber(const int min, const int max)
+{
+	return getThreadGenerator().generateNumber(min, max);
+}
+
+sf::Vector2f generateVector(const sf::Vector2f min, const sf::Vector2f max)
+{
+	return getThreadGenerator().generateVector(min, max);
+}
+
 }
 
 }
@@ -1,10 +1,62 @@
 #pragma once
 
 #include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
 
-namespace ph::Random {
+namespace ph {
 
+// NOTE: xoshiro128** generator, its whole state fits in 16 bytes so every system and thread can own one
+class RandomGenerator
+{
+public:
+	explicit RandomGenerator(std::uint64_t seed = 0, std::uint32_t stream = 0);
+
+	void seed(std::uint64_t seed, std::uint32_t stream = 0);
+
+	std::uint32_t next();
+
+	float generateNumber(const float min, const float max);
+	int generateNumber(const int min, const int max);
+	sf::Vector2f generateVector(const sf::Vector2f min, const sf::Vector2f max);
+
+	void generateNumbers(float* out, std::size_t count, const float min, const float max);
+	void generateVectors(sf::Vector2f* out, std::size_t count, const sf::Vector2f min, const sf::Vector2f max);
+
+private:
+	float generateUnitNumber();
+
+private:
+	std::uint32_t mState[4];
+};
+
+namespace Random {
+
+	// NOTE: Systems which use random numbers own their stream, so they don't change numbers generated by each other
+	//       and can generate them from worker threads. Stream is derived from global seed when it's created.
+	namespace Streams {
+		enum : std::uint32_t
+		{
+			MainThread,
+			Particles,
+			Zombies,
+			GunAttacks,
+			ArcadeMode,
+			FirstWorkerThread = 1024
+		};
+	}
+
+	// NOTE: Global seed is current time by default, fixed seed makes gameplay reproducible.
+	//       Calling thread gets MainThread stream, other threads get their streams in order of first use.
+	void setSeed(std::uint64_t seed);
+	std::uint64_t getSeed();
+
+	RandomGenerator makeStream(std::uint32_t stream);
+
+	// NOTE: These use stream of calling thread
 	float generateNumber(const float min, const float max);
 	int generateNumber(const int min, const int max);
 	sf::Vector2f generateVector(const sf::Vector2f min, const sf::Vector2f max);
 }
+
+}
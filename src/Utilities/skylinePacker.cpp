@@ -0,0 +1,92 @@
+#include "skylinePacker.hpp"
+#include <algorithm>
+
+namespace ph {
+
+SkylinePacker::SkylinePacker(sf::Vector2i areaSize)
+	:mSkyline{{0, 0, areaSize.x}}
+	,mAreaSize(areaSize)
+{
+}
+
+auto SkylinePacker::insert(sf::Vector2i rectSize) -> std::optional<sf::Vector2i>
+{
+	if(rectSize.x <= 0 || rectSize.y <= 0)
+		return std::nullopt;
+
+	std::size_t bestNodeIndex = mSkyline.size();
+	int bestBottom = mAreaSize.y + 1;
+	int bestNodeWidth = mAreaSize.x + 1;
+	int bestY = 0;
+
+	for(std::size_t i = 0; i < mSkyline.size(); ++i)
+	{
+		const int y = findPositionY(i, rectSize);
+		if(y < 0)
+			continue;
+		const int bottom = y + rectSize.y;
+		if(bottom < bestBottom || (bottom == bestBottom && mSkyline[i].width < bestNodeWidth)) {
+			bestNodeIndex = i;
+			bestBottom = bottom;
+			bestNodeWidth = mSkyline[i].width;
+			bestY = y;
+		}
+	}
+
+	if(bestNodeIndex == mSkyline.size())
+		return std::nullopt;
+
+	const sf::Vector2i position(mSkyline[bestNodeIndex].x, bestY);
+	addNode(bestNodeIndex, position, rectSize);
+	return position;
+}
+
+int SkylinePacker::findPositionY(std::size_t nodeIndex, sf::Vector2i rectSize) const
+{
+	if(mSkyline[nodeIndex].x + rectSize.x > mAreaSize.x)
+		return -1;
+
+	int y = 0;
+	int widthLeft = rectSize.x;
+	for(std::size_t i = nodeIndex; widthLeft > 0; ++i)
+	{
+		y = std::max(y, mSkyline[i].y);
+		if(y + rectSize.y > mAreaSize.y)
+			return -1;
+		widthLeft -= mSkyline[i].width;
+	}
+	return y;
+}
+
+void SkylinePacker::addNode(std::size_t nodeIndex, sf::Vector2i position, sf::Vector2i rectSize)
+{
+	mSkyline.insert(mSkyline.begin() + nodeIndex, Node{position.x, position.y + rectSize.y, rectSize.x});
+
+	// shrink nodes which are covered by the new one
+	for(std::size_t i = nodeIndex + 1; i < mSkyline.size();)
+	{
+		const Node& previous = mSkyline[i - 1];
+		Node& node = mSkyline[i];
+		const int overlap = previous.x + previous.width - node.x;
+		if(overlap <= 0)
+			break;
+		node.x += overlap;
+		node.width -= overlap;
+		if(node.width > 0)
+			break;
+		mSkyline.erase(mSkyline.begin() + i);
+	}
+
+	// merge neighbours on the same height
+	for(std::size_t i = 0; i + 1 < mSkyline.size();)
+	{
+		if(mSkyline[i].y == mSkyline[i + 1].y) {
+			mSkyline[i].width += mSkyline[i + 1].width;
+			mSkyline.erase(mSkyline.begin() + i + 1);
+		}
+		else
+			++i;
+	}
+}
+
+}
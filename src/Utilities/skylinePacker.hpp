@@ -0,0 +1,36 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <optional>
+#include <vector>
+
+namespace ph {
+
+// NOTE: Packs rectangles into area using bottom-left skyline heuristic.
+//       Positions are top-left corners with y axis pointing down.
+class SkylinePacker
+{
+public:
+	explicit SkylinePacker(sf::Vector2i areaSize);
+
+	auto insert(sf::Vector2i rectSize) -> std::optional<sf::Vector2i>;
+
+	sf::Vector2i getAreaSize() const { return mAreaSize; }
+
+private:
+	int findPositionY(std::size_t nodeIndex, sf::Vector2i rectSize) const;
+	void addNode(std::size_t nodeIndex, sf::Vector2i position, sf::Vector2i rectSize);
+
+private:
+	struct Node
+	{
+		int x;
+		int y;
+		int width;
+	};
+
+	std::vector<Node> mSkyline;
+	sf::Vector2i mAreaSize;
+};
+
+}
@@ -0,0 +1,55 @@
+#include "threadPool.hpp"
+
+namespace ph {
+
+namespace {
+	unsigned getDefaultNumberOfThreads()
+	{
+		// leave one core for the main thread
+		const unsigned hardwareThreads = std::thread::hardware_concurrency();
+		return hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+	}
+}
+
+ThreadPool::ThreadPool()
+	:ThreadPool(getDefaultNumberOfThreads())
+{
+}
+
+ThreadPool::ThreadPool(unsigned numberOfThreads)
+	:mIsStopping(false)
+{
+	mWorkers.reserve(numberOfThreads);
+	for(unsigned i = 0; i < numberOfThreads; ++i)
+		mWorkers.emplace_back(&ThreadPool::work, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mIsStopping = true;
+	}
+	mTaskAdded.notify_all();
+	for(auto& worker : mWorkers)
+		worker.join();
+}
+
+void ThreadPool::work()
+{
+	for(;;)
+	{
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mTaskAdded.wait(lock, [this]() { return mIsStopping || !mTasks.empty(); });
+			if(mTasks.empty())
+				return;
+			task = std::move(mTasks.front());
+			mTasks.pop();
+		}
+		task();
+	}
+}
+
+}
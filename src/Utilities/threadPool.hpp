@@ -0,0 +1,40 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace ph {
+
+class ThreadPool
+{
+public:
+	ThreadPool();
+	explicit ThreadPool(unsigned numberOfThreads);
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+	~ThreadPool();
+
+	template<typename Task>
+	auto submit(Task task) -> std::future<decltype(task())>;
+
+	unsigned getNumberOfThreads() const { return static_cast<unsigned>(mWorkers.size()); }
+
+private:
+	void work();
+
+private:
+	std::vector<std::thread> mWorkers;
+	std::queue<std::function<void()>> mTasks;
+	std::mutex mMutex;
+	std::condition_variable mTaskAdded;
+	bool mIsStopping;
+};
+
+}
+
+#include "threadPool.inl"
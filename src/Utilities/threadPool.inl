@@ -0,0 +1,18 @@
+namespace ph {
+
+template<typename Task>
+auto ThreadPool::submit(Task task) -> std::future<decltype(task())>
+{
+	// NOTE: std::function must be copyable so packaged_task is held by shared_ptr
+	using Result = decltype(task());
+	auto packagedTask = std::make_shared<std::packaged_task<Result()>>(std::move(task));
+	auto future = packagedTask->get_future();
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mTasks.emplace([packagedTask]() { (*packagedTask)(); });
+	}
+	mTaskAdded.notify_one();
+	return future;
+}
+
+}
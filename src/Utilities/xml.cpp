@@ -1,28 +1,59 @@
 #include "xml.hpp"
+#include "Resources/resourceFileSystem.hpp"
 #include "Logs/logs.hpp"
-#include <fstream>
 
 namespace ph {
 
 void Xml::loadFromFile(std::string filePath)
+{
+	std::unique_lock<std::mutex> preloadedFilesLock(sPreloadedFilesMutex);
+	auto preloaded = sPreloadedFiles.find(filePath);
+	if(preloaded != sPreloadedFiles.end()) {
+		loadFromBytes(preloaded->second, filePath);
+	}
+	else {
+		preloadedFilesLock.unlock();
+		const auto file = ResourceFileSystem::read(filePath);
+		if (!file)
+			PH_EXCEPTION("cannot open file: " + filePath);
+		loadFromBytes(file->getBytes(), filePath);
+	}
+	PH_LOG_INFO("Xml loadFromFile(): " + mContent);
+}
+
+void Xml::loadFromString(std::string_view xmlContent)
+{
+	loadFromBytes(xmlContent, "string");
+}
+
+void Xml::preloadFile(const std::string& filePath, std::string content)
+{
+	std::lock_guard<std::mutex> lock(sPreloadedFilesMutex);
+	sPreloadedFiles[filePath] = std::move(content);
+}
+
+void Xml::clearPreloadedFiles()
+{
+	std::lock_guard<std::mutex> lock(sPreloadedFilesMutex);
+	sPreloadedFiles.clear();
+}
+
+void Xml::loadFromBytes(std::string_view content, const std::string& sourceName)
 {
 	mContent.clear();
-	std::ifstream ifs(filePath);
-	if (!ifs.is_open())
-		PH_EXCEPTION("cannot open file: " + filePath);
-	std::string line;
-	if (!std::getline(ifs, line))
-		PH_EXCEPTION("given xml file is empty or something bad happened (" + filePath + ")");
+	if (content.empty())
+		PH_EXCEPTION("given xml file is empty or something bad happened (" + sourceName + ")");
 	// NOTE: Delete prolog but keep '?>' for implementation purpose
-	const std::size_t begin = line.find("?>");
+	const std::string_view firstLine = content.substr(0, content.find('\n'));
+	const std::size_t begin = firstLine.find("?>");
 	if (begin == std::string::npos)
-		line.insert(0, "?>");
+		mContent += "?>";
 	else
-		line.erase(0, begin);
-	mContent += line;
-	while (std::getline(ifs, line))
-		mContent += line;
-	PH_LOG_INFO("Xml loadFromFile(): " + mContent);
+		content.remove_prefix(begin);
+	mContent.reserve(mContent.size() + content.size());
+	for (char c : content)
+		if (c != '\n' && c != '\r')
+			mContent += c;
 }
 
 Xml Xml::getChild(const std::string& name) const
@@ -1,8 +1,11 @@
 #pragma once
 
 #include "cast.hpp"
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <vector>
+#include <unordered_map>
 #include <SFML/Graphics/Color.hpp>
 
 namespace ph {
@@ -11,6 +14,12 @@ class Xml
 {
 public:
 	void loadFromFile(std::string filePath);
+	void loadFromString(std::string_view xmlContent);
+
+	// NOTE: Preloaded files are read by loadFromFile() instead of the disk.
+	//       They're guarded by mutex, because scenes are prefetched on other threads.
+	static void preloadFile(const std::string& filePath, std::string content);
+	static void clearPreloadedFiles();
 
 	Xml getChild(const std::string& name) const;
 	std::vector<Xml> getChildren(const std::string& name) const;
@@ -29,6 +38,7 @@ public:
 	sf::Vector2f toVector2f() const;
 
 private:
+	void loadFromBytes(std::string_view content, const std::string& sourceName);
 	bool isSelfClosingTag(std::size_t openingTagEndPosition) const;
 	bool isClosingTag(std::size_t tagNamePosition) const;
 	bool isEmptyAttributeValue(std::size_t onePositionAfterAttributeValueOpeningQuote) const;
@@ -36,6 +46,8 @@ private:
 
 private:
 	inline static const std::string whitespaceCharacters = " \n\t\v\f\r";
+	inline static std::unordered_map<std::string, std::string> sPreloadedFiles;
+	inline static std::mutex sPreloadedFilesMutex;
 	std::string mContent;
 };
 
@@ -8,10 +8,18 @@
 #include "Renderer/renderer.hpp"
 #include <SFML/System.hpp>
 
+namespace {
+	std::chrono::nanoseconds elapsedSince(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+	}
+}
+
 namespace ph {
 
-Game::Game()
-	:mWindow(sf::VideoMode::getDesktopMode(), "PopHead", sf::Style::Fullscreen, sf::ContextSettings(24, 8, 0, 3, 3))
+Game::Game(bool isHeadless)
+	:mWindow(isHeadless ? sf::VideoMode(1280, 720) : sf::VideoMode::getDesktopMode(), "PopHead",
+	         isHeadless ? sf::Style::None : sf::Style::Fullscreen, sf::ContextSettings(24, 8, 0, 3, 3))
 	,mGameData()
 	,mSoundPlayer(std::make_unique<SoundPlayer>())
 	,mMusicPlayer(std::make_unique<MusicPlayer>())
@@ -35,10 +43,15 @@ Game::Game()
 		mGui.get()
 	));
 
-	Renderer::init(sf::VideoMode::getDesktopMode().width, sf::VideoMode::getDesktopMode().height);
+	if(isHeadless)
+		mWindow.setVisible(false);
+
+	Renderer::init(mWindow.getSize().x, mWindow.getSize().y);
 	
 	GameData* gameData = mGameData.get();
 
+	mTextures->setMemoryBudget(256 * 1024 * 1024);
+
 	loadFonts(gameData);
 	mTerminal->init(gameData);
 	mDebugCounter->init(*mFonts);
@@ -46,7 +59,7 @@ Game::Game()
 	mSceneManager->setGameData(gameData);
 	mSceneManager->replaceScene("scenes/mainMenu.xml");
 
-	mWindow.setVerticalSyncEnabled(true);
+	mWindow.setVerticalSyncEnabled(!isHeadless);
 	mWindow.setKeyRepeatEnabled(false);
 
 	ActionEventManager::init();
@@ -55,18 +68,128 @@ Game::Game()
 void Game::run()
 {
 	sf::Clock clock;
+	FixedTimestep& fixedTimestep = mGameData->getFixedTimestep();
 	while(mGameData->getGameCloser().shouldGameBeClosed() == false)
 	{
-		mSceneManager->changingScenesProcess();
+		if(mSceneManager->changingScenesProcess() && mReplayRecorder)
+			mReplayRecorder->start(makeReplayHeader());
 		handleEvents();
-		const sf::Time dt = clock.restart();
-		update(correctDeltaTime(dt));
+
+		// NOTE: Simulation runs in steps of constant length, rendering interpolates between the last two steps
+		const sf::Time frameTime = correctDeltaTime(clock.restart());
+		const unsigned numberOfSteps = fixedTimestep.addFrameTime(frameTime);
+		for(unsigned i = 0; i < numberOfSteps; ++i)
+			update(fixedTimestep.getSimulationStep());
+		if(mReplayRecorder)
+			mReplayRecorder->endFrame();
+		render(frameTime, fixedTimestep.getInterpolation());
 	}
 
 	Renderer::shutDown();
 	mWindow.close();
 }
 
+void Game::runBenchmark(const BenchmarkSettings& settings)
+{
+	mSceneManager->setSeedForNextScene(settings.seed);
+	mSceneManager->replaceScene(settings.scenePath);
+	mSceneManager->changingScenesProcess();
+
+	Scene& scene = mSceneManager->getScene();
+	spawnBenchmarkZombies(scene.getRegistry(), mSceneManager->getEntitiesTemplateStorage(), settings.zombies, settings.zombiesSpawnRadius);
+
+	SystemsQueue& systemsQueue = scene.getSystemsQueue();
+	systemsQueue.setTimingsEnabled(true);
+
+	const sf::Time step = mGameData->getFixedTimestep().getSimulationStep();
+	FrameTimings frameTimings;
+	frameTimings.frameTimes.reserve(settings.frames);
+	for(unsigned frame = 0; frame < settings.frames; ++frame)
+	{
+		const auto frameStart = std::chrono::steady_clock::now();
+		updateMeasured(step, frameTimings);
+		renderMeasured(frameTimings);
+		frameTimings.frameTimes.emplace_back(elapsedSince(frameStart));
+	}
+
+	writeBenchmarkResults(settings, step.asSeconds(), std::move(frameTimings), systemsQueue.getTimings());
+
+	Renderer::shutDown();
+	mWindow.close();
+}
+
+void Game::runReplay(const ReplaySettings& settings)
+{
+	ReplayPlayer replay;
+	if(!replay.open(settings.filePath))
+		PH_EXIT_GAME("Replay " + settings.filePath + " couldn't be played");
+
+	const ReplayHeader& header = replay.getHeader();
+	mSceneManager->setSeedForNextScene(header.seed);
+	mSceneManager->replaceScene(header.scenePath);
+	mSceneManager->changingScenesProcess();
+
+	Scene& scene = mSceneManager->getScene();
+	if(header.hasPlayer && mAIManager->isPlayerOnScene()) {
+		scene.setPlayerStatus(header.playerStatus);
+		scene.setPlayerPosition(header.playerPosition);
+	}
+
+	SystemsQueue& systemsQueue = scene.getSystemsQueue();
+	systemsQueue.setTimingsEnabled(true);
+
+	// NOTE: Scene changes aren't processed, because recording restarts on every new scene
+	FrameTimings frameTimings;
+	ReplayFrame frame;
+	while(replay.readFrame(frame) && !mGameData->getGameCloser().shouldGameBeClosed())
+	{
+		if(!settings.isHeadless) {
+			sf::Event event;
+			while(mWindow.pollEvent(event))
+				if(event.type == sf::Event::Closed)
+					mGameData->getGameCloser().closeGame();
+		}
+
+		const auto frameStart = std::chrono::steady_clock::now();
+		for(const auto& actionEvent : frame.actionEvents)
+			mSceneManager->handleEvent(actionEvent);
+		for(const auto& step : frame.steps) {
+			ActionEventManager::setPressedActions(step.pressedActions);
+			updateMeasured(sf::seconds(step.simulationStep), frameTimings);
+		}
+		renderMeasured(frameTimings);
+		frameTimings.frameTimes.emplace_back(elapsedSince(frameStart));
+
+		if(!settings.isHeadless)
+			mWindow.display();
+	}
+
+	BenchmarkSettings results;
+	results.scenePath = header.scenePath;
+	results.resultsPath = settings.resultsPath;
+	results.seed = header.seed;
+	writeBenchmarkResults(results, header.simulationStep, std::move(frameTimings), systemsQueue.getTimings());
+
+	Renderer::shutDown();
+	mWindow.close();
+}
+
+void Game::updateMeasured(sf::Time step, FrameTimings& frameTimings)
+{
+	mSceneManager->update(step);
+	const auto aiStart = std::chrono::steady_clock::now();
+	mAIManager->update();
+	frameTimings.aiManager.update.add(elapsedSince(aiStart));
+}
+
+void Game::renderMeasured(FrameTimings& frameTimings)
+{
+	mSceneManager->render(1.f);
+	const auto rendererStart = std::chrono::steady_clock::now();
+	Renderer::endScene(mWindow, *mDebugCounter);
+	frameTimings.renderer.render.add(elapsedSince(rendererStart));
+}
+
 sf::Time Game::correctDeltaTime(sf::Time dt)
 {
 	const sf::Time dtMinimalConstrain = sf::seconds(1.f/20.f);
@@ -87,8 +210,11 @@ void Game::handleEvents()
 		mTerminal->handleEvent(phEvent);
 		mGui->handleEvent(phEvent);
 		
-		if(!mTerminal->getSharedData()->mIsVisible)
+		if(!mTerminal->getSharedData()->mIsVisible) {
 			mSceneManager->handleEvent(phEvent);
+			if(auto* actionEvent = std::get_if<ActionEvent>(&phEvent); actionEvent && mReplayRecorder)
+				mReplayRecorder->recordActionEvent(*actionEvent);
+		}
 
 		if(auto* sfEvent = std::get_if<sf::Event>(&phEvent))
 			if(sfEvent->type == sf::Event::Resized)
@@ -96,15 +222,49 @@ void Game::handleEvents()
 	}
 }
 
-void Game::update(sf::Time dt)
+void Game::startRecordingReplays(const std::string& filePath)
 {
-	mDebugCounter->update();
+	mReplayRecorder = std::make_unique<ReplayRecorder>(filePath);
+}
 
+ReplayHeader Game::makeReplayHeader()
+{
+	ReplayHeader header;
+	header.scenePath = mSceneManager->getCurrentMapName();
+	header.seed = mSceneManager->getCurrentSceneSeed();
+	header.simulationStep = mGameData->getFixedTimestep().getSimulationStep().asSeconds();
+	header.hasPlayer = mAIManager->isPlayerOnScene();
+	if(header.hasPlayer) {
+		header.playerStatus = mSceneManager->getScene().getPlayerStatus();
+		header.playerPosition = mSceneManager->getScene().getPlayerPosition();
+	}
+	return header;
+}
+
+void Game::update(sf::Time step)
+{
 	if(mWindow.hasFocus())
 	{
-		mSceneManager->update(dt);
+		ActionEventManager::updatePressedActions();
+		if(mReplayRecorder)
+			mReplayRecorder->recordStep(ActionEventManager::getPressedActions(), step.asSeconds());
+
+		mSceneManager->update(step);
 		mAIManager->update();
-		mGui->update(dt);
+	}
+}
+
+void Game::render(sf::Time frameTime, float interpolation)
+{
+	mDebugCounter->update();
+	mMusicPlayer->update(frameTime.asSeconds());
+
+	if(mWindow.hasFocus())
+	{
+		mSceneManager->render(interpolation);
+		mSoundPlayer->update();
+		mDebugCounter->setEntityPoolsStats(mSceneManager->getEntitiesTemplateStorage().getPoolsStats());
+		mGui->update(frameTime);
 		mDebugCounter->draw();
 		mTerminal->update();
 
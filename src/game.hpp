@@ -5,9 +5,11 @@
 #include "Audio/Sound/soundPlayer.hpp"
 #include "AI/aiManager.hpp"
 #include "Scenes/sceneManager.hpp"
-#include "Resources/resourceHolder.hpp"
+#include "Resources/textureHolder.hpp"
 #include "Terminal/terminal.hpp"
 #include "DebugCounter/debugCounter.hpp"
+#include "Benchmark/benchmark.hpp"
+#include "Replay/replay.hpp"
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <memory>
 
@@ -16,16 +18,27 @@ namespace ph {
 class Game
 {
 public:
-	Game();
+	// NOTE: Headless game opens hidden window, it's used only as offscreen OpenGL context
+	explicit Game(bool isHeadless = false);
 
 	void run();
+	void runBenchmark(const BenchmarkSettings&);
+	void runReplay(const ReplaySettings&);
+
+	// NOTE: Replay of every scene loaded from now on is recorded to this file
+	void startRecordingReplays(const std::string& filePath);
 	inline auto getGameData() const -> const GameData & { return *(mGameData); };
 	Terminal* getTerminal() { return mTerminal.get(); }
 
 private:
 	sf::Time correctDeltaTime(sf::Time dt);
 	void handleEvents();
-	void update(sf::Time dt);
+	void update(sf::Time step);
+	void render(sf::Time frameTime, float interpolation);
+
+	void updateMeasured(sf::Time step, FrameTimings&);
+	void renderMeasured(FrameTimings&);
+	ReplayHeader makeReplayHeader();
 
 private:
 	sf::RenderWindow               mWindow;
@@ -39,6 +52,7 @@ private:
 	std::unique_ptr<Terminal>      mTerminal;
 	std::unique_ptr<DebugCounter>  mDebugCounter;
 	std::unique_ptr<GUI>           mGui;
+	std::unique_ptr<ReplayRecorder> mReplayRecorder;
 };
 
 }
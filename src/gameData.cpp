@@ -1,4 +1,6 @@
 #include "gameData.hpp"
+#include "Logs/logs.hpp"
+#include <algorithm>
 
 namespace ph {
 
@@ -12,4 +14,23 @@ bool GameCloser::shouldGameBeClosed()
 	return mShouldGameBeClosed;
 }
 
+void FixedTimestep::setSimulationRate(float stepsPerSecond)
+{
+	PH_ASSERT_UNEXPECTED_SITUATION(stepsPerSecond > 0.f, "Simulation rate has to be greater than zero!");
+	mSimulationStep = sf::seconds(1.f / stepsPerSecond);
+}
+
+unsigned FixedTimestep::addFrameTime(sf::Time frameTime)
+{
+	mAccumulatedTime += frameTime;
+	unsigned numberOfSteps = 0;
+	while(mAccumulatedTime >= mSimulationStep) {
+		mAccumulatedTime -= mSimulationStep;
+		++numberOfSteps;
+	}
+
+	// NOTE: Steps which don't fit are dropped, otherwise slow frame would make the next frames even slower
+	return std::min(numberOfSteps, maxStepsPerFrame);
+}
+
 }
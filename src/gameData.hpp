@@ -4,10 +4,11 @@
 #include "Audio/Sound/soundPlayer.hpp"
 #include "AI/aiManager.hpp"
 #include "Scenes/sceneManager.hpp"
-#include "Resources/resourceHolder.hpp"
+#include "Resources/textureHolder.hpp"
 #include "Terminal/terminal.hpp"
 #include "GUI/gui.hpp"
 #include <SFML/Window/Window.hpp>
+#include <SFML/System/Time.hpp>
 #include <memory>
 
 namespace ph {
@@ -22,6 +23,25 @@ private:
 	bool mShouldGameBeClosed = false;
 };
 
+class FixedTimestep
+{
+public:
+	void setSimulationRate(float stepsPerSecond);
+	sf::Time getSimulationStep() const { return mSimulationStep; }
+
+	// NOTE: Returns how many simulation steps have to be run for the frame, time which doesn't fill whole step is kept for the next frame
+	unsigned addFrameTime(sf::Time frameTime);
+
+	// NOTE: Part of simulation step which passed since the last step
+	float getInterpolation() const { return mAccumulatedTime / mSimulationStep; }
+
+	static constexpr unsigned maxStepsPerFrame = 8;
+
+private:
+	sf::Time mSimulationStep = sf::seconds(1.f / 60.f);
+	sf::Time mAccumulatedTime = sf::Time::Zero;
+};
+
 /// GameData is holder for observer pointers to Game Modules.
 
 class GameData
@@ -52,6 +72,7 @@ public:
 		,mTerminal{Terminal}
 		,mGui(Gui)
 		,mGameCloser()
+		,mFixedTimestep()
 	{
 	}
 	
@@ -65,6 +86,7 @@ public:
 	auto getTerminal() const -> Terminal& { return *mTerminal; }
 	auto getGui() const -> GUI& { return *mGui; }
 	auto getGameCloser() -> GameCloser& { return mGameCloser; }
+	auto getFixedTimestep() -> FixedTimestep& { return mFixedTimestep; }
 
 private:
 	sf::Window* const mWindow;
@@ -77,6 +99,7 @@ private:
 	Terminal* const mTerminal;
 	GUI* const mGui;
 	GameCloser mGameCloser;
+	FixedTimestep mFixedTimestep;
 };
 
 }
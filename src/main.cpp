@@ -6,16 +6,22 @@
 #include "GUI/guiActionsParserImpl.hpp"
 #include "Utilities/profiling.hpp"
 #include "GUI/messageBox.hpp"
+#include "Resources/resourceFileSystem.hpp"
 #include <stdexcept>
 #include <string>
 
-int main()
+int main(int argc, char** argv)
 {
 	try {
+		const auto benchmarkSettings = ph::parseBenchmarkSettings(argc, argv);
+		const auto replaySettings = ph::parseReplaySettings(argc, argv);
+		const bool isHeadless = benchmarkSettings || (replaySettings && replaySettings->isHeadless);
+
 		PH_BEGIN_PROFILING_SESSION("PopHead initializing", "initProfilingResults.json");
 
 		PH_LOG_INFO("start initializing PopHead");
-		ph::Game game;
+		ph::ResourceFileSystem::mountArchive("resources.pack");
+		ph::Game game(isHeadless);
 
 		ph::XmlGuiParser::setActionsParser(std::make_unique<ph::GuiActionsParserImpl>());
 
@@ -26,8 +32,21 @@ int main()
 		
 		PH_BEGIN_PROFILING_SESSION("PopHead runtime", "runtimeProfilingResults.json");
 
-		PH_LOG_INFO("start executing PopHead");
-		game.run();
+		if(benchmarkSettings) {
+			PH_LOG_INFO("start benchmarking " + benchmarkSettings->scenePath);
+			game.runBenchmark(*benchmarkSettings);
+		}
+		else if(replaySettings && replaySettings->mode == ph::ReplaySettings::Play) {
+			PH_LOG_INFO("start playing replay " + replaySettings->filePath);
+			game.runReplay(*replaySettings);
+		}
+		else {
+			if(replaySettings)
+				game.startRecordingReplays(replaySettings->filePath);
+
+			PH_LOG_INFO("start executing PopHead");
+			game.run();
+		}
 
 		PH_END_PROFILING_SESSION();
 	}
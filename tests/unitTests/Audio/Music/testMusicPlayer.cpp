@@ -0,0 +1,90 @@
+#include <catch.hpp>
+
+#include "Audio/Music/musicPlayer.hpp"
+#include <chrono>
+#include <thread>
+
+namespace ph {
+
+namespace {
+	const std::string menuTheme = "music/Menu.ogg";
+	const std::string explorationTheme = "music/explorationTheme.ogg";
+	const std::string fightTheme = "music/zombieAttack.ogg";
+
+	// NOTE: Themes are opened on other thread, so player is updated until the theme starts playing
+	void waitUntilThemeIsPlayed(MusicPlayer& musicPlayer, const std::string& theme)
+	{
+		for(int i = 0; i < 500 && musicPlayer.getCurrentTheme() != theme; ++i) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			musicPlayer.update(0.f);
+		}
+		REQUIRE(musicPlayer.getCurrentTheme() == theme);
+	}
+
+	void addMusicState(MusicPlayer& musicPlayer, const std::string& stateName, const std::string& theme)
+	{
+		MusicState state;
+		state.filepaths.emplace_back(theme);
+		state.volumeMultipliers.emplace_back(1.f);
+		state.crossfadeTime = 2.f;
+		musicPlayer.getMusicStateMachine().addState(stateName, state);
+	}
+}
+
+TEST_CASE("Least recently used theme which isn't played is evicted from cache", "[Audio][MusicPlayer]")
+{
+	MusicPlayer musicPlayer(2);
+
+	musicPlayer.playFromFile(menuTheme);
+	waitUntilThemeIsPlayed(musicPlayer, menuTheme);
+	musicPlayer.playFromFile(explorationTheme);
+	waitUntilThemeIsPlayed(musicPlayer, explorationTheme);
+	musicPlayer.playFromFile(fightTheme);
+	waitUntilThemeIsPlayed(musicPlayer, fightTheme);
+
+	CHECK_FALSE(musicPlayer.isCached(menuTheme));
+	CHECK(musicPlayer.isCached(explorationTheme));
+	CHECK(musicPlayer.isCached(fightTheme));
+
+	SECTION("Playing cached theme makes it the most recently used one") {
+		musicPlayer.playFromFile(explorationTheme);
+		CHECK(musicPlayer.getCurrentTheme() == explorationTheme);
+
+		musicPlayer.prefetch(menuTheme);
+		for(int i = 0; i < 500 && !musicPlayer.isCached(menuTheme); ++i) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			musicPlayer.update(0.f);
+		}
+
+		CHECK(musicPlayer.isCached(menuTheme));
+		CHECK(musicPlayer.isCached(explorationTheme));
+		CHECK_FALSE(musicPlayer.isCached(fightTheme));
+	}
+}
+
+TEST_CASE("Theme which is fading out fades in again from its current volume", "[Audio][MusicPlayer]")
+{
+	MusicPlayer musicPlayer;
+	addMusicState(musicPlayer, "exploration", explorationTheme);
+	addMusicState(musicPlayer, "fight", fightTheme);
+
+	musicPlayer.playFromMusicState("exploration");
+	waitUntilThemeIsPlayed(musicPlayer, explorationTheme);
+	musicPlayer.update(2.f);
+	REQUIRE(musicPlayer.getCrossfadeProgress() == 1.f);
+
+	musicPlayer.playFromMusicState("fight");
+	waitUntilThemeIsPlayed(musicPlayer, fightTheme);
+	musicPlayer.update(.5f);
+	REQUIRE(musicPlayer.getCrossfadeProgress() == Approx(.25f));
+
+	musicPlayer.playFromMusicState("exploration");
+	CHECK(musicPlayer.getCurrentTheme() == explorationTheme);
+	CHECK(musicPlayer.getCrossfadeProgress() == Approx(.75f));
+
+	musicPlayer.update(.5f);
+	CHECK(musicPlayer.getCrossfadeProgress() == 1.f);
+	CHECK(musicPlayer.getCurrentTheme() == explorationTheme);
+}
+
+}
@@ -1,6 +1,6 @@
 #include <catch.hpp>
 
-#include "Audio/Sound/Spatialization/spatializationManager.hpp"
+#include "Audio/Sound/spatializationManager.hpp"
 
 namespace ph {
 
@@ -34,4 +34,37 @@ TEST_CASE("Spatialization is properly computed", "[Audio][SpatializationManager]
 	}
 }
 
-}
\ No newline at end of file
+TEST_CASE("Spatial sources are mixed for listener position", "[Audio][SpatializationManager]")
+{
+	SpatializationManager spatializationManager;
+	SoundData soundData(1.f, false, 100.f, 300.f);
+	spatializationManager.setListenerPosition(sf::Vector2f(0.f, 0.f));
+
+	spatializationManager.setSource(0, soundData, sf::Vector2f(50.f, 0.f));
+	spatializationManager.setSource(1, soundData, sf::Vector2f(-200.f, 0.f));
+	spatializationManager.setSource(2, soundData, sf::Vector2f(0.f, 500.f));
+	spatializationManager.update(20.f);
+
+	CHECK(spatializationManager.getVolume(0) == Approx(20.f));
+	CHECK(spatializationManager.getVolume(1) == Approx(10.f));
+	CHECK(spatializationManager.getVolume(2) == 0.f);
+	CHECK(spatializationManager.getPan(0) > 0.f);
+	CHECK(spatializationManager.getPan(1) < 0.f);
+
+	SECTION("Moved source is mixed for its new position")
+	{
+		spatializationManager.setSourcePosition(2, sf::Vector2f(0.f, 200.f));
+		spatializationManager.update(20.f);
+		CHECK(spatializationManager.getVolume(2) == Approx(10.f));
+	}
+
+	SECTION("Removed source is silent")
+	{
+		spatializationManager.removeSource(0);
+		spatializationManager.update(20.f);
+		CHECK(spatializationManager.isSource(0) == false);
+		CHECK(spatializationManager.getVolume(0) == 0.f);
+	}
+}
+
+}
@@ -21,6 +21,54 @@ TEST_CASE("Spatial sound can be played", "[Audio][SoundPlayer]")
 	CHECK_NOTHROW(soundPlayer.playSpatialSound("sounds/zombieGrowl1.ogg", soundPosition));
 }
 
+TEST_CASE("Sound which can't be heard doesn't take a voice", "[Audio][SoundPlayer]")
+{
+	SoundPlayer soundPlayer;
+	soundPlayer.setListenerPosition(sf::Vector2f(0.f, 0.f));
+
+	soundPlayer.playSpatialSound("sounds/zombieGrowl1.ogg", sf::Vector2f(5000.f, 5000.f));
+	soundPlayer.update();
+
+	CHECK(soundPlayer.getNumberOfPlayingSounds() == 0);
+}
+
+TEST_CASE("Voice is stolen only by more important sound when every voice is busy", "[Audio][SoundPlayer]")
+{
+	SoundPlayer soundPlayer;
+
+	// NOTE: The same sound is played once per frame, so voices are filled during many frames
+	for(std::size_t i = 0; i < SoundPlayer::maxVoices / 2; ++i) {
+		soundPlayer.playAmbientSound("sounds/zombieGrowl1.ogg");
+		soundPlayer.playAmbientSound("sounds/zombieGrowl2.ogg");
+		soundPlayer.update();
+	}
+	REQUIRE(soundPlayer.getNumberOfPlayingSounds() == SoundPlayer::maxVoices);
+
+	SECTION("Sound of higher priority steals a voice") {
+		soundPlayer.playAmbientSound("sounds/pistolShot.ogg");
+		soundPlayer.update();
+
+		CHECK(soundPlayer.getNumberOfPlayingSounds("sounds/pistolShot.ogg") == 1);
+		CHECK(soundPlayer.getNumberOfPlayingSounds() == SoundPlayer::maxVoices);
+	}
+
+	SECTION("Sound of the same priority and volume is dropped") {
+		soundPlayer.playAmbientSound("sounds/zombieGrowl1.ogg");
+		soundPlayer.update();
+
+		CHECK(soundPlayer.getNumberOfPlayingSounds("sounds/zombieGrowl1.ogg") == SoundPlayer::maxVoices / 2);
+		CHECK(soundPlayer.getNumberOfPlayingSounds("sounds/zombieGrowl2.ogg") == SoundPlayer::maxVoices / 2);
+	}
+
+	SECTION("Quieter sound of the same priority is dropped") {
+		soundPlayer.playAmbientSound("sounds/zombieGrowl3.ogg");
+		soundPlayer.update();
+
+		CHECK(soundPlayer.getNumberOfPlayingSounds("sounds/zombieGrowl3.ogg") == 0);
+		CHECK(soundPlayer.getNumberOfPlayingSounds() == SoundPlayer::maxVoices);
+	}
+}
+
 TEST_CASE("Mute is set and can be read", "[Audio][SoundPlayer]")
 {
 	SoundPlayer soundPlayer;
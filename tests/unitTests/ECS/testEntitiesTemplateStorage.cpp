@@ -0,0 +1,131 @@
+#include <catch.hpp>
+
+#include "ECS/entitiesTemplateStorage.hpp"
+#include "ECS/Components/physicsComponents.hpp"
+#include "ECS/Components/charactersComponents.hpp"
+#include "ECS/Components/particleComponents.hpp"
+
+namespace ph {
+
+namespace {
+	void createBoxTemplate(EntitiesTemplateStorage& storage)
+	{
+		auto box = storage.create("Box");
+		auto& templates = storage.getTemplateRegistry();
+		templates.assign<component::BodyRect>(box, FloatRect(0.f, 0.f, 20.f, 10.f));
+		templates.assign<component::Health>(box, 50, 100);
+		templates.assign<component::Killable>(box);
+	}
+}
+
+TEST_CASE("Prefab is compiled once and spawns copy of its template", "[ECS][EntitiesTemplateStorage]")
+{
+	EntitiesTemplateStorage storage;
+	createBoxTemplate(storage);
+	entt::registry registry;
+
+	auto prefab = storage.getPrefab("Box");
+	CHECK(storage.getPrefab("Box") == prefab);
+
+	auto entity = storage.spawn(prefab, registry);
+	REQUIRE(registry.valid(entity));
+	const auto& rect = registry.get<component::BodyRect>(entity).rect;
+	CHECK(rect.getTopLeft() == sf::Vector2f(0.f, 0.f));
+	CHECK(rect.getSize() == sf::Vector2f(20.f, 10.f));
+	CHECK(registry.get<component::Health>(entity).healthPoints == 50);
+	CHECK(registry.get<component::Health>(entity).maxHealthPoints == 100);
+	CHECK(registry.has<component::Killable>(entity));
+	CHECK_FALSE(registry.has<component::Velocity>(entity));
+	CHECK_FALSE(registry.has<component::PrefabInstance>(entity));
+
+	SECTION("Spawned entity doesn't share components with template") {
+		registry.get<component::Health>(entity).healthPoints = 1;
+		auto secondEntity = storage.spawn(prefab, registry);
+		CHECK(registry.get<component::Health>(secondEntity).healthPoints == 50);
+	}
+
+	SECTION("Entity of not pooled prefab isn't released") {
+		CHECK_FALSE(storage.release(entity, registry));
+		CHECK(registry.valid(entity));
+	}
+}
+
+TEST_CASE("Batch spawn creates requested amount of entities and runs initializer on each of them", "[ECS][EntitiesTemplateStorage]")
+{
+	EntitiesTemplateStorage storage;
+	createBoxTemplate(storage);
+	entt::registry registry;
+
+	auto prefab = storage.getPrefab("Box");
+	storage.reserve(prefab, 5, registry);
+	storage.spawn(prefab, 5, registry, [&registry](entt::entity entity, std::size_t index) {
+		registry.get<component::BodyRect>(entity).rect.left = static_cast<float>(index) * 30.f;
+	});
+
+	auto view = registry.view<component::BodyRect, component::Health, component::Killable>();
+	REQUIRE(view.size() == 5);
+
+	float sumOfPositions = 0.f;
+	for(auto entity : view) {
+		const auto& rect = registry.get<component::BodyRect>(entity).rect;
+		CHECK(rect.getSize() == sf::Vector2f(20.f, 10.f));
+		sumOfPositions += rect.left;
+	}
+	CHECK(sumOfPositions == 0.f + 30.f + 60.f + 90.f + 120.f);
+	CHECK(storage.getPoolsStats().createdEntities == 0);
+}
+
+TEST_CASE("Released entity of pooled prefab is reused by the next spawn", "[ECS][EntitiesTemplateStorage]")
+{
+	EntitiesTemplateStorage storage;
+	auto zombie = storage.create("Zombie");
+	storage.setPooled("Zombie");
+	auto& templates = storage.getTemplateRegistry();
+	templates.assign<component::BodyRect>(zombie, FloatRect(0.f, 0.f, 20.f, 20.f));
+	templates.assign<component::Health>(zombie, 100, 100);
+	templates.assign<component::Killable>(zombie);
+	component::MultiParticleEmitter bloodEmitters;
+	bloodEmitters.particleEmitters.emplace_back();
+	templates.assign<component::MultiParticleEmitter>(zombie, bloodEmitters);
+	entt::registry registry;
+
+	auto prefab = storage.getPrefab("Zombie");
+	auto entity = storage.spawn(prefab, registry);
+	REQUIRE(registry.has<component::PrefabInstance>(entity));
+	CHECK(storage.getPoolsStats().createdEntities == 1);
+
+	registry.get<component::Health>(entity).healthPoints = 10;
+	registry.assign<component::DamageTag>(entity, 30);
+	registry.assign<component::PreviousBodyPosition>(entity, sf::Vector2f(5.f, 5.f));
+	auto& emitters = registry.get<component::MultiParticleEmitter>(entity).particleEmitters;
+	emitters.front().particles.resize(64);
+	const auto* emittersStorage = emitters.data();
+	const auto particlesCapacity = emitters.front().particles.capacity();
+
+	REQUIRE(storage.release(entity, registry));
+	CHECK_FALSE(registry.valid(entity));
+	CHECK(storage.getPoolsStats().inactiveEntities == 1);
+	CHECK(registry.view<component::BodyRect>().empty());
+	CHECK(registry.view<component::MultiParticleEmitter>().empty());
+	CHECK(registry.view<component::PreviousBodyPosition>().empty());
+
+	auto respawnedEntity = storage.spawn(prefab, registry);
+	CHECK(registry.get<component::Health>(respawnedEntity).healthPoints == 100);
+	CHECK(registry.has<component::Killable>(respawnedEntity));
+	CHECK(registry.has<component::PrefabInstance>(respawnedEntity));
+	CHECK_FALSE(registry.has<component::DamageTag>(respawnedEntity));
+	CHECK_FALSE(registry.has<component::PreviousBodyPosition>(respawnedEntity));
+
+	const auto& respawnedEmitters = registry.get<component::MultiParticleEmitter>(respawnedEntity).particleEmitters;
+	REQUIRE(respawnedEmitters.size() == 1);
+	CHECK(respawnedEmitters.data() == emittersStorage);
+	CHECK(respawnedEmitters.front().particles.empty());
+	CHECK(respawnedEmitters.front().particles.capacity() == particlesCapacity);
+
+	const auto& stats = storage.getPoolsStats();
+	CHECK(stats.createdEntities == 1);
+	CHECK(stats.reusedEntities == 1);
+	CHECK(stats.inactiveEntities == 0);
+}
+
+}
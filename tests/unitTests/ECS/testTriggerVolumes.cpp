@@ -0,0 +1,90 @@
+#include <catch.hpp>
+
+#include "ECS/Systems/triggerVolumes.hpp"
+#include "ECS/Components/physicsComponents.hpp"
+#include "ECS/Components/objectsComponents.hpp"
+
+namespace ph {
+
+namespace {
+	auto getPushingAreaEvents(entt::registry& registry) -> const std::vector<TriggerEvent>&
+	{
+		return registry.ctx<TriggerEvents>().get(TriggerKind::PushingArea);
+	}
+
+	void moveBody(entt::registry& registry, entt::entity body, float x, float y)
+	{
+		auto& rect = registry.get<component::BodyRect>(body).rect;
+		rect.left = x;
+		rect.top = y;
+	}
+}
+
+TEST_CASE("Body moving through trigger volume produces enter, stay and exit events", "[ECS][TriggerVolumes]")
+{
+	entt::registry registry;
+	system::TriggerVolumes triggerVolumes(registry);
+
+	auto area = registry.create();
+	registry.assign<component::PushingArea>(area, sf::Vector2f(10.f, 0.f));
+	registry.assign<component::BodyRect>(area, FloatRect(0.f, 0.f, 100.f, 100.f));
+
+	auto body = registry.create();
+	registry.assign<component::BodyRect>(body, FloatRect(200.f, 200.f, 10.f, 10.f));
+	registry.assign<component::Velocity>(body, 0.f, 0.f);
+
+	triggerVolumes.update(0.f);
+	CHECK(getPushingAreaEvents(registry).empty());
+	REQUIRE(registry.has<component::TriggerVolume>(area));
+	CHECK(registry.get<component::TriggerVolume>(area).kind == TriggerKind::PushingArea);
+
+	SECTION("Entering volume")
+	{
+		moveBody(registry, body, 40.f, 40.f);
+		triggerVolumes.update(0.f);
+		const auto& events = getPushingAreaEvents(registry);
+		REQUIRE(events.size() == 1);
+		CHECK(events[0].trigger == area);
+		CHECK(events[0].activator == body);
+		CHECK(events[0].phase == TriggerPhase::Enter);
+
+		SECTION("Staying inside volume")
+		{
+			moveBody(registry, body, 60.f, 50.f);
+			triggerVolumes.update(0.f);
+			REQUIRE(getPushingAreaEvents(registry).size() == 1);
+			CHECK(getPushingAreaEvents(registry)[0].phase == TriggerPhase::Stay);
+
+			SECTION("Leaving volume")
+			{
+				moveBody(registry, body, 300.f, 50.f);
+				triggerVolumes.update(0.f);
+				REQUIRE(getPushingAreaEvents(registry).size() == 1);
+				CHECK(getPushingAreaEvents(registry)[0].trigger == area);
+				CHECK(getPushingAreaEvents(registry)[0].activator == body);
+				CHECK(getPushingAreaEvents(registry)[0].phase == TriggerPhase::Exit);
+
+				triggerVolumes.update(0.f);
+				CHECK(getPushingAreaEvents(registry).empty());
+			}
+		}
+	}
+
+	SECTION("Body which only touches volume doesn't activate it, because its center is outside")
+	{
+		moveBody(registry, body, 95.f, 40.f);
+		triggerVolumes.update(0.f);
+		CHECK(getPushingAreaEvents(registry).empty());
+	}
+
+	SECTION("Moved volume is found in its new cells of spatial hash grid")
+	{
+		registry.get<component::BodyRect>(area).rect = FloatRect(1000.f, 1000.f, 100.f, 100.f);
+		moveBody(registry, body, 1040.f, 1040.f);
+		triggerVolumes.update(0.f);
+		REQUIRE(getPushingAreaEvents(registry).size() == 1);
+		CHECK(getPushingAreaEvents(registry)[0].phase == TriggerPhase::Enter);
+	}
+}
+
+}
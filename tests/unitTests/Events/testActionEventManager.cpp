@@ -0,0 +1,88 @@
+#include "catch.hpp"
+
+#include "Events/actionEventManager.hpp"
+
+namespace ph {
+
+namespace {
+	sf::Event makeKeyEvent(sf::Event::EventType type, sf::Keyboard::Key key)
+	{
+		sf::Event event;
+		event.type = type;
+		event.key.code = key;
+		return event;
+	}
+}
+
+TEST_CASE("Action event ring keeps order and capacity", "[Events][ActionEventManager]")
+{
+	ActionEventRing ring;
+	for(unsigned i = 0; i < ActionEventRing::capacity; ++i)
+		CHECK(ring.push(ActionEvent(ActionID(i % maxNumberOfActions), ActionEvent::Pressed)));
+	CHECK_FALSE(ring.push(ActionEvent(Actions::Use, ActionEvent::Pressed)));
+
+	ActionEvent event;
+	REQUIRE(ring.pop(event));
+	CHECK(event.mAction == 0);
+	REQUIRE(ring.pop(event));
+	CHECK(event.mAction == 1);
+	CHECK(ring.getSize() == ActionEventRing::capacity - 2);
+}
+
+TEST_CASE("Key events are translated into action events", "[Events][ActionEventManager]")
+{
+	ActionEventManager::clearAllActions();
+	ActionEventManager::addAction("use", sf::Keyboard::E);
+	ActionEventManager::addAction("gunAttack", {sf::Keyboard::Enter, sf::Keyboard::E});
+	ActionEventManager::addAction("testAction", sf::Keyboard::T);
+
+	const ActionID testAction = ActionEventManager::getActionID("testAction");
+	CHECK(testAction >= Actions::NumberOfBuiltInActions);
+	CHECK(ActionEventManager::getActionID("gunAttack") == Actions::GunAttack);
+	CHECK(ActionEventManager::getActionID("notExistingAction") == invalidActionID);
+
+	ActionEventRing ring;
+	ActionEvent event;
+
+	SECTION("one key can trigger multiple actions") {
+		ActionEventManager::addActionEventsTo(ring, makeKeyEvent(sf::Event::KeyPressed, sf::Keyboard::E));
+		REQUIRE(ring.getSize() == 2);
+		ring.pop(event);
+		CHECK(event.mAction == Actions::Use);
+		CHECK(event.mType == ActionEvent::Pressed);
+		ring.pop(event);
+		CHECK(event.mAction == Actions::GunAttack);
+	}
+	SECTION("disabled actions don't generate events") {
+		ActionEventManager::setActionEnabled(Actions::Use, false);
+		ActionEventManager::addActionEventsTo(ring, makeKeyEvent(sf::Event::KeyReleased, sf::Keyboard::E));
+		REQUIRE(ring.getSize() == 1);
+		ring.pop(event);
+		CHECK(event.mAction == Actions::GunAttack);
+		CHECK(event.mType == ActionEvent::Released);
+	}
+	SECTION("deleted keys don't generate events") {
+		ActionEventManager::deleteKeyFromAction("testAction", sf::Keyboard::T);
+		ActionEventManager::addActionEventsTo(ring, makeKeyEvent(sf::Event::KeyPressed, sf::Keyboard::T));
+		CHECK(ring.isEmpty());
+	}
+
+	ActionEventManager::clearAllActions();
+}
+
+TEST_CASE("Pressed actions can be fed instead of sampling keyboard", "[Events][ActionEventManager]")
+{
+	ActionEventManager::setEnabled(true);
+	ActionEventManager::setPressedActions(makeActionMask(Actions::Use, Actions::MovingLeft));
+	CHECK(ActionEventManager::isActionPressed(Actions::Use));
+	CHECK(ActionEventManager::isActionPressed(Actions::MovingLeft));
+	CHECK_FALSE(ActionEventManager::isActionPressed(Actions::GunAttack));
+
+	ActionEventManager::setEnabled(false);
+	CHECK_FALSE(ActionEventManager::isActionPressed(Actions::Use));
+
+	ActionEventManager::setEnabled(true);
+	ActionEventManager::setPressedActions(0);
+}
+
+}
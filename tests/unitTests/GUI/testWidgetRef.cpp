@@ -0,0 +1,49 @@
+#include <catch.hpp>
+
+#include "GUI/widgetRef.hpp"
+#include "gameData.hpp"
+#include <SFML/Graphics/RenderWindow.hpp>
+
+namespace ph {
+
+TEST_CASE("WidgetRef resolves widget only while it exists in GUI", "[GUI][WidgetRef]")
+{
+	sf::RenderWindow window;
+	GameData gameData(&window, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr);
+	GUI gui;
+	gui.init(&gameData);
+
+	auto* button = new Widget;
+	gui.addInterface("menu")->addWidget("button", button);
+	WidgetRef<Widget> buttonRef(gui, "menu/button");
+	REQUIRE(buttonRef.get() == button);
+	CHECK(buttonRef.getPath() == "menu/button");
+
+	SECTION("Widget added after ref was used is found") {
+		WidgetRef<Widget> laterRef(gui, "menu/later");
+		CHECK_FALSE(laterRef);
+		auto* later = new Widget;
+		gui.getInterface("menu")->addWidget("later", later);
+		CHECK(laterRef.get() == later);
+	}
+
+	SECTION("Ref is invalid after its widget is removed") {
+		gui.deleteInterface("menu");
+		CHECK_FALSE(buttonRef);
+		CHECK(buttonRef.get() == nullptr);
+	}
+
+	SECTION("Ref resolves widget which took path of removed one") {
+		gui.deleteInterface("menu");
+		auto* newButton = new Widget;
+		gui.addInterface("menu")->addWidget("button", newButton);
+		CHECK(buttonRef.get() == newButton);
+	}
+
+	SECTION("Ref is invalid after GUI is cleared") {
+		gui.clearGUI();
+		CHECK_FALSE(buttonRef);
+	}
+}
+
+}
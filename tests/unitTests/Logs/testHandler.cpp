@@ -95,4 +95,20 @@ namespace ph {
 		for (const auto& path : directories)
 			CHECK(handler.isPathAllowed(path));
 	}
+
+	TEST_CASE("Filter decision for path is compiled into allowed log levels", "[Logs][Handler]")
+	{
+		MockHandler handler;
+		handler.setPathFilter("Audio", true);
+		handler.setLogLevelFilter(LogLevel::Warning, true);
+		handler.setLogLevelFilter(LogLevel::Error, true);
+
+		const std::uint8_t allowedLogLevels = handler.getAllowedLogLevels("Audio/musicPlayer.cpp");
+		CHECK(!(allowedLogLevels & logLevelToBit(LogLevel::Info)));
+		CHECK((allowedLogLevels & logLevelToBit(LogLevel::Warning)));
+		CHECK((allowedLogLevels & logLevelToBit(LogLevel::Error)));
+		CHECK(!(allowedLogLevels & logLevelToBit(LogLevel::Critical)));
+
+		CHECK(handler.getAllowedLogLevels("Physics/physicsSystem.cpp") == 0);
+	}
 }
@@ -0,0 +1,113 @@
+#include <catch.hpp>
+
+#include "Logs/logQueue.hpp"
+
+#include <array>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ph {
+
+	TEST_CASE("LogQueue pops records in the order they were pushed", "[Logs][LogQueue]")
+	{
+		LogQueue queue;
+		QueuedLogRecord record;
+		CHECK_FALSE(queue.tryPop(record));
+
+		REQUIRE(queue.tryPush(LogLevel::Info, "first", __FILE__, 1, 10));
+		REQUIRE(queue.tryPush(LogLevel::Error, "second", __FILE__, 2, 20));
+
+		REQUIRE(queue.tryPop(record));
+		CHECK(record.level == LogLevel::Info);
+		CHECK(std::string(record.message, record.messageSize) == "first");
+		CHECK(record.filePath == __FILE__);
+		CHECK(record.fileLine == 1);
+		CHECK(record.nanosecondsFromStart == 10);
+
+		REQUIRE(queue.tryPop(record));
+		CHECK(record.level == LogLevel::Error);
+		CHECK(std::string(record.message, record.messageSize) == "second");
+		CHECK(record.fileLine == 2);
+
+		CHECK_FALSE(queue.tryPop(record));
+	}
+
+	TEST_CASE("LogQueue truncates too long messages", "[Logs][LogQueue]")
+	{
+		LogQueue queue;
+		const std::string longMessage(QueuedLogRecord::maxMessageSize + 10, 'x');
+		REQUIRE(queue.tryPush(LogLevel::Warning, longMessage, __FILE__, 0, 0));
+
+		QueuedLogRecord record;
+		REQUIRE(queue.tryPop(record));
+		CHECK(record.messageSize == QueuedLogRecord::maxMessageSize);
+		CHECK(record.isMessageTruncated);
+	}
+
+	TEST_CASE("Full LogQueue rejects records until one is popped", "[Logs][LogQueue]")
+	{
+		LogQueue queue;
+		for (std::size_t i = 0; i < LogQueue::capacity; ++i)
+			REQUIRE(queue.tryPush(LogLevel::Info, "log", __FILE__, static_cast<unsigned short>(i), 0));
+		CHECK_FALSE(queue.tryPush(LogLevel::Info, "rejected", __FILE__, 0, 0));
+
+		QueuedLogRecord record;
+		REQUIRE(queue.tryPop(record));
+		CHECK(record.fileLine == 0);
+		REQUIRE(queue.tryPush(LogLevel::Info, "accepted", __FILE__, 0, 0));
+
+		std::size_t numberOfPoppedRecords = 0;
+		while (queue.tryPop(record))
+			++numberOfPoppedRecords;
+		CHECK(numberOfPoppedRecords == LogQueue::capacity);
+		CHECK(std::string(record.message, record.messageSize) == "accepted");
+	}
+
+	TEST_CASE("LogQueue keeps every record and order of each producer when many threads push at once", "[Logs][LogQueue]")
+	{
+		constexpr std::size_t numberOfProducers = 4;
+		constexpr unsigned short logsPerProducer = 5000;
+		static const std::array<const char*, numberOfProducers> producerFiles{ "producer0", "producer1", "producer2", "producer3" };
+
+		LogQueue queue;
+		std::vector<std::thread> producers;
+		for (std::size_t producer = 0; producer < numberOfProducers; ++producer)
+		{
+			producers.emplace_back([&queue, producer]() {
+				for (unsigned short i = 0; i < logsPerProducer; ++i)
+					while (!queue.tryPush(LogLevel::Info, "log", producerFiles[producer], i, 0))
+						std::this_thread::yield();
+			});
+		}
+
+		std::array<unsigned short, numberOfProducers> nextLines{};
+		std::size_t numberOfPoppedRecords = 0;
+		bool isOrderKept = true;
+		QueuedLogRecord record;
+		while (numberOfPoppedRecords < numberOfProducers * logsPerProducer)
+		{
+			if (!queue.tryPop(record))
+			{
+				std::this_thread::yield();
+				continue;
+			}
+			++numberOfPoppedRecords;
+			for (std::size_t producer = 0; producer < numberOfProducers; ++producer)
+			{
+				if (record.filePath != producerFiles[producer])
+					continue;
+				isOrderKept &= record.fileLine == nextLines[producer];
+				++nextLines[producer];
+			}
+		}
+
+		for (auto& producer : producers)
+			producer.join();
+
+		CHECK(isOrderKept);
+		for (auto nextLine : nextLines)
+			CHECK(nextLine == logsPerProducer);
+		CHECK_FALSE(queue.tryPop(record));
+	}
+}
@@ -4,10 +4,26 @@
 #include "../TestsUtilities/bufferedHandler.hpp"
 #include "mockHandler.hpp"
 
+#include <memory>
 #include <vector>
 
 namespace ph {
 
+	namespace {
+		class FlushingHandler : public Handler
+		{
+		public:
+			int numberOfHandledLogs = 0;
+
+		private:
+			void utilizeLog(const LogRecord& logRecord) override
+			{
+				++numberOfHandledLogs;
+				Logger::flush();
+			}
+		};
+	}
+
 	TEST_CASE("Logger creates correct log record", "[Logs][Logger]")
 	{
 		Tests::BufferedHandler handler;
@@ -74,4 +90,19 @@ namespace ph {
 			CHECK(Logger::removeLogsHandler(ref) == false);
 		}
 	}
+
+	TEST_CASE("Handler can flush Logger", "[Logs][Logger][Handler]")
+	{
+		auto handler = std::make_unique<FlushingHandler>();
+		handler->enableAllPaths();
+		handler->enableAllLogLevels();
+		const auto& ref = *handler;
+		Logger::addLogsHandler(std::move(handler));
+
+		Logger::createLog(LogLevel::Info, "flushed by handler", __FILE__, 0);
+		Logger::flush();
+		CHECK(ref.numberOfHandledLogs == 1);
+
+		CHECK(Logger::removeLogsHandler(ref));
+	}
 }
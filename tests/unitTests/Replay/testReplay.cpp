@@ -0,0 +1,65 @@
+#include "catch.hpp"
+
+#include "Replay/replay.hpp"
+#include <cstdio>
+
+namespace ph {
+
+TEST_CASE("Recorded replay is read back the same", "[Replay]")
+{
+	const std::string filePath = "testReplay.phr";
+
+	ReplayHeader header;
+	header.scenePath = "scenes/arcadeTheBunker.xml";
+	header.seed = 1234;
+	header.hasPlayer = true;
+	header.playerStatus = PlayerStatus{70, 40, 12};
+	header.playerPosition = {100.f, -50.f};
+
+	{
+		ReplayRecorder recorder(filePath);
+		recorder.start(header);
+
+		recorder.recordActionEvent(ActionEvent(Actions::GunAttack, ActionEvent::Pressed));
+		recorder.endFrame();
+		recorder.recordStep(makeActionMask(Actions::MovingUp), 1.f / 60.f);
+		recorder.recordStep(makeActionMask(Actions::MovingUp), 1.f / 60.f);
+		recorder.endFrame();
+
+		recorder.recordActionEvent(ActionEvent(Actions::GunAttack, ActionEvent::Released));
+		recorder.recordStep(makeActionMask(Actions::MovingUp, Actions::MovingLeft), 1.f / 120.f);
+		recorder.endFrame();
+	}
+
+	ReplayPlayer player;
+	REQUIRE(player.open(filePath));
+	CHECK(player.getHeader().scenePath == header.scenePath);
+	CHECK(player.getHeader().seed == header.seed);
+	CHECK(player.getHeader().hasPlayer);
+	CHECK(player.getHeader().playerStatus.numOfShotgunBullets == 12);
+	CHECK(player.getHeader().playerPosition == header.playerPosition);
+
+	ReplayFrame frame;
+	SECTION("frames without steps are merged into the next frame") {
+		REQUIRE(player.readFrame(frame));
+		REQUIRE(frame.actionEvents.size() == 1);
+		CHECK(frame.actionEvents[0].mAction == Actions::GunAttack);
+		CHECK(frame.actionEvents[0].mType == ActionEvent::Pressed);
+		REQUIRE(frame.steps.size() == 2);
+		CHECK(frame.steps[1].pressedActions == makeActionMask(Actions::MovingUp));
+		CHECK(frame.steps[1].simulationStep == 1.f / 60.f);
+	}
+	SECTION("changed pressed actions and simulation step are read back") {
+		REQUIRE(player.readFrame(frame));
+		REQUIRE(player.readFrame(frame));
+		CHECK(frame.actionEvents[0].mType == ActionEvent::Released);
+		REQUIRE(frame.steps.size() == 1);
+		CHECK(frame.steps[0].pressedActions == makeActionMask(Actions::MovingUp, Actions::MovingLeft));
+		CHECK(frame.steps[0].simulationStep == 1.f / 120.f);
+		CHECK_FALSE(player.readFrame(frame));
+	}
+
+	std::remove(filePath.c_str());
+}
+
+}
@@ -0,0 +1,50 @@
+#include <catch.hpp>
+
+#include "Resources/resourceArchive.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+namespace ph {
+
+	TEST_CASE("Resource archive reads files it was built from", "[Resources][ResourceArchive]")
+	{
+		const std::string text(500, 'a');
+		const std::string binary = "\x89PNG\r\n\x1a\n";
+		std::ofstream("testArchiveText.txt", std::ios::binary) << text;
+		std::ofstream("testArchiveBinary.png", std::ios::binary) << binary;
+
+		REQUIRE(ResourceArchive::build("testArchive.pack", {"testArchiveText.txt", "testArchiveBinary.png"}, true));
+
+		ResourceArchive archive;
+		REQUIRE(archive.open("testArchive.pack"));
+		CHECK(archive.getNumberOfEntries() == 2);
+		CHECK(archive.has("testArchiveText.txt"));
+		CHECK_FALSE(archive.has("testArchiveMissing.txt"));
+
+		auto textFile = archive.read("testArchiveText.txt");
+		REQUIRE(textFile);
+		CHECK(textFile->getBytes() == text);
+
+		auto binaryFile = archive.read("testArchiveBinary.png");
+		REQUIRE(binaryFile);
+		CHECK(binaryFile->getBytes() == binary);
+		CHECK(reinterpret_cast<std::uintptr_t>(binaryFile->data()) % 16 == 0);
+
+		archive.close();
+		std::remove("testArchive.pack");
+		std::remove("testArchiveText.txt");
+		std::remove("testArchiveBinary.png");
+	}
+
+	TEST_CASE("Resource archive doesn't open invalid files", "[Resources][ResourceArchive]")
+	{
+		std::ofstream("testArchiveInvalid.pack", std::ios::binary) << "definitely not an archive";
+
+		ResourceArchive archive;
+		CHECK_FALSE(archive.open("testArchiveInvalid.pack"));
+		CHECK_FALSE(archive.open("kjnaefjnshgnkjsdbgfhesbrgvjhnejv.pack"));   // make sure that this file is not real
+
+		std::remove("testArchiveInvalid.pack");
+	}
+}
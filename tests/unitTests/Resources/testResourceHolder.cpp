@@ -0,0 +1,71 @@
+#include <catch.hpp>
+
+#include "Resources/resourceHolder.hpp"
+
+namespace ph {
+
+	struct FakeResource
+	{
+		bool loadFromMemory(const void*, std::size_t) { return false; }
+		std::size_t memorySize = 100;
+	};
+
+	std::size_t getResourceMemorySize(const FakeResource& resource) { return resource.memorySize; }
+
+	TEST_CASE("Referenced resources aren't evicted", "[Resources][ResourceHolder]")
+	{
+		ResourceHolder<FakeResource> holder;
+		holder.insert("a", std::make_unique<FakeResource>());
+		holder.insert("b", std::make_unique<FakeResource>());
+		CHECK(holder.getMemoryUsage() == 200);
+
+		auto a = holder.acquire("a");
+		REQUIRE(a);
+		const auto handleOfB = holder.getHandle("b");
+		CHECK(holder.get(handleOfB) != nullptr);
+
+		holder.setMemoryBudget(150);
+		CHECK(holder.has("a"));
+		CHECK_FALSE(holder.has("b"));
+		CHECK(holder.get(handleOfB) == nullptr);
+		CHECK(holder.getMemoryUsage() == 100);
+
+		a.reset();
+		holder.trim();
+		CHECK(holder.has("a"));
+
+		holder.insert("c", std::make_unique<FakeResource>());
+		holder.trim();
+		CHECK_FALSE(holder.has("a"));
+		CHECK(holder.has("c"));
+	}
+
+	TEST_CASE("Copied references keep resource alive", "[Resources][ResourceHolder]")
+	{
+		ResourceHolder<FakeResource> holder;
+		holder.setMemoryBudget(0);
+		holder.insert("a", std::make_unique<FakeResource>());
+
+		auto a = holder.acquire("a");
+		{
+			auto copy = a;
+			a.reset();
+			holder.trim();
+			CHECK(holder.has("a"));
+			CHECK(copy.get() == holder.get(holder.getHandle("a")));
+		}
+		holder.trim();
+		CHECK_FALSE(holder.has("a"));
+	}
+
+	TEST_CASE("Resources accessed by file path are pinned", "[Resources][ResourceHolder]")
+	{
+		ResourceHolder<FakeResource> holder;
+		holder.insert("a", std::make_unique<FakeResource>());
+		holder.get("a");
+		holder.setMemoryBudget(0);
+		CHECK(holder.has("a"));
+		CHECK(holder.free("a"));
+		CHECK_FALSE(holder.has("a"));
+	}
+}
@@ -1,6 +1,6 @@
 #include <catch.hpp>
 
-#include "Resources/resourceHolder.hpp"
+#include "Resources/textureHolder.hpp"
 #include "../TestsUtilities/bufferedHandler.hpp"
 
 namespace ph {
@@ -1,4 +1,5 @@
 #include "bufferedHandler.hpp"
+#include "Logs/logger.hpp"
 
 namespace Tests {
 	
@@ -6,21 +7,25 @@ namespace Tests {
 
 	ph::LogRecord BufferedHandler::getLogRecordFromStart(size_t index) const
 	{
+		ph::Logger::flush();
 		return mLogRecords.at(index);
 	}
 
 	ph::LogRecord BufferedHandler::getLogRecordFromEnd(size_t index) const
 	{
+		ph::Logger::flush();
 		return mLogRecords.at(mLogRecords.size() - 1 - index);
 	}
 
 	size_t BufferedHandler::getRecordsCount() const
 	{
+		ph::Logger::flush();
 		return mLogRecords.size();
 	}
 
 	void BufferedHandler::clearRecords()
 	{
+		ph::Logger::flush();
 		mLogRecords.clear();
 	}
 
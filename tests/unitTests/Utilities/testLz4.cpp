@@ -0,0 +1,50 @@
+#include "catch.hpp"
+
+#include "Utilities/lz4.hpp"
+#include <string>
+
+namespace ph {
+
+namespace {
+	std::string roundTrip(const std::string& source)
+	{
+		const std::vector<char> compressed = Lz4::compress(source);
+		std::string decompressed(source.size(), '\0');
+		if(!Lz4::decompress(std::string_view(compressed.data(), compressed.size()), decompressed.data(), decompressed.size()))
+			return "decompression failed";
+		return decompressed;
+	}
+}
+
+TEST_CASE("Lz4 decompresses what it compressed", "[Utilities][Lz4]")
+{
+	CHECK(roundTrip("").empty());
+	CHECK(roundTrip("short") == "short");
+
+	std::string xml;
+	for(int i = 0; i < 200; ++i)
+		xml += "<tile id=\"" + std::to_string(i % 7) + "\" x=\"" + std::to_string(i) + "\"/>\n";
+	CHECK(roundTrip(xml) == xml);
+	CHECK(Lz4::compress(xml).size() < xml.size() / 2);
+
+	std::string bytes;
+	unsigned seed = 12345;
+	for(int i = 0; i < 100000; ++i) {
+		seed = seed * 1103515245u + 12345u;
+		bytes += static_cast<char>((seed >> 16) % (i % 3 == 0 ? 256 : 4));
+	}
+	CHECK(roundTrip(bytes) == bytes);
+	CHECK(roundTrip(std::string(1000, 'a')) == std::string(1000, 'a'));
+}
+
+TEST_CASE("Lz4 rejects corrupted data", "[Utilities][Lz4]")
+{
+	const std::string source(300, 'x');
+	std::vector<char> compressed = Lz4::compress(source);
+	std::string decompressed(source.size(), '\0');
+
+	CHECK_FALSE(Lz4::decompress(std::string_view(compressed.data(), compressed.size() - 1), decompressed.data(), decompressed.size()));
+	CHECK_FALSE(Lz4::decompress(std::string_view(compressed.data(), compressed.size()), decompressed.data(), decompressed.size() - 1));
+}
+
+}
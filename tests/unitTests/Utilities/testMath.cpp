@@ -148,4 +148,29 @@ TEMPLATE_TEST_CASE("Distance between two points", "[Utilities][Math][distanceBet
 	}
 }
 
+TEST_CASE("Get ray intersection distance", "[Utilities][Math]")
+{
+	const sf::FloatRect rect(10.f, 10.f, 10.f, 10.f);
+
+	SECTION("ray hits rect") {
+		auto distance = Math::getRayIntersectionDistance({0.f, 15.f}, {1.f, 0.f}, rect);
+		REQUIRE(distance);
+		CHECK(areEqual(*distance, 10.f));
+
+		distance = Math::getRayIntersectionDistance({0.f, 0.f}, {2.f, 2.f}, rect);
+		REQUIRE(distance);
+		CHECK(areEqual(*distance, 5.f));
+	}
+	SECTION("ray starts inside of rect") {
+		auto distance = Math::getRayIntersectionDistance({15.f, 15.f}, {0.f, -1.f}, rect);
+		REQUIRE(distance);
+		CHECK(areEqual(*distance, 0.f));
+	}
+	SECTION("ray misses rect") {
+		CHECK_FALSE(Math::getRayIntersectionDistance({0.f, 15.f}, {-1.f, 0.f}, rect));
+		CHECK_FALSE(Math::getRayIntersectionDistance({0.f, 0.f}, {1.f, 0.f}, rect));
+		CHECK_FALSE(Math::getRayIntersectionDistance({0.f, 0.f}, {1.f, 3.f}, rect));
+	}
+}
+
 }
@@ -166,4 +166,69 @@ TEST_CASE("Generated number is from given range", "[Utilities][Random]")
 	}
 }
 
+TEST_CASE("The same seed generates the same numbers", "[Utilities][Random]")
+{
+	Random::setSeed(7);
+	const float firstFloat = Random::generateNumber(0.f, 100.f);
+	const int firstInt = Random::generateNumber(0, 1000);
+	const sf::Vector2f firstVector = Random::generateVector({0.f, 0.f}, {100.f, 100.f});
+
+	Random::setSeed(7);
+	CHECK(Random::generateNumber(0.f, 100.f) == firstFloat);
+	CHECK(Random::generateNumber(0, 1000) == firstInt);
+	CHECK(Random::generateVector({0.f, 0.f}, {100.f, 100.f}) == firstVector);
+}
+
+TEST_CASE("Random generator streams are reproducible and independent", "[Utilities][Random]")
+{
+	RandomGenerator generator(42, Random::Streams::Particles);
+	RandomGenerator sameGenerator(42, Random::Streams::Particles);
+	RandomGenerator otherStream(42, Random::Streams::Zombies);
+
+	bool streamsDiffer = false;
+	for(int i = 0; i < 16; ++i) {
+		const std::uint32_t number = generator.next();
+		CHECK(sameGenerator.next() == number);
+		streamsDiffer |= otherStream.next() != number;
+	}
+	CHECK(streamsDiffer);
+
+	Random::setSeed(42);
+	RandomGenerator stream = Random::makeStream(Random::Streams::Particles);
+	RandomGenerator expected(42, Random::Streams::Particles);
+	CHECK(stream.next() == expected.next());
+}
+
+TEST_CASE("Random generator fills batches from given range", "[Utilities][Random]")
+{
+	RandomGenerator generator(7);
+
+	float numbers[64];
+	generator.generateNumbers(numbers, 64, -3.f, 5.f);
+	for(float number : numbers) {
+		CHECK(number >= -3.f);
+		CHECK(number <= 5.f);
+	}
+
+	sf::Vector2f vectors[64];
+	generator.generateVectors(vectors, 64, {-10.f, 2.f}, {10.f, 4.f});
+	for(const auto& vector : vectors) {
+		CHECK(vector.x >= -10.f);
+		CHECK(vector.x <= 10.f);
+		CHECK(vector.y >= 2.f);
+		CHECK(vector.y <= 4.f);
+	}
+
+	bool generatedMin = false, generatedMax = false;
+	for(int i = 0; i < 1000; ++i) {
+		const int number = generator.generateNumber(-2, 2);
+		REQUIRE(number >= -2);
+		REQUIRE(number <= 2);
+		generatedMin |= number == -2;
+		generatedMax |= number == 2;
+	}
+	CHECK(generatedMin);
+	CHECK(generatedMax);
+}
+
 }
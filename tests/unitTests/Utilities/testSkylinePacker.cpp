@@ -0,0 +1,39 @@
+#include "catch.hpp"
+
+#include "Utilities/skylinePacker.hpp"
+#include "Utilities/rect.hpp"
+
+namespace ph {
+
+TEST_CASE("Skyline packer places rects without overlapping", "[Utilities][SkylinePacker]")
+{
+	SkylinePacker packer({256, 256});
+	std::vector<IntRect> packed;
+	for(int i = 0; i < 200; ++i)
+	{
+		const sf::Vector2i size(4 + (i * 7) % 29, 4 + (i * 13) % 23);
+		const auto position = packer.insert(size);
+		if(!position)
+			continue;
+		const IntRect rect(*position, size);
+		CHECK(rect.left >= 0);
+		CHECK(rect.top >= 0);
+		CHECK(rect.right() <= 256);
+		CHECK(rect.bottom() <= 256);
+		for(const IntRect& other : packed)
+			CHECK_FALSE(rect.intersects(other));
+		packed.emplace_back(rect);
+	}
+	CHECK(packed.size() > 100);
+}
+
+TEST_CASE("Skyline packer rejects rects which don't fit", "[Utilities][SkylinePacker]")
+{
+	SkylinePacker packer({64, 64});
+	CHECK_FALSE(packer.insert({65, 10}));
+	CHECK_FALSE(packer.insert({0, 10}));
+	CHECK(packer.insert({64, 64}) == sf::Vector2i(0, 0));
+	CHECK_FALSE(packer.insert({1, 1}));
+}
+
+}
@@ -0,0 +1,39 @@
+#include "catch.hpp"
+
+#include "Utilities/threadPool.hpp"
+#include <atomic>
+
+namespace ph {
+
+TEST_CASE("Thread pool returns results of submitted tasks", "[Utilities][ThreadPool]")
+{
+	ThreadPool pool(3);
+	CHECK(pool.getNumberOfThreads() == 3);
+
+	std::vector<std::future<int>> results;
+	for(int i = 0; i < 20; ++i)
+		results.emplace_back(pool.submit([i]() { return i * i; }));
+
+	for(int i = 0; i < 20; ++i)
+		CHECK(results[i].get() == i * i);
+}
+
+TEST_CASE("Thread pool finishes queued tasks before destruction", "[Utilities][ThreadPool]")
+{
+	std::atomic<int> executedTasks = 0;
+	{
+		ThreadPool pool(2);
+		for(int i = 0; i < 50; ++i)
+			pool.submit([&executedTasks]() { ++executedTasks; });
+	}
+	CHECK(executedTasks == 50);
+}
+
+TEST_CASE("Thread pool passes exceptions through futures", "[Utilities][ThreadPool]")
+{
+	ThreadPool pool(1);
+	auto result = pool.submit([]() -> int { throw std::runtime_error("task failed"); });
+	CHECK_THROWS_AS(result.get(), std::runtime_error);
+}
+
+}
@@ -0,0 +1,33 @@
+#include <catch.hpp>
+
+#include "gameData.hpp"
+
+namespace ph {
+
+TEST_CASE("FixedTimestep runs as many steps as fit into accumulated frame time", "[FixedTimestep]")
+{
+	FixedTimestep fixedTimestep;
+	fixedTimestep.setSimulationRate(100.f);
+	REQUIRE(fixedTimestep.getSimulationStep() == sf::milliseconds(10));
+
+	SECTION("Frame shorter than step doesn't run simulation") {
+		CHECK(fixedTimestep.addFrameTime(sf::milliseconds(4)) == 0);
+		CHECK(fixedTimestep.getInterpolation() == Approx(.4f));
+	}
+
+	SECTION("Remaining time is carried over to the next frame") {
+		CHECK(fixedTimestep.addFrameTime(sf::milliseconds(25)) == 2);
+		CHECK(fixedTimestep.getInterpolation() == Approx(.5f));
+		CHECK(fixedTimestep.addFrameTime(sf::milliseconds(7)) == 1);
+		CHECK(fixedTimestep.getInterpolation() == Approx(.2f));
+	}
+
+	SECTION("Long frame runs at most maxStepsPerFrame steps") {
+		CHECK(fixedTimestep.addFrameTime(sf::milliseconds(500)) == FixedTimestep::maxStepsPerFrame);
+		CHECK(fixedTimestep.getInterpolation() == Approx(0.f));
+		CHECK(fixedTimestep.addFrameTime(sf::milliseconds(3)) == 0);
+		CHECK(fixedTimestep.getInterpolation() == Approx(.3f));
+	}
+}
+
+}
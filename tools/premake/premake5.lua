@@ -92,6 +92,9 @@ project "PopHead"
             "sfml-main"
         }
 
+    filter{"configurations:Release"}
+        defines{"PH_MIN_LOG_LEVEL=1"}
+
     filter{"configurations:Distribution"}
         defines{"PH_DISTRIBUTION"}
         kind "WindowedApp"
@@ -191,5 +194,44 @@ project "Tests"
 
     filter{}
     
+project "ResourcePacker"
+    location (root_dir)
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++17"
+
+    targetdir (exe_dir)
+	objdir (obj_dir)
+
+    debugdir "%{wks.location}"
+
+    includedirs{
+        root_dir .. "src"
+    }
+
+    files{
+        root_dir .. "tools/resourcePacker/**.cpp",
+        root_dir .. "src/Resources/resourceArchive.*",
+        root_dir .. "src/Resources/resourceSource.*",
+        root_dir .. "src/Utilities/lz4.*"
+    }
+
+    filter "configurations:Debug or Tests"
+        symbols "On"
+
+    filter{"configurations:Release or Distribution"}
+        optimize "On"
+
+    filter "system:Windows"
+        defines{"PH_WINDOWS"}
+
+    filter "system:Unix"
+        defines{"PH_LINUX"}
+
+    filter "system:Mac"
+        defines{"PH_MAC"}
+
+    filter{}
+    
 printf("For now PopHead supports only new Visual Studio versions and Codeblocks.")
 printf("If you have any problems with Premake or compiling PopHead contact Grzegorz \"Czapa\" Bednorz.")
\ No newline at end of file
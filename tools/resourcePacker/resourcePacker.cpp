@@ -0,0 +1,44 @@
+#include "Resources/resourceArchive.hpp"
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+int main(int argc, char* argv[])
+{
+	if(argc < 3) {
+		std::cout << "Usage: ResourcePacker <archive file> <directories...> [--compress]\n";
+		std::cout << "Run it from the game working directory, so paths in archive match paths used by the game.\n";
+		return 1;
+	}
+
+	bool compress = false;
+	std::vector<std::string> filePaths;
+	for(int i = 2; i < argc; ++i)
+	{
+		const std::string argument = argv[i];
+		if(argument == "--compress") {
+			compress = true;
+			continue;
+		}
+
+		std::error_code error;
+		for(const auto& entry : fs::recursive_directory_iterator(argument, error))
+			if(entry.is_regular_file())
+				filePaths.emplace_back(entry.path().lexically_normal().generic_string());
+		if(error) {
+			std::cout << "Cannot read directory \"" << argument << "\": " << error.message() << '\n';
+			return 1;
+		}
+	}
+
+	if(!ph::ResourceArchive::build(argv[1], filePaths, compress)) {
+		std::cout << "Building archive \"" << argv[1] << "\" failed\n";
+		return 1;
+	}
+
+	std::cout << "Packed " << filePaths.size() << " files into \"" << argv[1] << "\"\n";
+	return 0;
+}